@@ -289,7 +289,13 @@ types::FlightPlan Converter::convert(const EuroScopePlugIn::CFlightPlan& plan) {
 }
 
 types::Flight Converter::convert(const EuroScopePlugIn::CRadarTarget& target) {
-    types::Flight retval(target.GetCallsign());
+    std::shared_ptr<const types::FlightPlan> flightPlan;
+    return Converter::convert(target, types::CallsignTable::instance().intern(target.GetCallsign()), flightPlan);
+}
+
+types::Flight Converter::convert(const EuroScopePlugIn::CRadarTarget& target, types::FlightId id,
+                                 std::shared_ptr<const types::FlightPlan>& convertedPlan) {
+    types::Flight retval(target.GetCallsign(), id);
 
     retval.setGroundSpeed(static_cast<float>(target.GetPosition().GetReportedGS()) * types::knot);
     retval.setAirborne(40_kn < retval.groundSpeed());
@@ -314,8 +320,8 @@ types::Flight Converter::convert(const EuroScopePlugIn::CRadarTarget& target) {
                 retval.setHandoffInitiatedId(flightPlan.GetTrackingControllerId());
         }
         /* get the old handoff information */
-        else if (true == system::FlightRegistry::instance().flightExists(retval.callsign()) && true == retval.isTracked()) {
-            retval.setHandoffInitiatedId(system::FlightRegistry::instance().flight(retval.callsign()).handoffInitiatedId());
+        else if (true == system::FlightRegistry::instance().flightExists(retval.id()) && true == retval.isTracked()) {
+            retval.setHandoffInitiatedId(system::FlightRegistry::instance().flight(retval.id()).handoffInitiatedId());
         }
 
         /* check if the flight is marked by a controller */
@@ -331,8 +337,14 @@ types::Flight Converter::convert(const EuroScopePlugIn::CRadarTarget& target) {
             __analyzeScratchPad(scratch, retval);
         }
 
-        /* create the flight plan */
-        retval.setFlightPlan(Converter::convert(flightPlan));
+        /* create the flight plan or share the already converted one */
+        if (nullptr == convertedPlan) {
+            retval.setFlightPlan(Converter::convert(flightPlan));
+            convertedPlan = retval.sharedFlightPlan();
+        }
+        else {
+            retval.setFlightPlan(convertedPlan);
+        }
     }
 
     return retval;
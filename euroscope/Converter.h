@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #pragma warning(push, 0)
@@ -49,6 +50,16 @@ namespace topskytower {
              * @return The converted flight structure
              */
             static types::Flight convert(const EuroScopePlugIn::CRadarTarget& target);
+            /**
+             * @brief Converts an ES radar target into a TopSky-Tower flight structure and shares the flight plan
+             * The flight plan is converted only if no converted flight plan is given.
+             * @param[in] target The radar target
+             * @param[in] id The interned identifier of the target's callsign
+             * @param[in,out] flightPlan The converted flight plan of the target or nullptr if it needs to be converted
+             * @return The converted flight structure
+             */
+            static types::Flight convert(const EuroScopePlugIn::CRadarTarget& target, types::FlightId id,
+                                         std::shared_ptr<const types::FlightPlan>& flightPlan);
             /**
              * @brief Converts an ES controller structure into a TopSky-Tower controller information
              * @param[in] controller The ES controller
@@ -72,7 +72,8 @@ PlugIn::PlugIn() :
         },
         m_hiddenWindow(nullptr),
         m_transmissions(),
-        m_ipc(this) {
+        m_ipc(this),
+        m_flightPlans() {
     this->DisplayUserMessage("Message", PLUGIN_NAME, (std::string(PLUGIN_NAME) + " " + PLUGIN_VERSION + " loaded").c_str(),
                              false, false, false, false, false);
 
@@ -97,6 +98,9 @@ PlugIn::PlugIn() :
     this->m_settingsPath = path;
 
     system::ConfigurationRegistry::instance().configure(this->m_settingsPath, system::ConfigurationRegistry::UpdateType::All);
+    for (const auto& warning : std::as_const(system::ConfigurationRegistry::instance().warningMessages()))
+        this->DisplayUserMessage("Message", PLUGIN_NAME, warning.c_str(), true, true, false, false, false);
+    system::ConfigurationRegistry::instance().registerNotificationCallback(this, &PlugIn::reinitialize);
 
     this->RegisterTagItemType("Handoff frequency", static_cast<int>(PlugIn::TagItemElement::HandoffFrequency));
     this->RegisterTagItemType("Manually alerts 0", static_cast<int>(PlugIn::TagItemElement::ManuallyAlerts0));
@@ -148,6 +152,7 @@ PlugIn::PlugIn() :
 
 PlugIn::~PlugIn() {
     management::NotamControl::instance().deleteNotificationCallback(this);
+    system::ConfigurationRegistry::instance().deleteNotificationCallback(this);
 
     this->m_screens.clear();
 
@@ -461,8 +466,10 @@ void PlugIn::OnGetTagItem(EuroScopePlugIn::CFlightPlan flightPlan, EuroScopePlug
     (void)fontSize;
 
     /* do not handle invalid radar targets */
-    std::string callsign(radarTarget.GetCallsign());
-    if (true == this->m_errorMode || false == radarTarget.IsValid() || false == system::FlightRegistry::instance().flightExists(callsign))
+    if (true == this->m_errorMode || false == radarTarget.IsValid())
+        return;
+    auto id = types::CallsignTable::instance().find(radarTarget.GetCallsign());
+    if (false == system::FlightRegistry::instance().flightExists(id))
         return;
 
     /* initialize default values */
@@ -470,7 +477,7 @@ void PlugIn::OnGetTagItem(EuroScopePlugIn::CFlightPlan flightPlan, EuroScopePlug
     *colorCode = EuroScopePlugIn::TAG_COLOR_DEFAULT;
 
     /* get the screen and the converted flight information */
-    const types::Flight& flight = system::FlightRegistry::instance().flight(callsign);
+    const types::Flight& flight = system::FlightRegistry::instance().flight(id);
     auto flightScreen = this->findLastActiveScreen(true);
     if (nullptr == flightScreen)
         return;
@@ -547,13 +554,13 @@ void PlugIn::OnGetTagItem(EuroScopePlugIn::CFlightPlan flightPlan, EuroScopePlug
         bool finalizeRoute = false;
 
         surveillance::FlightPlanControl::instance().validate(flight);
-        if (true == surveillance::FlightPlanControl::instance().overwritten(flight.callsign())) {
+        if (true == surveillance::FlightPlanControl::instance().overwritten(flight)) {
             std::strcpy(itemString, "OK");
             *colorCode = EuroScopePlugIn::TAG_COLOR_DEFAULT;
             finalizeRoute = true;
         }
         else {
-            finalizeRoute = PlugIn::summarizeFlightPlanCheck(surveillance::FlightPlanControl::instance().errorCodes(flight.callsign()),
+            finalizeRoute = PlugIn::summarizeFlightPlanCheck(surveillance::FlightPlanControl::instance().errorCodes(flight),
                                                              itemString, colorCode);
         }
 
@@ -878,6 +885,14 @@ void PlugIn::updateGroundStatus(EuroScopePlugIn::CRadarTarget target, const std:
 
     system::FlightRegistry::instance().setAtcClearanceFlag(flight, mask);
 
+    /*
+     * the cached flight plan contains the old flags and a cleared arrival does not change the scratchpad
+     * -> share the flight plan with the new flags to avoid that the next update restores the old ones
+     */
+    auto cached = this->m_flightPlans.find(flight.id());
+    if (nullptr != cached)
+        *cached = system::FlightRegistry::instance().flight(flight.id()).sharedFlightPlan();
+
     if (0 != scratchPadExtend.length()) {
         auto split = helper::String::splitString(scratchPadExtend, ";");
         for (const auto& entry : std::as_const(split)) {
@@ -1180,9 +1195,9 @@ void PlugIn::OnFunctionCall(int functionId, const char* itemString, POINT pt, RE
     case PlugIn::TagItemFunction::PdcSendClearance:
     {
         management::PdcControl::ClearanceMessagePtr message(new management::PdcControl::ClearanceMessage());
-        message->sender = flight.flightPlan().origin();
+        message->sender = flight.flightPlan().origin().str();
         message->receiver = flight.callsign();
-        message->destination = flight.flightPlan().destination();
+        message->destination = flight.flightPlan().destination().str();
         message->sid = flight.flightPlan().departureRoute();
         message->runway = radarTarget.GetCorrelatedFlightPlan().GetFlightPlanData().GetDepartureRwy();
         message->frequency = flightScreen->sectorControl().ownSector().primaryFrequency();
@@ -1205,7 +1220,7 @@ void PlugIn::OnFunctionCall(int functionId, const char* itemString, POINT pt, RE
     case PlugIn::TagItemFunction::FlightPlanCheckMenu:
     {
         /* check if the flight plan is valid */
-        const auto& codes = surveillance::FlightPlanControl::instance().errorCodes(flight.callsign());
+        const auto& codes = surveillance::FlightPlanControl::instance().errorCodes(flight);
         bool isValid = false;
         if (1 == codes.size()) {
             if (surveillance::FlightPlanControl::ErrorCode::NoError == codes.front() ||
@@ -1225,13 +1240,13 @@ void PlugIn::OnFunctionCall(int functionId, const char* itemString, POINT pt, RE
     }
     case PlugIn::TagItemFunction::FlightPlanCheckErrorLog:
     {
-        auto messageLog = PlugIn::flightPlanCheckResultLog(surveillance::FlightPlanControl::instance().errorCodes(flight.callsign()));
+        auto messageLog = PlugIn::flightPlanCheckResultLog(surveillance::FlightPlanControl::instance().errorCodes(flight));
         auto viewer = new MessageViewerWindow(flightScreen, "FP check: " + flight.callsign(), messageLog);
         viewer->setActive(true);
         break;
     }
     case PlugIn::TagItemFunction::FlightPlanCheckOverwrite:
-        surveillance::FlightPlanControl::instance().overwrite(flight.callsign());
+        surveillance::FlightPlanControl::instance().overwrite(flight);
         break;
     case PlugIn::TagItemFunction::StandControlMenu:
     {
@@ -1253,7 +1268,7 @@ void PlugIn::OnFunctionCall(int functionId, const char* itemString, POINT pt, RE
         break;
     }
     case PlugIn::TagItemFunction::StandControlAutomatic:
-        flightScreen->standControl().removeFlight(flight.callsign());
+        flightScreen->standControl().removeFlight(flight.id());
         flightScreen->standControl().updateFlight(flight, flightScreen->identifyType(flight));
         break;
     case PlugIn::TagItemFunction::StandControlManualEvent:
@@ -1391,21 +1406,45 @@ void PlugIn::OnTimer(int counter) {
         auto callsigns = helper::String::splitString(message, ":");
         surveillance::RadioControl::instance().transmissions(callsigns);
     }
+
+    /* provide the flights of this cycle to the other threads */
+    system::FlightRegistry::instance().publish();
 }
 
 void PlugIn::OnRadarTargetPositionUpdate(EuroScopePlugIn::CRadarTarget radarTarget) {
     if (false == radarTarget.IsValid())
         return;
-    system::FlightRegistry::instance().updateFlight(Converter::convert(radarTarget));
+
+    /* the flight plan changes only with the flight plan callbacks -> share the last converted flight plan */
+    auto id = types::CallsignTable::instance().intern(radarTarget.GetCallsign());
+    std::shared_ptr<const types::FlightPlan> flightPlan;
+    const auto* converted = this->m_flightPlans.find(id);
+    if (nullptr != converted)
+        flightPlan = *converted;
+
+    auto flight = Converter::convert(radarTarget, id, flightPlan);
+    system::FlightRegistry::instance().updateFlight(flight);
+
+    /*
+     * the TopSky-flags of the scratchpad are converted only once and are merged into the registry's flight plan
+     * -> cache the merged flight plan to avoid a copy per update
+     */
+    if (nullptr != flightPlan)
+        this->m_flightPlans[id] = system::FlightRegistry::instance().flight(id).sharedFlightPlan();
 }
 
 void PlugIn::OnFlightPlanFlightPlanDataUpdate(EuroScopePlugIn::CFlightPlan flightPlan) {
+    this->m_flightPlans.erase(types::CallsignTable::instance().find(flightPlan.GetCallsign()));
+
     if (false == flightPlan.GetCorrelatedRadarTarget().IsValid())
         return;
     system::FlightRegistry::instance().updateFlight(Converter::convert(flightPlan.GetCorrelatedRadarTarget()));
 }
 
 void PlugIn::OnFlightPlanControllerAssignedDataUpdate(EuroScopePlugIn::CFlightPlan flightPlan, int type) {
+    /* every assigned data is part of the flight plan */
+    this->m_flightPlans.erase(types::CallsignTable::instance().find(flightPlan.GetCallsign()));
+
     /* handle only relevant changes */
     if (EuroScopePlugIn::CTR_DATA_TYPE_TEMPORARY_ALTITUDE != type &&
         EuroScopePlugIn::CTR_DATA_TYPE_SQUAWK != type &&
@@ -1426,8 +1465,19 @@ void PlugIn::OnFlightPlanControllerAssignedDataUpdate(EuroScopePlugIn::CFlightPl
 }
 
 void PlugIn::OnFlightPlanDisconnect(EuroScopePlugIn::CFlightPlan flightPlan) {
-    system::FlightRegistry::instance().removeFlight(flightPlan.GetCallsign());
-    surveillance::FlightPlanControl::instance().removeFlight(flightPlan.GetCallsign());
+    auto id = types::CallsignTable::instance().find(flightPlan.GetCallsign());
+    if (types::CallsignTable::Invalid == id)
+        return;
+
+    this->m_flightPlans.erase(id);
+    system::FlightRegistry::instance().removeFlight(id);
+    surveillance::FlightPlanControl::instance().removeFlight(id);
+}
+
+void PlugIn::reinitialize(system::ConfigurationRegistry::UpdateType type) {
+    /* the converted flight plans contain the configured aircrafts */
+    if (system::ConfigurationRegistry::UpdateType::All == type || system::ConfigurationRegistry::UpdateType::Aircrafts == type)
+        this->m_flightPlans.clear();
 }
 
 void PlugIn::pdcMessageReceived() {
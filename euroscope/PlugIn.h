@@ -9,6 +9,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #pragma warning(push, 0)
 #include <EuroScopePlugIn.h>
@@ -16,6 +17,7 @@
 
 #include <surveillance/FlightPlanControl.h>
 #include <types/AirportConfiguration.h>
+#include <types/FlightId.h>
 #include <types/SystemConfiguration.h>
 
 #include "HiddenWindow.h"
@@ -102,16 +104,17 @@ namespace topskytower {
                 HoldingPoint          = 2013
             };
 
-            bool                                    m_errorMode;
-            std::string                             m_settingsPath;
-            std::list<RadarScreen*>                 m_screens;
-            std::function<void(const std::string&)> m_uiCallback;
-            std::string                             m_pdcNotificationSound;
-            WNDCLASSA                               m_windowClass;
-            HWND                                    m_hiddenWindow;
-            std::mutex                              m_transmissionsLock;
-            std::list<std::string>                  m_transmissions;
-            RdfIPC                                  m_ipc;
+            bool                                                      m_errorMode;
+            std::string                                               m_settingsPath;
+            std::list<RadarScreen*>                                   m_screens;
+            std::function<void(const std::string&)>                   m_uiCallback;
+            std::string                                               m_pdcNotificationSound;
+            WNDCLASSA                                                 m_windowClass;
+            HWND                                                      m_hiddenWindow;
+            std::mutex                                                m_transmissionsLock;
+            std::list<std::string>                                    m_transmissions;
+            RdfIPC                                                    m_ipc;
+            types::FlightMap<std::shared_ptr<const types::FlightPlan>> m_flightPlans;
 
             static std::string findScratchPadEntry(const EuroScopePlugIn::CFlightPlan& plan, const std::string& marker,
                                                    const std::string& entry);
@@ -130,6 +133,7 @@ namespace topskytower {
             void updateHoldingPoint(const types::Flight& flight, EuroScopePlugIn::CFlightPlan& plan);
             void updateSectorHandoff(const types::Flight& flight);
             void checkNotamsOfActiveRunways();
+            void reinitialize(system::ConfigurationRegistry::UpdateType type);
 
         public:
             /**
@@ -13,6 +13,8 @@
 
 #include <formats/AirportFileFormat.h>
 #include <formats/EseFileFormat.h>
+#include <formats/SectorCacheFileFormat.h>
+#include <helper/Clock.h>
 #include <helper/Exception.h>
 #include <helper/String.h>
 #include <management/NotamControl.h>
@@ -30,14 +32,37 @@ using namespace topskytower;
 using namespace topskytower::euroscope;
 using namespace topskytower::types;
 
+/* the airport center and the runways of the screens that share a sector graph */
+struct SharedAirport {
+    std::weak_ptr<const management::SectorGraph> graph;
+    Coordinate                                   center;
+    std::list<Runway>                            runways;
+};
+static std::mutex __sharedAirportsLock;
+static std::map<std::string, SharedAirport> __sharedAirports;
+
+static void __forgetReleasedAirports() {
+    std::lock_guard guard(__sharedAirportsLock);
+
+    /* the airport information lives as long as the shared graph */
+    for (auto it = __sharedAirports.begin(); __sharedAirports.end() != it;) {
+        if (true == it->second.graph.expired())
+            it = __sharedAirports.erase(it);
+        else
+            ++it;
+    }
+}
+
 RadarScreen::RadarScreen() :
         EuroScopePlugIn::CRadarScreen(),
         m_initialized(false),
         m_sectorFileIsMissing(false),
         m_airport(),
+        m_airportCode(),
         m_elevation(),
         m_runways(),
         m_userInterface(new UiManager(this)),
+        m_projection(nullptr),
         m_sectorControl(nullptr),
         m_standControl(nullptr),
         m_departureControl(nullptr),
@@ -72,8 +97,13 @@ RadarScreen::~RadarScreen() {
         delete this->m_sectorControl;
     if (nullptr != this->m_standControl)
         delete this->m_standControl;
+    if (nullptr != this->m_projection)
+        delete this->m_projection;
     if (nullptr != this->m_userInterface)
         delete this->m_userInterface;
+
+    /* the last screen of an airport releases the shared graph */
+    __forgetReleasedAirports();
 }
 
 void RadarScreen::OnAsrContentLoaded(bool loaded) {
@@ -81,6 +111,7 @@ void RadarScreen::OnAsrContentLoaded(bool loaded) {
         auto value = this->GetDataFromAsr("Airport");
         if (nullptr != value) {
             this->m_airport = value;
+            this->m_airportCode = types::IcaoCode(this->m_airport);
             management::NotamControl::instance().addAirport(this->m_airport);
 
             auto configuration = system::ConfigurationRegistry::instance().runtimeConfiguration();
@@ -186,10 +217,15 @@ void RadarScreen::OnRadarTargetPositionUpdate(EuroScopePlugIn::CRadarTarget rada
     if (false == this->isInitialized())
         return;
 
-    if (false == radarTarget.IsValid() || false == system::FlightRegistry::instance().flightExists(radarTarget.GetCallsign()))
+    if (false == radarTarget.IsValid())
         return;
 
-    const auto& flight = system::FlightRegistry::instance().flight(radarTarget.GetCallsign());
+    /* the plug-in interned the callsign before the screens receive the update */
+    auto id = types::CallsignTable::instance().find(radarTarget.GetCallsign());
+    if (false == system::FlightRegistry::instance().flightExists(id))
+        return;
+
+    const auto& flight = system::FlightRegistry::instance().flight(id);
     auto type = this->identifyType(flight);
 
     this->m_sectorControl->updateFlight(flight, type);
@@ -213,12 +249,12 @@ void RadarScreen::OnFlightPlanControllerAssignedDataUpdate(EuroScopePlugIn::CFli
         return;
     }
 
-    auto callsign = flightPlan.GetCallsign();
-    if (false == flightPlan.GetCorrelatedRadarTarget().IsValid() || false == system::FlightRegistry::instance().flightExists(callsign))
+    auto id = types::CallsignTable::instance().find(flightPlan.GetCallsign());
+    if (false == flightPlan.GetCorrelatedRadarTarget().IsValid() || false == system::FlightRegistry::instance().flightExists(id))
         return;
 
     /* update the internal structures that are effected by the flight plan changes */
-    const auto& flight = system::FlightRegistry::instance().flight(callsign);
+    const auto& flight = system::FlightRegistry::instance().flight(id);
     auto flightType = this->identifyType(flight);
 
     this->m_departureControl->updateFlight(flight, flightType);
@@ -240,15 +276,118 @@ void RadarScreen::OnFlightPlanDisconnect(EuroScopePlugIn::CFlightPlan flightPlan
     if (false == this->isInitialized())
         return;
 
-    std::string callsign = flightPlan.GetCallsign();
+    auto id = types::CallsignTable::instance().find(flightPlan.GetCallsign());
+    if (types::CallsignTable::Invalid == id)
+        return;
+
+    this->m_standControl->removeFlight(id);
+    this->m_sectorControl->removeFlight(id);
+    this->m_departureControl->removeFlight(id);
+    this->m_ariwsControl->removeFlight(id);
+    this->m_cmacControl->removeFlight(id);
+    this->m_mtcdControl->removeFlight(id);
+    this->m_stcdControl->removeFlight(id);
+}
+
+std::string RadarScreen::sectorGraphKey(const std::string& sectorName) const {
+    return sectorName + ":" + this->m_airport;
+}
+
+bool RadarScreen::loadSharedSectors(const std::string& sectorName, types::Coordinate& center) {
+    auto key = this->sectorGraphKey(sectorName);
+
+    /* an other screen of the same airport holds the graph -> it parsed the sector files already */
+    auto graph = management::SectorGraph::find(key);
+    if (nullptr == graph)
+        return false;
+
+    std::lock_guard guard(__sharedAirportsLock);
+
+    auto it = __sharedAirports.find(key);
+    if (__sharedAirports.cend() == it || it->second.graph.lock() != graph)
+        return false;
+
+    center = it->second.center;
+    this->m_runways = it->second.runways;
+
+    if (nullptr != this->m_sectorControl)
+        delete this->m_sectorControl;
+    this->m_sectorControl = new management::SectorControl(graph);
+
+    return true;
+}
+
+void RadarScreen::storeSharedSectors(const std::string& sectorName, const types::Coordinate& center) {
+    auto key = this->sectorGraphKey(sectorName);
+    auto graph = management::SectorGraph::find(key);
+    if (nullptr == graph)
+        return;
+
+    __forgetReleasedAirports();
 
-    this->m_standControl->removeFlight(callsign);
-    this->m_sectorControl->removeFlight(callsign);
-    this->m_departureControl->removeFlight(callsign);
-    this->m_ariwsControl->removeFlight(callsign);
-    this->m_cmacControl->removeFlight(callsign);
-    this->m_mtcdControl->removeFlight(callsign);
-    this->m_stcdControl->removeFlight(callsign);
+    std::lock_guard guard(__sharedAirportsLock);
+    __sharedAirports[key] = { graph, center, this->m_runways };
+}
+
+bool RadarScreen::loadSectorCache(const std::string& filename, const std::string& sectorName, types::Coordinate& center) {
+    formats::SectorCacheFileFormat cache;
+    if (false == cache.load(filename, sectorName, this->m_airport))
+        return false;
+
+    std::shared_ptr<const management::SectorGraph> graph;
+    std::list<types::Runway> runways;
+
+    try {
+        helper::BinaryReader reader(cache.payload());
+
+        center = types::Coordinate(reader);
+
+        /* the runways are recreated out of the cached thresholds */
+        auto count = reader.read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < count; ++i) {
+            auto name = reader.readString();
+            types::Coordinate start(reader);
+            types::Coordinate end(reader);
+
+            runways.push_back(types::Runway(name, start, end));
+        }
+
+        /* an other screen of the same airport provides the graph already */
+        graph = management::SectorGraph::shared(this->sectorGraphKey(sectorName), [&reader]() {
+            return std::make_shared<const management::SectorGraph>(reader);
+        });
+    }
+    catch (const helper::Exception&) {
+        return false;
+    }
+
+    if (nullptr != this->m_sectorControl)
+        delete this->m_sectorControl;
+    this->m_sectorControl = new management::SectorControl(graph);
+    this->m_runways = std::move(runways);
+
+    return true;
+}
+
+void RadarScreen::storeSectorCache(const std::string& filename, const std::string& sectorName,
+                                   const formats::EseFileFormat& file, const types::Coordinate& center,
+                                   const management::SectorGraph& graph) {
+    helper::BinaryWriter writer;
+
+    center.serialize(writer);
+
+    writer.write(static_cast<std::uint32_t>(this->m_runways.size()));
+    for (const auto& runway : std::as_const(this->m_runways)) {
+        writer.write(runway.name());
+        runway.start().serialize(writer);
+        runway.end().serialize(writer);
+    }
+
+    graph.serialize(writer);
+
+    /* a failed cache is not critical and the sector files are parsed during the next start */
+    formats::SectorCacheFileFormat::store(filename, sectorName, this->m_airport,
+                                          { file.sctFilename(), file.eseFilename() }, writer.buffer());
 }
 
 void RadarScreen::initialize() {
@@ -272,60 +411,81 @@ void RadarScreen::initialize() {
 
     /* received the correct sector filename identifier */
     if (nullptr != sctFilename && 0 != std::strlen(sctFilename)) {
-        formats::EseFileFormat file;
+        auto cacheFilename = (std::filesystem::path(static_cast<PlugIn*>(this->GetPlugIn())->settingsPath()) /
+                              ("TopSkyTowerSectorCache" + this->m_airport + ".bin")).string();
+        types::Coordinate center;
 
-        try {
-            if (false == file.parse(sctFilename)) {
+        /* parse the sector files only if no other screen shares them and the cache is outdated */
+        bool shared = this->loadSharedSectors(sctFilename, center);
+        if (false == shared && false == this->loadSectorCache(cacheFilename, sctFilename, center)) {
+            formats::EseFileFormat file;
+
+            try {
+                if (false == file.parse(sctFilename)) {
+                    this->m_sectorFileIsMissing = true;
+                    return;
+                }
+            }
+            catch (const helper::Exception& ex) {
+                this->GetPlugIn()->DisplayUserMessage("Message", "TopSky-Tower", ex.message().c_str(), true, true, true, true, false);
                 this->m_sectorFileIsMissing = true;
                 return;
             }
-        }
-        catch (const helper::Exception& ex) {
-            this->GetPlugIn()->DisplayUserMessage("Message", "TopSky-Tower", ex.message().c_str(), true, true, true, true, false);
-            this->m_sectorFileIsMissing = true;
-            return;
-        }
 
-        if (nullptr != this->m_sectorControl)
-            delete this->m_sectorControl;
-        this->m_sectorControl = new management::SectorControl(this->m_airport, file.sectors());
+            auto graph = management::SectorGraph::shared(this->sectorGraphKey(sctFilename), [this, &file]() {
+                return std::make_shared<const management::SectorGraph>(this->m_airport, file.sectors());
+            });
 
-        /* find the center of the airport */
-        types::Coordinate center;
-        for (const auto& sector : std::as_const(file.sectors())) {
-            if (sector.controllerInfo().prefix() == this->m_airport) {
-                center = sector.controllerInfo().centerPoint();
-                break;
+            if (nullptr != this->m_sectorControl)
+                delete this->m_sectorControl;
+            this->m_sectorControl = new management::SectorControl(graph);
+
+            /* find the center of the airport */
+            for (const auto& sector : std::as_const(file.sectors())) {
+                if (sector.controllerInfo().prefix() == this->m_airport) {
+                    center = sector.controllerInfo().centerPoint();
+                    break;
+                }
             }
+
+            this->m_runways = file.runways(this->m_airport);
+            this->storeSectorCache(cacheFilename, sctFilename, file, center, *graph);
         }
+        if (false == shared)
+            this->storeSharedSectors(sctFilename, center);
+
+        /* all controls share the projection of the airport -> replace it after the controls are replaced */
+        auto projection = new types::ProjectionContext(center);
 
         if (nullptr != this->m_standControl)
             delete this->m_standControl;
-        this->m_standControl = new management::StandControl(this->m_airport, center);
+        this->m_standControl = new management::StandControl(this->m_airport, projection);
 
         if (nullptr != this->m_ariwsControl)
             delete this->m_ariwsControl;
-        this->m_ariwsControl = new surveillance::ARIWSControl(this->m_airport, center);
+        this->m_ariwsControl = new surveillance::ARIWSControl(this->m_airport, projection);
 
         if (nullptr != this->m_cmacControl)
             delete this->m_cmacControl;
-        this->m_cmacControl = new surveillance::CMACControl(this->m_airport, center);
+        this->m_cmacControl = new surveillance::CMACControl(this->m_airport, projection);
 
         if (nullptr != this->m_departureControl)
             delete this->m_departureControl;
-        this->m_departureControl = new management::DepartureSequenceControl(this->m_airport, center);
+        this->m_departureControl = new management::DepartureSequenceControl(this->m_airport, projection);
 
         if (nullptr != this->m_mtcdControl)
             delete this->m_mtcdControl;
-        this->m_mtcdControl = new surveillance::MTCDControl(center, this->m_departureControl);
+        this->m_mtcdControl = new surveillance::MTCDControl(projection, this->m_departureControl);
         this->m_mtcdControl->registerSidExtraction(this, &RadarScreen::extractPredictedSID);
 
         if (nullptr != this->m_stcdControl)
             delete this->m_stcdControl;
         this->m_stcdControl = new surveillance::STCDControl(this->m_airport, this->m_elevation, center,
-                                                            file.runways(this->m_airport), this->m_departureControl);
+                                                            this->m_runways, this->m_departureControl);
 
-        this->m_runways = file.runways(this->m_airport);
+        if (nullptr != this->m_projection)
+            delete this->m_projection;
+        this->m_projection = projection;
 
         this->m_initialized = true;
     }
@@ -533,7 +693,7 @@ bool RadarScreen::visualizeSTCD(const types::Flight& flight, Gdiplus::Graphics&
 
 void RadarScreen::drawData(std::mutex& lock, std::list<std::pair<std::string, types::Time>>& data,
                            bool surveillanceData, Gdiplus::Graphics& graphics) {
-    auto now = std::chrono::system_clock::now();
+    auto now = helper::Clock::instance().now();
     auto delta = static_cast<float>(std::chrono::duration_cast<std::chrono::milliseconds>(now - this->m_lastRenderingTime).count()) * types::millisecond;
 
     /* draw the different visualization results */
@@ -743,7 +903,7 @@ void RadarScreen::OnRefresh(HDC hdc, int phase) {
     this->drawDeactivatedStands(graphics);
     this->drawTransmittingFlights(graphics);
 
-    this->m_lastRenderingTime = std::chrono::system_clock::now();
+    this->m_lastRenderingTime = helper::Clock::instance().now();
 
     /* visualize everything of the UI manager */
     if (nullptr != this->m_userInterface)
@@ -965,16 +1125,18 @@ void RadarScreen::activateStandOnScreenSelection(bool activate, const std::strin
 }
 
 types::Flight::Type RadarScreen::identifyType(const types::Flight& flight) {
-    if (this->m_airport == flight.flightPlan().origin() && this->m_airport == flight.flightPlan().destination()) {
+    const auto& airport = this->m_airportCode;
+
+    if (airport == flight.flightPlan().origin() && airport == flight.flightPlan().destination()) {
         if (true == flight.airborne())
             return types::Flight::Type::Arrival;
         else
             return types::Flight::Type::Departure;
     }
-    else if (this->m_airport == flight.flightPlan().origin()) {
+    else if (airport == flight.flightPlan().origin()) {
         return types::Flight::Type::Departure;
     }
-    else if (this->m_airport == flight.flightPlan().destination()) {
+    else if (airport == flight.flightPlan().destination()) {
         return types::Flight::Type::Arrival;
     }
     else {
@@ -15,6 +15,7 @@
 #include <EuroScopePlugIn.h>
 #pragma warning(pop)
 
+#include <formats/EseFileFormat.h>
 #include <management/DepartureSequenceControl.h>
 #include <management/SectorControl.h>
 #include <management/StandControl.h>
@@ -23,6 +24,7 @@
 #include <surveillance/MTCDControl.h>
 #include <surveillance/STCDControl.h>
 #include <system/FlightRegistry.h>
+#include <types/Code.h>
 
 #include "ui/UiManager.h"
 
@@ -57,9 +59,11 @@ namespace topskytower {
             bool                                           m_initialized;
             bool                                           m_sectorFileIsMissing;
             std::string                                    m_airport;
+            types::IcaoCode                                m_airportCode;
             types::Length                                  m_elevation;
             std::list<types::Runway>                       m_runways;
             UiManager*                                     m_userInterface;
+            types::ProjectionContext*                      m_projection;
             management::SectorControl*                     m_sectorControl;
             management::StandControl*                      m_standControl;
             management::DepartureSequenceControl*          m_departureControl;
@@ -79,6 +83,13 @@ namespace topskytower {
             bool                                           m_standOnScreenSelection;
             std::string                                    m_standOnScreenSelectionCallsign;
 
+            std::string sectorGraphKey(const std::string& sectorName) const;
+            bool loadSharedSectors(const std::string& sectorName, types::Coordinate& center);
+            void storeSharedSectors(const std::string& sectorName, const types::Coordinate& center);
+            bool loadSectorCache(const std::string& filename, const std::string& sectorName, types::Coordinate& center);
+            void storeSectorCache(const std::string& filename, const std::string& sectorName,
+                                  const formats::EseFileFormat& file, const types::Coordinate& center,
+                                  const management::SectorGraph& graph);
             void initialize();
             Gdiplus::PointF convertCoordinate(const types::Coordinate& coordinate);
             static void estimateOffsets(Gdiplus::PointF& start, Gdiplus::PointF& center, Gdiplus::PointF& end,
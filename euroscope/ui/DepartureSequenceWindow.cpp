@@ -89,7 +89,7 @@ bool DepartureSequenceWindow::updateRow(const types::Flight& flight, std::size_t
 
     /* update some flight information */
     this->m_departureTable->setElement(row, 1, flight.flightPlan().departureRoute());
-    this->m_departureTable->setElement(row, 2, flight.flightPlan().departureRunway());
+    this->m_departureTable->setElement(row, 2, flight.flightPlan().departureRunway().str());
     this->m_departureTable->setElement(row, 3, this->m_parent->departureSequenceControl().holdingPoint(flight).name);
     this->m_departureTable->setElement(row, 4, this->translate(flight.flightPlan().departureFlag()));
 
@@ -40,8 +40,9 @@ void IpaToolbarButton::clicked() {
         auto cit = it;
         std::advance(cit, 1);
 
-        if (airportConfig.ipaRunways.cend() != airportConfig.ipaRunways.find(*it)) {
-            auto partnerIt = airportConfig.ipaRunways.find(*it);
+        types::RunwayCode runway(*it);
+        if (airportConfig.ipaRunways.cend() != airportConfig.ipaRunways.find(runway)) {
+            auto partnerIt = airportConfig.ipaRunways.find(runway);
             const auto& partnerRwys = partnerIt->second;
 
             for (; arrivalRunways.cend() != cit; ++cit) {
@@ -52,8 +53,8 @@ void IpaToolbarButton::clicked() {
                 }
             }
         }
-        else if (airportConfig.prmRunways.cend() != airportConfig.prmRunways.find(*it)) {
-            auto partnerIt = airportConfig.prmRunways.find(*it);
+        else if (airportConfig.prmRunways.cend() != airportConfig.prmRunways.find(runway)) {
+            auto partnerIt = airportConfig.prmRunways.find(runway);
             const auto& partnerRwys = partnerIt->second;
 
             for (; arrivalRunways.cend() != cit; ++cit) {
@@ -66,12 +66,12 @@ bool AirportFileFormat::parseSid(const std::vector<std::string>& elements, types
 bool AirportFileFormat::parseConstraint(const std::vector<std::string>& elements, types::DestinationConstraint& constraint) {
     if (5 != elements.size())
         return false;
-    if (0 == elements[1].length())
+    if (0 == elements[1].length() || false == types::IcaoCode::fits(elements[1]))
         return false;
     if (0 == elements[2].length())
         return false;
 
-    constraint.destination = elements[1];
+    constraint.destination = types::IcaoCode(elements[1]);
     constraint.evenCruiseLevel = '0' != elements[2][0];
     if (0 != elements[3].length())
         constraint.minimumCruiseLevel = static_cast<float>(std::atoi(elements[3].c_str())) * types::feet;
@@ -368,9 +368,12 @@ bool AirportFileFormat::parsePriorities(types::AirportConfiguration& config, con
 }
 
 bool AirportFileFormat::parseHoldingPoint(const std::vector<std::string>& elements, types::HoldingPoint& holdingPoint) {
+    if (false == types::RunwayCode::fits(elements[2]))
+        return false;
+
     holdingPoint.name = elements[3];
     holdingPoint.lowVisibility = elements[1][0] == 'L';
-    holdingPoint.runway = elements[2];
+    holdingPoint.runway = types::RunwayCode(elements[2]);
     std::list<types::Aircraft::WTC> wtc;
     if (false == AirportFileFormat::parseWtc(elements[4], wtc) || 0 == wtc.size())
         return false;
@@ -431,21 +434,26 @@ bool AirportFileFormat::parseAirportData(types::AirportConfiguration& config, co
             this->m_errorMessage = "Invalid runway definitions";
             return false;
         }
+        if (false == types::RunwayCode::fits(split[1]) || false == types::RunwayCode::fits(split[2])) {
+            this->m_errorLine = lineOffset;
+            this->m_errorMessage = "Runway identifier too long";
+            return false;
+        }
 
         /* check if IPA is defined */
         if ("IPA" == split[0]) {
-            config.ipaRunways[split[1]].push_back(split[2]);
-            config.ipaRunways[split[2]].push_back(split[1]);
+            config.ipaRunways[types::RunwayCode(split[1])].push_back(types::RunwayCode(split[2]));
+            config.ipaRunways[types::RunwayCode(split[2])].push_back(types::RunwayCode(split[1]));
         }
         /* check if PRM is defined */
         else if ("PRM" == split[0]) {
-            config.prmRunways[split[1]].push_back(split[2]);
-            config.prmRunways[split[2]].push_back(split[1]);
+            config.prmRunways[types::RunwayCode(split[1])].push_back(types::RunwayCode(split[2]));
+            config.prmRunways[types::RunwayCode(split[2])].push_back(types::RunwayCode(split[1]));
         }
         /* check if IPD is defined */
         else {
-            config.ipdRunways[split[1]].push_back(split[2]);
-            config.ipdRunways[split[2]].push_back(split[1]);
+            config.ipdRunways[types::RunwayCode(split[1])].push_back(types::RunwayCode(split[2]));
+            config.ipdRunways[types::RunwayCode(split[2])].push_back(types::RunwayCode(split[1]));
         }
     }
 
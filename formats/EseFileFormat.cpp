@@ -9,6 +9,8 @@
  *   GNU General Public License v3 (GPLv3)
  */
 
+#include <span>
+
 #include <helper/Exception.h>
 #include <helper/String.h>
 #include <formats/EseFileFormat.h>
@@ -19,7 +21,7 @@ using namespace topskytower;
 using namespace topskytower::formats;
 
 static __inline bool __createEdges(const std::vector<std::string>& borderDef,
-                                   const std::map<std::string, std::list<types::Coordinate>>& sectorlines,
+                                   const std::map<std::string, std::vector<types::Coordinate>>& sectorlines,
                                    types::SectorBorder& border) {
     std::list<types::Coordinate> borderEdges;
     bool resolved = true;
@@ -34,32 +36,31 @@ static __inline bool __createEdges(const std::vector<std::string>& borderDef,
         }
 
         /* insert the coordinates */
-        for (std::size_t c = 0; c < it->second.size() - 1; ++c) {
-            auto sit = it->second.cbegin();
-            std::advance(sit, c);
-            auto eit = it->second.cbegin();
-            std::advance(eit, c + 1);
+        const auto& coordinates = it->second;
+        for (std::size_t c = 0; c + 1 < coordinates.size(); ++c) {
+            const auto& start = coordinates[c];
+            const auto& end = coordinates[c + 1];
 
             if (0 == borderEdges.size()) {
-                borderEdges.push_back(*sit);
-                borderEdges.push_back(*eit);
+                borderEdges.push_back(start);
+                borderEdges.push_back(end);
             }
             else {
-                auto coord0It = std::find(borderEdges.cbegin(), borderEdges.cend(), *sit);
-                auto coord1It = std::find(borderEdges.cbegin(), borderEdges.cend(), *eit);
+                auto coord0It = std::find(borderEdges.cbegin(), borderEdges.cend(), start);
+                auto coord1It = std::find(borderEdges.cbegin(), borderEdges.cend(), end);
 
                 /* avoid duplicated points */
                 if (borderEdges.cend() != coord0It && borderEdges.cend() == coord1It) {
                     if (borderEdges.cbegin() == coord0It)
-                        borderEdges.insert(borderEdges.begin(), *eit);
+                        borderEdges.insert(borderEdges.begin(), end);
                     else
-                        borderEdges.push_back(*eit);
+                        borderEdges.push_back(end);
                 }
                 else if (borderEdges.cend() != coord1It && borderEdges.cend() == coord0It) {
                     if (borderEdges.cbegin() == coord1It)
-                        borderEdges.insert(borderEdges.begin(), *sit);
+                        borderEdges.insert(borderEdges.begin(), start);
                     else
-                        borderEdges.push_back(*sit);
+                        borderEdges.push_back(start);
                 }
             }
         }
@@ -70,13 +71,30 @@ static __inline bool __createEdges(const std::vector<std::string>& borderDef,
     return resolved;
 }
 
+static __inline void __parseSectorline(const std::string& lineIdx, std::vector<std::string_view>& longitudes,
+                                       std::vector<std::string_view>& latitudes,
+                                       std::map<std::string, std::vector<types::Coordinate>>& sectorlines) {
+    if (0 == longitudes.size())
+        return;
+
+    /* parse all collected coordinates of the sector line at once */
+    auto& coordinates = sectorlines[lineIdx];
+    auto offset = coordinates.size();
+    coordinates.resize(offset + longitudes.size());
+    types::Coordinate::parse(longitudes, latitudes, std::span<types::Coordinate>(coordinates).subspan(offset));
+
+    longitudes.clear();
+    latitudes.clear();
+}
+
 static __inline void __parseAirspace(const std::vector<std::string>& airspace,
                                      std::map<std::string, std::list<types::SectorBorder>>& borders) {
     std::vector<std::string> sectorDef, ownerDef, borderDef;
+    std::vector<std::string_view> elements, longitudes, latitudes;
     std::string lineIdx;
 
     std::list<std::pair<types::SectorBorder, std::vector<std::string>>> unresolved;
-    std::map<std::string, std::list<types::Coordinate>> sectorlines;
+    std::map<std::string, std::vector<types::Coordinate>> sectorlines;
 
     for (const auto& line : std::as_const(airspace)) {
         /* skip empty lines */
@@ -87,29 +105,38 @@ static __inline void __parseAirspace(const std::vector<std::string>& airspace,
         if (std::string::npos != line.find(';', 0))
             continue;
 
-        auto elements = helper::String::splitString(line, ":");
+        /* the views refer to the lines of the airspace block and stay valid until the function returns */
+        helper::String::splitView(line, ':', elements);
+
+        /* found a coordinate of a defined sector line */
+        if (0 != lineIdx.length() && "COORD" == elements[0]) {
+            if (3 <= elements.size()) {
+                longitudes.push_back(elements[2]);
+                latitudes.push_back(elements[1]);
+            }
+            continue;
+        }
+
+        /* the sector line is complete */
+        __parseSectorline(lineIdx, longitudes, latitudes, sectorlines);
 
         /* found a new sectorline */
         if ("SECTORLINE" == elements[0]) {
             lineIdx = elements[1];
         }
-        /* found a coordinate of a defined sector line */
-        else if (0 != lineIdx.length() && "COORD" == elements[0]) {
-            sectorlines[lineIdx].push_back(types::Coordinate(elements[2], elements[1]));
-        }
         /* found a new sector definition */
         else if ("SECTOR" == elements[0]) {
-            sectorDef = elements;
+            sectorDef.assign(elements.cbegin(), elements.cend());
             ownerDef.clear();
             borderDef.clear();
         }
         /* found the owners */
         else if ("OWNER" == elements[0]) {
-            ownerDef = elements;
+            ownerDef.assign(elements.cbegin(), elements.cend());
         }
         /* found the border */
         else if ("BORDER" == elements[0]) {
-            borderDef = elements;
+            borderDef.assign(elements.cbegin(), elements.cend());
         }
 
         /* found all information for a border */
@@ -189,23 +216,26 @@ void EseFileFormat::parseSectors(const std::vector<std::string>& positions, cons
 }
 
 void EseFileFormat::parseRunways(const std::vector<std::string>& runways) {
+    std::vector<std::string_view> split;
+
     for (const auto& line : std::as_const(runways)) {
         /* skip empty lines */
         if (0 == line.length())
             continue;
 
-        auto split = helper::String::splitString(line, " ");
+        helper::String::splitView(line, ' ', split);
         if (9 != split.size())
             continue;
 
         /* create the relevant information */
         types::Coordinate p0(split[5], split[4]), p1(split[7], split[6]);
-        types::Runway rwy0(std::move(split[0]), p0, p1);
-        types::Runway rwy1(std::move(split[1]), p1, p0);
+        types::Runway rwy0(std::string(split[0]), p0, p1);
+        types::Runway rwy1(std::string(split[1]), p1, p0);
 
         /* safe the runways */
-        this->m_runways[split[8]].push_back(std::move(rwy0));
-        this->m_runways[split[8]].push_back(std::move(rwy1));
+        auto& airportRunways = this->m_runways[std::string(split[8])];
+        airportRunways.push_back(std::move(rwy0));
+        airportRunways.push_back(std::move(rwy1));
     }
 }
 
@@ -251,6 +281,8 @@ void EseFileFormat::parserThread(const std::string& sectorFile) {
                     throw helper::Exception("SCT File", "Unable to find the runways in " + file.path().string());
                 this->parseRunways(runwaysIt->second);
 
+                this->m_sctFilename = std::filesystem::absolute(file.path()).lexically_normal().string();
+                this->m_eseFilename = std::filesystem::absolute(esePath).lexically_normal().string();
                 this->m_foundSectorFile = true;
             }
         }
@@ -263,7 +295,9 @@ EseFileFormat::EseFileFormat() :
         m_parserThreads(),
         m_pathsMutex(),
         m_paths(),
-        m_foundSectorFile(false) { }
+        m_foundSectorFile(false),
+        m_sctFilename(),
+        m_eseFilename() { }
 
 bool EseFileFormat::parse(const std::string& sectorName) {
     std::size_t threadCount = static_cast<std::size_t>(std::thread::hardware_concurrency());
@@ -307,3 +341,11 @@ const std::list<types::Runway>& EseFileFormat::runways(const std::string& airpor
     else
         return __fallback;
 }
+
+const std::string& EseFileFormat::sctFilename() const {
+    return this->m_sctFilename;
+}
+
+const std::string& EseFileFormat::eseFilename() const {
+    return this->m_eseFilename;
+}
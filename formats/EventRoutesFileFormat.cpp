@@ -96,6 +96,12 @@ bool EventRoutesFileFormat::parse(types::EventRoutesConfiguration& config) {
             destination.clear();
         }
         else if (3 == split.size() && "AIRPORTS" == split[0]) {
+            if (false == types::IcaoCode::fits(split[1]) || false == types::IcaoCode::fits(split[2])) {
+                this->m_errorMessage = "ICAO code of the origin or destination too long";
+                this->m_errorLine = lineOffset;
+                return false;
+            }
+
             origin = split[1];
             destination = split[2];
         }
@@ -124,8 +130,8 @@ bool EventRoutesFileFormat::parse(types::EventRoutesConfiguration& config) {
             }
 
             types::EventRoute route;
-            route.origin = origin;
-            route.destination = destination;
+            route.origin = types::IcaoCode(origin);
+            route.destination = types::IcaoCode(destination);
             route.route = split[1];
             route.minimumLevel = minLvl;
             route.maximumLevel = maxLvl;
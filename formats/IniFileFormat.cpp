@@ -31,17 +31,18 @@ IniFileFormat::IniFileFormat(const std::string& filename) :
     }
 
     std::string line;
-    std::string blockName;
+    std::vector<std::string>* block = nullptr;
     std::uint32_t lineOffset = 1;
     while (std::getline(stream, line)) {
         /* found the next block */
         if (0 == line.rfind("[", 0)) {
-            blockName = line;
-            this->m_blocks[blockName] = std::vector<std::string>();
-            this->m_lineOffsets[blockName] = lineOffset;
+            block = &this->m_blocks[line];
+            block->clear();
+            this->m_lineOffsets[line] = lineOffset;
         }
-        else if (0 != blockName.length()) {
-            this->m_blocks[blockName].push_back(line);
+        else if (nullptr != block) {
+            /* getline overwrites the moved-from line */
+            block->push_back(std::move(line));
         }
 
         lineOffset += 1;
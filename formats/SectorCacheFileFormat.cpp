@@ -0,0 +1,130 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the binary cache of the compiled sectors
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <fstream>
+
+#include <formats/SectorCacheFileFormat.h>
+#include <helper/Exception.h>
+#include <helper/Serialization.h>
+
+using namespace topskytower;
+using namespace topskytower::formats;
+
+static constexpr std::uint32_t __magic = 0x43545354;
+
+static __inline bool __readFile(const std::string& filename, std::vector<std::uint8_t>& data) {
+    std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+    if (false == stream.is_open())
+        return false;
+
+    auto size = static_cast<std::streamoff>(stream.tellg());
+    if (0 > size)
+        return false;
+
+    data.resize(static_cast<std::size_t>(size));
+    stream.seekg(0, std::ios::beg);
+    stream.read(reinterpret_cast<char*>(data.data()), size);
+
+    return size == stream.gcount();
+}
+
+static __inline std::uint64_t __hash(std::span<const std::uint8_t> data) {
+    /* FNV-1a is sufficient to detect modified files */
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+
+    for (const auto& byte : data) {
+        hash ^= byte;
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+SectorCacheFileFormat::SectorCacheFileFormat() :
+        m_data(),
+        m_payload() { }
+
+bool SectorCacheFileFormat::load(const std::string& filename, const std::string& sectorName, const std::string& airport) {
+    this->m_payload = std::span<const std::uint8_t>();
+
+    if (false == __readFile(filename, this->m_data))
+        return false;
+
+    try {
+        helper::BinaryReader reader(this->m_data);
+
+        if (__magic != reader.read<std::uint32_t>() || SectorCacheFileFormat::Version != reader.read<std::uint32_t>())
+            return false;
+        if (sectorName != reader.readString() || airport != reader.readString())
+            return false;
+
+        /* the cache is outdated as soon as one source file changed */
+        auto count = reader.read<std::uint32_t>();
+        std::vector<std::uint8_t> content;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            auto path = reader.readString();
+            auto size = reader.read<std::uint64_t>();
+            auto hash = reader.read<std::uint64_t>();
+
+            if (false == __readFile(path, content) || size != content.size() || hash != __hash(content))
+                return false;
+        }
+
+        auto size = reader.read<std::uint64_t>();
+        auto hash = reader.read<std::uint64_t>();
+        auto payload = reader.readBytes(static_cast<std::size_t>(size));
+        if (false == reader.finished() || hash != __hash(payload))
+            return false;
+
+        this->m_payload = payload;
+        return true;
+    }
+    catch (const helper::Exception&) {
+        /* a truncated cache is handled like an outdated cache */
+        return false;
+    }
+}
+
+std::span<const std::uint8_t> SectorCacheFileFormat::payload() const {
+    return this->m_payload;
+}
+
+bool SectorCacheFileFormat::store(const std::string& filename, const std::string& sectorName, const std::string& airport,
+                                  const std::vector<std::string>& sources, std::span<const std::uint8_t> payload) {
+    helper::BinaryWriter writer;
+
+    writer.write(__magic);
+    writer.write(SectorCacheFileFormat::Version);
+    writer.write(sectorName);
+    writer.write(airport);
+
+    writer.write(static_cast<std::uint32_t>(sources.size()));
+    std::vector<std::uint8_t> content;
+    for (const auto& source : std::as_const(sources)) {
+        if (false == __readFile(source, content))
+            return false;
+
+        writer.write(source);
+        writer.write(static_cast<std::uint64_t>(content.size()));
+        writer.write(__hash(content));
+    }
+
+    writer.write(static_cast<std::uint64_t>(payload.size()));
+    writer.write(__hash(payload));
+    writer.writeBytes(payload);
+
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    if (false == stream.is_open())
+        return false;
+    stream.write(reinterpret_cast<const char*>(writer.buffer().data()), static_cast<std::streamsize>(writer.buffer().size()));
+
+    return true == stream.good();
+}
@@ -159,6 +159,9 @@ bool SettingsFileFormat::parse(types::SystemConfiguration& config) {
         else if ("SYS_DistanceStandAssignment" == entry[0]) {
             config.standAssociationDistance = static_cast<float>(std::atoi(value.c_str())) * types::nauticmile;
         }
+        else if ("SYS_LocalProjectionRange" == entry[0]) {
+            config.localProjectionRange = static_cast<float>(std::atoi(value.c_str())) * types::nauticmile;
+        }
         else if ("SURV_ARIWS_Active" == entry[0]) {
             config.ariwsActive = '0' != value[0];
         }
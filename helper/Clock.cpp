@@ -0,0 +1,49 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the system clock and the simulated clock
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <helper/Clock.h>
+
+using namespace topskytower::helper;
+
+static std::atomic<const Clock*> __activeClock(nullptr);
+
+const Clock& Clock::instance() {
+    static SystemClock __systemClock;
+
+    auto clock = __activeClock.load(std::memory_order_acquire);
+    if (nullptr == clock)
+        return __systemClock;
+    return *clock;
+}
+
+void Clock::setInstance(const Clock* clock) {
+    __activeClock.store(clock, std::memory_order_release);
+}
+
+std::chrono::system_clock::time_point SystemClock::now() const {
+    return std::chrono::system_clock::now();
+}
+
+SimulatedClock::SimulatedClock(const std::chrono::system_clock::time_point& start) :
+        Clock(),
+        m_now(start.time_since_epoch().count()) { }
+
+std::chrono::system_clock::time_point SimulatedClock::now() const {
+    return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(this->m_now.load(std::memory_order_relaxed)));
+}
+
+void SimulatedClock::set(const std::chrono::system_clock::time_point& time) {
+    this->m_now.store(time.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+void SimulatedClock::advance(const std::chrono::system_clock::duration& duration) {
+    this->m_now.fetch_add(duration.count(), std::memory_order_relaxed);
+}
@@ -0,0 +1,90 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the allocation accounting of the performance counters
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <cstdlib>
+#include <new>
+
+#include <helper/PerformanceCounter.h>
+
+using namespace topskytower::helper;
+
+bool PerformanceCounter::allocationAccounting() {
+#ifdef ALLOCATION_ACCOUNTING
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef ALLOCATION_ACCOUNTING
+
+static __inline void __count(std::size_t size) {
+    PerformanceCounter::increment(PerformanceCounter::Type::Allocation);
+    PerformanceCounter::increment(PerformanceCounter::Type::AllocatedBytes, size);
+}
+
+static __inline void* __allocate(std::size_t size, std::size_t alignment) {
+    __count(size);
+
+    if (0 == size)
+        size = 1;
+
+    void* retval;
+    if (__STDCPP_DEFAULT_NEW_ALIGNMENT__ >= alignment) {
+        retval = std::malloc(size);
+    }
+    else {
+#ifdef _MSC_VER
+        retval = _aligned_malloc(size, alignment);
+#else
+        /* the size needs to be a multiple of the alignment */
+        retval = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+    }
+
+    if (nullptr == retval)
+        throw std::bad_alloc();
+    return retval;
+}
+
+static __inline void __release(void* ptr, std::size_t alignment) noexcept {
+#ifdef _MSC_VER
+    if (__STDCPP_DEFAULT_NEW_ALIGNMENT__ < alignment) {
+        _aligned_free(ptr);
+        return;
+    }
+#else
+    (void)alignment;
+#endif
+    std::free(ptr);
+}
+
+/*
+ * the standard library implements the array, sized and nothrow variants with these operators
+ * therefore all heap allocations of the C++ runtime are counted
+ */
+void* operator new(std::size_t size) {
+    return __allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return __allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+    __release(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+    __release(ptr, static_cast<std::size_t>(alignment));
+}
+
+#endif
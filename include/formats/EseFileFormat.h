@@ -38,6 +38,8 @@ namespace topskytower {
             std::mutex                                      m_pathsMutex;
             std::list<std::filesystem::directory_entry>     m_paths;
             volatile bool                                   m_foundSectorFile;
+            std::string                                     m_sctFilename;
+            std::string                                     m_eseFilename;
 
             void parseSectors(const std::vector<std::string>& positions, const std::vector<std::string>& airspace);
             void parseRunways(const std::vector<std::string>& runways);
@@ -71,6 +73,16 @@ namespace topskytower {
              * @return The runways of the airport
              */
             const std::list<types::Runway>& runways(const std::string& airport) const;
+            /**
+             * @brief Returns the path of the parsed SCT file
+             * @return The absolute path or an empty string if no file was parsed
+             */
+            const std::string& sctFilename() const;
+            /**
+             * @brief Returns the path of the parsed ESE file
+             * @return The absolute path or an empty string if no file was parsed
+             */
+            const std::string& eseFilename() const;
         };
     }
 }
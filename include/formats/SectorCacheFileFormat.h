@@ -0,0 +1,75 @@
+/*
+ * @brief Defines the binary cache of the compiled sectors
+ * @file formats/SectorCacheFileFormat.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#ifndef DOXYGEN_IGNORE
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace topskytower {
+    namespace formats {
+        /**
+         * @brief Defines the binary cache of the sector information of an airport
+         * @ingroup format
+         *
+         * The cache stores the serialized sector graph and the projected borders of an airport.
+         * It is keyed by the sector name, the airport and the content of the source files (SCT, ESE).
+         * A cache is only accepted if the version, the key, the source files and the payload's checksum match.
+         * Otherwise the caller needs to parse the source files and to store a new cache.
+         */
+        class SectorCacheFileFormat {
+        private:
+            std::vector<std::uint8_t>     m_data;
+            std::span<const std::uint8_t> m_payload;
+
+        public:
+            /**
+             * @brief The version of the cache layout
+             * It needs to be increased as soon as the serialization of a cached type changes.
+             */
+            static constexpr std::uint32_t Version = 2;
+
+            /**
+             * @brief Creates an empty cache
+             */
+            SectorCacheFileFormat();
+
+            /**
+             * @brief Loads a cache file with a single read
+             * @param[in] filename The cache file
+             * @param[in] sectorName The name of the sector file
+             * @param[in] airport The airport's ICAO code
+             * @return True if the cache exists and is up to date, else false
+             */
+            bool load(const std::string& filename, const std::string& sectorName, const std::string& airport);
+            /**
+             * @brief Returns the payload of the loaded cache
+             * The payload is valid as long as the cache exists and is not loaded again.
+             * @return The payload
+             */
+            std::span<const std::uint8_t> payload() const;
+            /**
+             * @brief Writes a new cache file
+             * @param[in] filename The cache file
+             * @param[in] sectorName The name of the sector file
+             * @param[in] airport The airport's ICAO code
+             * @param[in] sources The files that are used to create the payload
+             * @param[in] payload The serialized data
+             * @return True if the cache is written, else false
+             */
+            static bool store(const std::string& filename, const std::string& sectorName, const std::string& airport,
+                              const std::vector<std::string>& sources, std::span<const std::uint8_t> payload);
+        };
+    }
+}
+
+#endif
@@ -119,6 +119,11 @@ namespace topskytower {
          *     <td>10</td><td>NM</td>
          *   </tr>
          *   <tr>
+         *     <td>SYS_LocalProjectionRange</td>
+         *     <td>Defines the range around the center of the airport in which distances and bearings are approximated in a local plane. 0 deactivates the approximation.</td>
+         *     <td>10</td><td>NM</td>
+         *   </tr>
+         *   <tr>
          *     <td>SURV_RDF_Active</td>
          *     <td>Defines if RDF is active or not. Euroscope needs to be restarted, if this entry is changed</td>
          *     <td>1</td><td>Boolean</td>
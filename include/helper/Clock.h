@@ -0,0 +1,98 @@
+/*
+ * @brief Defines the clock that is used by all time dependent components
+ * @file helper/Clock.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace topskytower {
+    namespace helper {
+        /**
+         * @brief Defines the time source of all time dependent components
+         * @ingroup helper
+         *
+         * The components do not read the system clock directly, but the active clock instance.
+         * The default instance forwards the system clock and a simulation can install its own clock
+         * to replay recorded sessions faster than real time.
+         */
+        class Clock {
+        public:
+            /**
+             * @brief Destroys the clock
+             */
+            virtual ~Clock() { }
+
+            /**
+             * @brief Returns the current time of the clock
+             * @return The current time
+             */
+            virtual std::chrono::system_clock::time_point now() const = 0;
+
+            /**
+             * @brief Returns the active clock
+             * @return The active clock
+             */
+            static const Clock& instance();
+            /**
+             * @brief Installs a new active clock
+             * The caller keeps the ownership and has to reset the clock before it is destroyed.
+             * @param[in] clock The new clock or nullptr to use the system clock
+             */
+            static void setInstance(const Clock* clock);
+        };
+
+        /**
+         * @brief Defines the clock that forwards the system clock
+         * @ingroup helper
+         */
+        class SystemClock : public Clock {
+        public:
+            /**
+             * @brief Returns the current time of the system clock
+             * @return The current time
+             */
+            std::chrono::system_clock::time_point now() const override;
+        };
+
+        /**
+         * @brief Defines a clock that is controlled by the simulation
+         * @ingroup helper
+         *
+         * The time does not change until the simulation sets or advances it.
+         * It is safe to read the time while an other thread updates it.
+         */
+        class SimulatedClock : public Clock {
+        private:
+            std::atomic<std::chrono::system_clock::rep> m_now;
+
+        public:
+            /**
+             * @brief Creates a simulated clock
+             * @param[in] start The initial time of the clock
+             */
+            SimulatedClock(const std::chrono::system_clock::time_point& start);
+
+            /**
+             * @brief Returns the current time of the simulation
+             * @return The current time
+             */
+            std::chrono::system_clock::time_point now() const override;
+            /**
+             * @brief Sets the current time of the simulation
+             * @param[in] time The new time
+             */
+            void set(const std::chrono::system_clock::time_point& time);
+            /**
+             * @brief Advances the current time of the simulation
+             * @param[in] duration The elapsed time
+             */
+            void advance(const std::chrono::system_clock::duration& duration);
+        };
+    }
+}
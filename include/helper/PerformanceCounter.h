@@ -0,0 +1,79 @@
+/*
+ * @brief Defines and implements the thread local counters of expensive operations
+ * @file helper/PerformanceCounter.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace topskytower {
+    namespace helper {
+        /**
+         * @brief Counts expensive operations of the current thread
+         * @ingroup helper
+         *
+         * The counters are monotonic and thread local. Therefore no synchronization is needed to increment them.
+         * A consumer reads the counters before and after a measured function and uses the difference.
+         *
+         * The allocation counters are only updated if the project is built with the ALLOCATION_ACCOUNTING option.
+         * In that case the global allocation operators are replaced to count every heap allocation.
+         */
+        class PerformanceCounter {
+        public:
+            /**
+             * @brief Defines the counted operations
+             */
+            enum class Type {
+                GeodesicSolve  = 0, /**< A direct or inverse geodesic problem is solved */
+                PolygonTest    = 1, /**< A point-in-polygon test is performed */
+                Allocation     = 2, /**< A heap allocation is performed */
+                AllocatedBytes = 3, /**< The number of allocated bytes */
+                BorderQuery    = 4, /**< The spatial index of all sector borders is searched */
+                Count          = 5  /**< The number of counters */
+            };
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            static __inline std::array<std::uint64_t, static_cast<std::size_t>(Type::Count)>& counters() {
+                static thread_local std::array<std::uint64_t, static_cast<std::size_t>(Type::Count)> __counters = { 0, 0, 0, 0, 0 };
+                return __counters;
+            }
+
+        public:
+            PerformanceCounter() = delete;
+            PerformanceCounter(const PerformanceCounter& other) = delete;
+            PerformanceCounter(PerformanceCounter&& other) = delete;
+            PerformanceCounter& operator=(const PerformanceCounter& other) = delete;
+            PerformanceCounter& operator=(PerformanceCounter&& other) = delete;
+
+            /**
+             * @brief Increments a counter of the current thread
+             * @param[in] type The counter type
+             * @param[in] count The number of performed operations
+             */
+            static __inline void increment(Type type, std::uint64_t count = 1) {
+                PerformanceCounter::counters()[static_cast<std::size_t>(type)] += count;
+            }
+            /**
+             * @brief Returns the current value of a counter of the current thread
+             * @param[in] type The counter type
+             * @return The number of performed operations since the thread started
+             */
+            static __inline std::uint64_t value(Type type) {
+                return PerformanceCounter::counters()[static_cast<std::size_t>(type)];
+            }
+            /**
+             * @brief Checks if the heap allocations are counted
+             * @return True if the allocation counters are updated, else false
+             */
+            static bool allocationAccounting();
+#endif
+        };
+    }
+}
@@ -0,0 +1,154 @@
+/*
+ * @brief Defines and implements the binary serialization of values
+ * @file helper/Serialization.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <helper/Exception.h>
+
+namespace topskytower {
+    namespace helper {
+        /**
+         * @brief Writes values into a binary buffer
+         * @ingroup helper
+         *
+         * The values are stored in the byte order of the host.
+         * The buffers are only exchanged between sessions on the same system, e.g. as a cache.
+         */
+        class BinaryWriter {
+        private:
+            std::vector<std::uint8_t> m_buffer;
+
+        public:
+            /**
+             * @brief Creates an empty buffer
+             */
+            BinaryWriter() :
+                    m_buffer() { }
+
+            /**
+             * @brief Appends a trivially copyable value
+             * @param[in] value The value that needs to be stored
+             */
+            template <typename T>
+            void write(const T& value) {
+                static_assert(true == std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+
+                auto offset = this->m_buffer.size();
+                this->m_buffer.resize(offset + sizeof(T));
+                std::memcpy(this->m_buffer.data() + offset, &value, sizeof(T));
+            }
+            /**
+             * @brief Appends a string and its length
+             * @param[in] value The string that needs to be stored
+             */
+            void write(const std::string& value) {
+                this->write(static_cast<std::uint32_t>(value.length()));
+
+                auto offset = this->m_buffer.size();
+                this->m_buffer.resize(offset + value.length());
+                std::memcpy(this->m_buffer.data() + offset, value.data(), value.length());
+            }
+            /**
+             * @brief Appends raw bytes without a length
+             * @param[in] data The bytes that need to be stored
+             */
+            void writeBytes(std::span<const std::uint8_t> data) {
+                this->m_buffer.insert(this->m_buffer.end(), data.begin(), data.end());
+            }
+            /**
+             * @brief Returns the written data
+             * @return The buffer
+             */
+            const std::vector<std::uint8_t>& buffer() const {
+                return this->m_buffer;
+            }
+        };
+
+        /**
+         * @brief Reads values out of a binary buffer that is written by the BinaryWriter
+         * @ingroup helper
+         *
+         * The reader does not copy the buffer and the buffer needs to exist as long as the reader is used.
+         * Reads behind the end of the buffer throw an exception.
+         */
+        class BinaryReader {
+        private:
+            std::span<const std::uint8_t> m_data;
+            std::size_t                   m_offset;
+
+            void ensure(std::size_t size) const {
+                if (this->m_data.size() - this->m_offset < size)
+                    throw helper::Exception("BinaryReader", "Unexpected end of the data");
+            }
+
+        public:
+            /**
+             * @brief Creates a reader for a buffer
+             * @param[in] data The buffer
+             */
+            BinaryReader(std::span<const std::uint8_t> data) :
+                    m_data(data),
+                    m_offset(0) { }
+
+            /**
+             * @brief Reads a trivially copyable value
+             * @return The value
+             */
+            template <typename T>
+            T read() {
+                static_assert(true == std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read");
+
+                T value;
+                this->ensure(sizeof(T));
+                std::memcpy(&value, this->m_data.data() + this->m_offset, sizeof(T));
+                this->m_offset += sizeof(T);
+
+                return value;
+            }
+            /**
+             * @brief Reads a string with its length
+             * @return The string
+             */
+            std::string readString() {
+                auto length = this->read<std::uint32_t>();
+
+                this->ensure(length);
+                std::string value(reinterpret_cast<const char*>(this->m_data.data() + this->m_offset), length);
+                this->m_offset += length;
+
+                return value;
+            }
+            /**
+             * @brief Reads raw bytes without copying them
+             * @param[in] length The number of bytes
+             * @return The view on the bytes inside the buffer
+             */
+            std::span<const std::uint8_t> readBytes(std::size_t length) {
+                this->ensure(length);
+                auto bytes = this->m_data.subspan(this->m_offset, length);
+                this->m_offset += length;
+
+                return bytes;
+            }
+            /**
+             * @brief Checks if all data is read
+             * @return True if the end of the buffer is reached, else false
+             */
+            bool finished() const {
+                return this->m_data.size() == this->m_offset;
+            }
+        };
+    }
+}
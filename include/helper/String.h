@@ -9,6 +9,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace topskytower {
@@ -67,6 +68,25 @@ namespace topskytower {
                                                });
             }
 
+            /**
+             * @brief Splits value into views of the chunks without copying them
+             * The views refer to the memory of value and are only valid as long as value exists.
+             * @param[in] value The string which needs to be splitted up
+             * @param[in] separator The separator which splits up the value
+             * @param[out] chunks The views of the splitted chunks, the old content is replaced
+             */
+            static __inline void splitView(std::string_view value, char separator, std::vector<std::string_view>& chunks) {
+                std::string_view::size_type p = 0;
+                std::string_view::size_type q;
+
+                chunks.clear();
+                while ((q = value.find(separator, p)) != std::string_view::npos) {
+                    chunks.push_back(value.substr(p, q - p));
+                    p = q + 1;
+                }
+                chunks.push_back(value.substr(p));
+            }
+
             /**
              * @brief Removes leading and trailing whitespaces
              * @param[in] value The trimable string
@@ -14,6 +14,8 @@
 #include <string>
 #include <iomanip>
 
+#include <helper/Clock.h>
+
 namespace topskytower {
     namespace helper {
         /**
@@ -33,7 +35,7 @@ namespace topskytower {
              * @return The current UTC time
              */
             static __inline std::chrono::system_clock::time_point currentUtc() {
-                std::time_t now = std::time(0);
+                std::time_t now = std::chrono::system_clock::to_time_t(Clock::instance().now());
                 std::tm* nowTm = std::gmtime(&now);
                 return std::chrono::system_clock::from_time_t(std::mktime(nowTm));
             }
@@ -13,6 +13,8 @@
 
 #include <management/HoldingPointMap.h>
 #include <types/Aircraft.h>
+#include <types/Code.h>
+#include <types/FlightId.h>
 
 namespace topskytower {
     namespace management {
@@ -70,10 +72,10 @@ namespace topskytower {
                         flewDistance() { }
             };
 
-            std::string                                 m_airport;
-            HoldingPointMap<HoldingPointData>           m_holdingPoints;
-            std::map<std::string, DepartureInformation> m_departureReady;
-            std::map<std::string, DepartureInformation> m_departedPerRunway;
+            std::string                                       m_airport;
+            HoldingPointMap<HoldingPointData>                 m_holdingPoints;
+            types::FlightMap<DepartureInformation>            m_departureReady;
+            std::map<types::RunwayCode, DepartureInformation> m_departedPerRunway;
 
             void reinitialize(system::ConfigurationRegistry::UpdateType type);
 
@@ -81,9 +83,9 @@ namespace topskytower {
             /**
              * @brief Creates a departure sequence control instance
              * @param[in] airport The airport's ICAO code
-             * @param[in] center The reference point for the gnonomic transformation
+             * @param[in] projection The airport's projection context
              */
-            DepartureSequenceControl(const std::string& airport, const types::Coordinate& center);
+            DepartureSequenceControl(const std::string& airport, types::ProjectionContext* projection);
 
             /**
              * @brief Updates a flight and checks if it is one of the next departure candidates
@@ -93,9 +95,9 @@ namespace topskytower {
             void updateFlight(const types::Flight& flight, types::Flight::Type type);
             /**
              * @brief Removes the flight of this callsign
-             * @param[in] callsign The flight's callsign
+             * @param[in] id The flight's identifier
              */
-            void removeFlight(const std::string& callsign);
+            void removeFlight(types::FlightId id);
             /**
              * @brief Returns all flights that are ready for departure
              * @return All flights that are fully ready
@@ -12,12 +12,13 @@
 
 #include <vector>
 
-#include <GeographicLib/Gnomonic.hpp>
 #include <nanoflann.hpp>
 
 #include <system/ConfigurationRegistry.h>
 #include <types/AirportConfiguration.h>
 #include <types/Flight.h>
+#include <types/LocalTangentPlane.h>
+#include <types/ProjectionContext.h>
 
 namespace topskytower {
     namespace management {
@@ -66,12 +67,13 @@ namespace topskytower {
             typedef nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<float, HoldingPointTree>,
                                                         HoldingPointTree, 2> HoldingPointTreeAdaptor;
 
-            std::string              m_airportIcao;
-            types::Coordinate        m_centerPosition;
-            HoldingPointTree         m_normalHoldingPointTree;
-            HoldingPointTreeAdaptor* m_normalHoldingPointTreeAdaptor;
-            HoldingPointTree         m_lvpHoldingPointTree;
-            HoldingPointTreeAdaptor* m_lvpHoldingPointTreeAdaptor;
+            std::string               m_airportIcao;
+            types::ProjectionContext* m_projection;
+            types::LocalTangentPlane  m_localPlane;
+            HoldingPointTree          m_normalHoldingPointTree;
+            HoldingPointTreeAdaptor*  m_normalHoldingPointTreeAdaptor;
+            HoldingPointTree          m_lvpHoldingPointTree;
+            HoldingPointTreeAdaptor*  m_lvpHoldingPointTreeAdaptor;
 
             static void normalize(types::Angle& angle) {
                 while (-180.0 * types::degree > angle)
@@ -92,13 +94,8 @@ namespace topskytower {
                     return nullptr;
 
                 /* project to Cartesian coordinates */
-                GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
                 float queryPt[2];
-                projection.Forward(this->m_centerPosition.latitude().convert(types::degree),
-                                   this->m_centerPosition.longitude().convert(types::degree),
-                                   flight.currentPosition().coordinate().latitude().convert(types::degree),
-                                   flight.currentPosition().coordinate().longitude().convert(types::degree),
-                                   queryPt[0], queryPt[1]);
+                this->m_projection->forward(flight.currentPosition().coordinate(), queryPt);
 
                 std::size_t idx;
                 float distance;
@@ -121,7 +118,7 @@ namespace topskytower {
                         return nullptr;
 
                     /* check if the flight is close enough */
-                    auto hpDistance = retval->holdingPoint.distanceTo(flight.currentPosition().coordinate());
+                    auto hpDistance = this->m_localPlane.distance(retval->holdingPoint, flight.currentPosition().coordinate());
                     if (hpDistance > system::ConfigurationRegistry::instance().systemConfiguration().ariwsMaximumDistance)
                         return nullptr;
 
@@ -137,11 +134,12 @@ namespace topskytower {
             /**
              * @brief Initializes the holding point map
              * @param[in] airport The airport's ICAO code
-             * @param[in] center The airport's center position
+             * @param[in] projection The airport's projection context
              */
-            HoldingPointMap(const std::string& airport, const types::Coordinate& center) :
+            HoldingPointMap(const std::string& airport, types::ProjectionContext* projection) :
                     m_airportIcao(airport),
-                    m_centerPosition(center),
+                    m_projection(projection),
+                    m_localPlane(),
                     m_normalHoldingPointTree(),
                     m_normalHoldingPointTreeAdaptor(nullptr),
                     m_lvpHoldingPointTree(),
@@ -156,10 +154,19 @@ namespace topskytower {
                     delete this->m_lvpHoldingPointTreeAdaptor;
             }
 
+            /**
+             * @brief Updates the local plane around the center with the configured range
+             */
+            void updateLocalPlane() {
+                const auto& range = system::ConfigurationRegistry::instance().systemConfiguration().localProjectionRange;
+                this->m_localPlane = types::LocalTangentPlane(this->m_projection->center(), range);
+            }
             /**
              * @brief Reinitializes the holding point map with all internal structures
              */
             void reinitialize() {
+                this->updateLocalPlane();
+
                 /* delete all old information */
                 if (nullptr != this->m_normalHoldingPointTreeAdaptor)
                     delete this->m_normalHoldingPointTreeAdaptor;
@@ -175,16 +182,10 @@ namespace topskytower {
                 if (false == config.valid || 0 == config.aircraftStands.size())
                     return;
 
-                GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
                 for (const auto& holdingPoint : std::as_const(config.holdingPoints)) {
                     T data(holdingPoint);
 
-                    projection.Forward(this->m_centerPosition.latitude().convert(types::degree),
-                                       this->m_centerPosition.longitude().convert(types::degree),
-                                       data.holdingPoint.latitude().convert(types::degree),
-                                       data.holdingPoint.longitude().convert(types::degree),
-                                       data.cartesianPosition[0],
-                                       data.cartesianPosition[1]);
+                    this->m_projection->forward(data.holdingPoint, data.cartesianPosition);
 
                     if (true == data.lowVisibility)
                         this->m_lvpHoldingPointTree.holdingPoints.push_back(std::move(data));
@@ -218,12 +219,12 @@ namespace topskytower {
                     return false;
 
                 /* inside the deadband -> mark it as reached */
-                auto distance = flight.currentPosition().coordinate().distanceTo(node->holdingPoint);
+                auto distance = this->m_localPlane.distance(flight.currentPosition().coordinate(), node->holdingPoint);
                 if (distance <= deadbandWidth)
                     return true;
 
                 /* calculate the heading */
-                auto heading = flight.currentPosition().coordinate().bearingTo(node->holdingPoint) - node->heading;
+                auto heading = this->m_localPlane.bearing(flight.currentPosition().coordinate(), node->holdingPoint) - node->heading;
                 if (types::Flight::Type::Departure != type)
                     heading -= 180.0_deg;
                 HoldingPointMap<T>::normalize(heading);
@@ -247,12 +248,12 @@ namespace topskytower {
                     return false;
 
                 /* calculate the heading and compensate the offset */
-                auto heading = flight.currentPosition().coordinate().bearingTo(node->holdingPoint) - node->heading;
+                auto heading = this->m_localPlane.bearing(flight.currentPosition().coordinate(), node->holdingPoint) - node->heading;
                 if (types::Flight::Type::Departure == type)
                     heading -= 180.0 * types::degree;
                 HoldingPointMap<T>::normalize(heading);
 
-                auto distance = flight.currentPosition().coordinate().distanceTo(node->holdingPoint);
+                auto distance = this->m_localPlane.distance(flight.currentPosition().coordinate(), node->holdingPoint);
 
                 return heading.abs() <= threshold && distance > deadbandWidth;
             }
@@ -311,7 +312,7 @@ namespace topskytower {
 
                 for (std::size_t i = 0; i < holdingPoints->size(); ++i) {
                     if ((*holdingPoints)[i].name == name) {
-                        auto currentDist = (*holdingPoints)[i].holdingPoint.distanceTo(flight.currentPosition().coordinate());
+                        auto currentDist = this->m_localPlane.distance((*holdingPoints)[i].holdingPoint, flight.currentPosition().coordinate());
                         if (distance > currentDist) {
                             distance = currentDist;
                             index = i;
@@ -329,7 +330,14 @@ namespace topskytower {
              * @return The center of the map
              */
             const types::Coordinate& center() const {
-                return this->m_centerPosition;
+                return this->m_projection->center();
+            }
+            /**
+             * @brief Returns the local plane around the center of the map
+             * @return The local plane
+             */
+            const types::LocalTangentPlane& localPlane() const {
+                return this->m_localPlane;
             }
         };
     }
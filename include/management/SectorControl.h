@@ -11,8 +11,12 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
+#include <management/SectorGraph.h>
 #include <types/Flight.h>
+#include <types/FlightId.h>
 #include <types/Sector.h>
 
 namespace topskytower {
@@ -24,70 +28,69 @@ namespace topskytower {
         class SectorControl {
 #ifndef DOXYGEN_IGNORE
         private:
-            struct Node {
-                std::list<std::shared_ptr<Node>> parents;
-                types::Sector                    sector;
-                std::list<types::ControllerInfo> controllers;
-                std::list<std::shared_ptr<Node>> children;
-
-                Node(const types::Sector& sector) :
-                        parents(),
-                        sector(sector),
-                        controllers(),
-                        children() { }
-            };
+            typedef SectorGraph::Node Node;
 
             struct FlightData {
-                bool                                 manuallyChanged;
-                bool                                 handoffPerformed;
-                types::Flight                        flight;
-                std::shared_ptr<SectorControl::Node> nextSector;
-                std::string                          handoffReceivedBy;
+                bool        manuallyChanged;
+                bool        handoffPerformed;
+                const Node* nextSector;
 
                 FlightData() :
                         manuallyChanged(false),
                         handoffPerformed(false),
-                        flight(),
-                        nextSector(),
-                        handoffReceivedBy() { }
-                FlightData(const types::Flight& flight, const std::shared_ptr<SectorControl::Node>& node) :
+                        nextSector(nullptr) { }
+                FlightData(const Node* node) :
                         manuallyChanged(false),
                         handoffPerformed(false),
-                        flight(flight),
-                        nextSector(node),
-                        handoffReceivedBy() { }
+                        nextSector(node) { }
+            };
+
+            struct SectorQuery {
+                types::Position                           position;
+                std::vector<SectorGraph::IndexedBorder>   candidates;
+                std::vector<std::pair<const Node*, bool>> results;
+
+                SectorQuery() :
+                        position(),
+                        candidates(),
+                        results() { }
+
+                void reset(const types::Position& queryPosition) {
+                    this->position = queryPosition;
+                    this->candidates.clear();
+                    this->results.clear();
+                }
             };
 
-            static void insertNode(std::list<std::shared_ptr<Node>>& nodes, const types::Sector& sector);
-            static void destroyNode(std::shared_ptr<Node>& node);
-            static std::list<std::shared_ptr<Node>> findRelevantSectors(std::list<std::string>& deputies,
-                                                                        const std::list<types::Sector>& sectors);
-            static std::list<std::list<std::shared_ptr<Node>>> linkSiblings(std::list<std::shared_ptr<Node>>& nodes);
-            static void createGraph(std::list<std::list<std::shared_ptr<Node>>>& siblings);
-            static std::shared_ptr<Node> findNode(const std::shared_ptr<Node>& node, const types::ControllerInfo& info);
-            static std::shared_ptr<Node> findSectorInList(const std::list<std::shared_ptr<Node>>& nodes,
-                                                          const types::Position& position,
-                                                          types::Flight::Type type, bool lowerSectors);
-            std::shared_ptr<Node> findOnlineResponsible(const types::Flight& flight, types::Flight::Type type,
-                                                        const types::Position& position, bool ignoreClearanceFlag) const;
-            std::list<std::shared_ptr<Node>> findSectorCandidates(const std::shared_ptr<Node>& node) const;
-            static std::shared_ptr<SectorControl::Node> findLowestSector(const std::shared_ptr<Node>& node,
-                                                                         const types::Flight& flight,
-                                                                         const types::Position& position,
-                                                                         types::Flight::Type type,
-                                                                         bool ignoreClearanceFlag);
-            bool isInOwnSectors(const types::Flight& flight, const types::Position& position,
+            std::vector<types::ControllerInfo>& controllers(const Node* node);
+            const std::vector<types::ControllerInfo>& controllers(const Node* node) const;
+            void queryBorderIndex(SectorQuery& query, const Node* hint) const;
+            static bool isInsideSector(SectorQuery& query, const Node* node);
+            const Node* findOnlineResponsible(const types::Flight& flight, types::Flight::Type type,
+                                              SectorQuery& query, bool ignoreClearanceFlag) const;
+            const Node* findOnlineStation(const Node* node) const;
+            const Node* resolveOnlineStation(const Node* node) const;
+            const Node* findLowestSector(const Node* node, const types::Flight& flight, SectorQuery& query,
+                                         types::Flight::Type type, bool ignoreClearanceFlag) const;
+            bool isInOwnSectors(const types::Flight& flight, SectorQuery& query,
                                 types::Flight::Type type, bool ignoreClearanceFlag) const;
-            void cleanupHandoffList(std::shared_ptr<Node>& node);
-            std::list<types::ControllerInfo> findOnlineControllers(const std::shared_ptr<Node>& node) const;
+            void cleanupHandoffList(const Node* node);
+            bool remainsInsideBorders(const types::Flight& flight, const types::Length& distance, const types::Length& altitude);
 
-            std::shared_ptr<Node>                                       m_unicom;
-            std::shared_ptr<Node>                                       m_rootNode;
-            std::shared_ptr<Node>                                       m_ownSector;
-            std::map<std::string, types::ControllerInfo>                m_sectorAssociations;
-            std::map<std::string, FlightData>                           m_handoffs;
-            std::map<std::string, std::shared_ptr<SectorControl::Node>> m_sectorsOfFlights;
-            std::map<std::string, std::string>                          m_handoffOfFlightsToMe;
+            std::shared_ptr<const SectorGraph>                   m_graph;
+            Node                                                 m_unicom;
+            std::vector<std::vector<types::ControllerInfo>>      m_controllers;
+            const Node*                                          m_ownSector;
+            std::map<std::string, types::ControllerInfo>         m_sectorAssociations;
+            types::FlightMap<FlightData>                         m_handoffs;
+            types::FlightMap<const Node*>                        m_sectorsOfFlights;
+            types::FlightMap<std::string>                        m_handoffOfFlightsToMe;
+            types::FlightMap<SectorGraph::BorderClearance>       m_clearancesOfFlights;
+            mutable std::unordered_map<const Node*, const Node*> m_onlineStations;
+            mutable SectorQuery                                  m_currentQuery;
+            mutable SectorQuery                                  m_predictedQuery;
+            mutable std::vector<SectorGraph::IndexedBorder>      m_neighborBorders;
+            mutable std::vector<const Node*>                     m_responsibleCandidates;
 
         public:
             /**
@@ -100,11 +103,22 @@ namespace topskytower {
              * @param[in] sectors All sectors that need to be controlled
              */
             SectorControl(const std::string& airport, const std::list<types::Sector>& sectors);
+            /**
+             * @brief Initializes the controller manager with a shared sector graph
+             * @param[in] graph The sector graph of the controlled airport
+             */
+            SectorControl(const std::shared_ptr<const SectorGraph>& graph);
             /**
              * Destroys all internal structures
              */
             ~SectorControl();
 
+            SectorControl(const SectorControl& other) = delete;
+            SectorControl(SectorControl&& other) = delete;
+
+            SectorControl& operator=(const SectorControl& other) = delete;
+            SectorControl& operator=(SectorControl&& other) = delete;
+
             /**
              * @brief Updates the online state of a sector based on the information
              * @param[in] info The controller's information
@@ -133,9 +147,9 @@ namespace topskytower {
             void updateFlight(const types::Flight& flight, types::Flight::Type type);
             /**
              * @brief Removes a flight out of the sector control
-             * @param[in] callsign The deletable callsign
+             * @param[in] id The flight's identifier
              */
-            void removeFlight(const std::string& callsign);
+            void removeFlight(types::FlightId id);
             /**
              * @brief Checks if a specific flight is in the own sector
              * @param[in] flight The requested flight
@@ -0,0 +1,269 @@
+/*
+ * @brief Defines the immutable sector graph of an airport
+ * @file management/SectorGraph.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#pragma warning(push, 0)
+#include <boost/geometry/index/rtree.hpp>
+#pragma warning(pop)
+
+#include <types/Sector.h>
+
+namespace bgi = boost::geometry::index;
+
+namespace topskytower {
+    namespace management {
+        /**
+         * @brief Describes the sectors and borders that are relevant for an airport
+         * @ingroup management
+         *
+         * The graph contains the sectors from the top-level center down to the delivery of the airport
+         * and the spatial index of all borders. It is not modified after the construction.
+         * Therefore all sector controls of the same airport can share one graph and keep only the online
+         * controllers, the own sector and the handoffs.
+         *
+         * Most positions are close to the airport. A raster around the airport stores the relevant borders per cell.
+         * A lookup inside the raster does not need to search the index and tests only the borders that cross the cell.
+         */
+        class SectorGraph {
+#ifndef DOXYGEN_IGNORE
+        public:
+            typedef bg::model::point<float, 3, bg::cs::cartesian> IndexPoint;
+            typedef bg::model::box<IndexPoint>                    IndexBox;
+            typedef std::pair<IndexBox, std::size_t>              IndexEntry;
+
+            struct Node {
+                types::Sector           sector;
+                std::uint32_t           parentsBegin;
+                std::uint32_t           parentsEnd;
+                std::uint32_t           childrenBegin;
+                std::uint32_t           childrenEnd;
+                std::vector<IndexEntry> adjacentBorders;
+
+                Node(const types::Sector& sector) :
+                        sector(sector),
+                        parentsBegin(0),
+                        parentsEnd(0),
+                        childrenBegin(0),
+                        childrenEnd(0),
+                        adjacentBorders() { }
+            };
+
+            typedef std::pair<const Node*, const types::SectorBorder*> IndexedBorder;
+
+            struct RasterEntry {
+                IndexedBorder border;
+                bool          inside;
+            };
+
+            struct BorderClearance {
+                types::Coordinate center;
+                float             northScale;
+                float             eastScale;
+                types::Length     radius;
+                types::Length     lowerAltitude;
+                types::Length     upperAltitude;
+
+                BorderClearance() :
+                        center(),
+                        northScale(0.0f),
+                        eastScale(0.0f),
+                        radius(),
+                        lowerAltitude(),
+                        upperAltitude() { }
+            };
+
+        private:
+            struct GraphNode {
+                std::list<std::shared_ptr<GraphNode>> parents;
+                types::Sector                         sector;
+                std::list<std::shared_ptr<GraphNode>> children;
+
+                GraphNode(const types::Sector& sector) :
+                        parents(),
+                        sector(sector),
+                        children() { }
+            };
+
+            static void insertNode(std::list<std::shared_ptr<GraphNode>>& nodes, const types::Sector& sector);
+            static void destroyNode(std::shared_ptr<GraphNode>& node);
+            static std::list<std::shared_ptr<GraphNode>> findRelevantSectors(std::list<std::string>& deputies,
+                                                                             const std::list<types::Sector>& sectors);
+            static std::list<std::list<std::shared_ptr<GraphNode>>> linkSiblings(std::list<std::shared_ptr<GraphNode>>& nodes);
+            static void createGraph(std::list<std::list<std::shared_ptr<GraphNode>>>& siblings);
+            void flattenGraph(const std::shared_ptr<GraphNode>& root);
+            void buildIndexes();
+            void buildRaster();
+
+            std::vector<Node>                                         m_nodes;
+            std::vector<std::uint32_t>                                m_links;
+            std::unordered_map<std::string, const Node*>              m_nodesByIdentifier;
+            std::unordered_map<std::string, std::vector<const Node*>> m_nodesByFrequency;
+            std::vector<IndexedBorder>                                m_indexedBorders;
+            bgi::rtree<IndexEntry, bgi::quadratic<16>>                m_borderIndex;
+            float                                                     m_rasterOrigin[2];
+            float                                                     m_rasterStep[2];
+            std::size_t                                               m_rasterColumns;
+            std::size_t                                               m_rasterRows;
+            std::vector<std::uint32_t>                                m_rasterOffsets;
+            std::vector<RasterEntry>                                  m_rasterEntries;
+
+        public:
+            /**
+             * @brief Creates an empty graph
+             */
+            SectorGraph();
+            /**
+             * @brief Creates the graph of an airport
+             * @param[in] airport The ICAO code of the airport
+             * @param[in] sectors All sectors of the sector file
+             */
+            SectorGraph(const std::string& airport, const std::list<types::Sector>& sectors);
+            /**
+             * @brief Restores a serialized graph
+             * The graph and the projected borders are restored without any analysis of the sectors.
+             * @param[in] reader The reader that contains the serialized graph
+             */
+            SectorGraph(helper::BinaryReader& reader);
+
+            SectorGraph(const SectorGraph& other) = delete;
+            SectorGraph(SectorGraph&& other) = delete;
+
+            SectorGraph& operator=(const SectorGraph& other) = delete;
+            SectorGraph& operator=(SectorGraph&& other) = delete;
+
+            /**
+             * @brief Returns the graph of a key or creates it if no other user holds it
+             * All users of the same key share one graph. The graph is released as soon as the last user releases it.
+             * @param[in] key The key of the graph, e.g. the sector file and the airport
+             * @param[in] create The function that creates the graph if it does not exist
+             * @return The shared graph
+             */
+            static std::shared_ptr<const SectorGraph> shared(const std::string& key,
+                                                             const std::function<std::shared_ptr<const SectorGraph>()>& create);
+            /**
+             * @brief Returns the graph of a key without creating it
+             * @param[in] key The key of the graph
+             * @return The shared graph or nullptr if no user holds a graph of the key
+             */
+            static std::shared_ptr<const SectorGraph> find(const std::string& key);
+            /**
+             * @brief Returns all nodes of the graph
+             * The root node is the first node and the nodes keep their addresses as long as the graph exists.
+             * @return The nodes
+             */
+            const std::vector<Node>& nodes() const;
+            /**
+             * @brief Returns the root node of the graph
+             * @return The root node or nullptr if the graph is empty
+             */
+            const Node* root() const;
+            /**
+             * @brief Returns the index of a node
+             * @param[in] node The node of this graph
+             * @return The index inside the nodes
+             */
+            std::size_t index(const Node* node) const;
+            /**
+             * @brief Returns the indices of the parents of a node
+             * @param[in] node The node of this graph
+             * @return The parent indices
+             */
+            std::span<const std::uint32_t> parents(const Node* node) const;
+            /**
+             * @brief Returns the indices of the children of a node
+             * @param[in] node The node of this graph
+             * @return The child indices
+             */
+            std::span<const std::uint32_t> children(const Node* node) const;
+            /**
+             * @brief Finds the node of a sector identifier
+             * @param[in] identifier The sector's identifier
+             * @return The node or nullptr if the sector is not part of the graph
+             */
+            const Node* findNode(const std::string& identifier) const;
+            /**
+             * @brief Finds the node of a controller
+             * The identifier is used first. The frequency and the callsign are used as a fallback.
+             * @param[in] info The controller's information
+             * @return The node or nullptr if the controller does not belong to the graph
+             */
+            const Node* findNode(const types::ControllerInfo& info) const;
+            /**
+             * @brief Converts a position into a point of the border index
+             * @param[in] position The position
+             * @return The index point
+             */
+            static IndexPoint indexPoint(const types::Position& position);
+            /**
+             * @brief Collects all borders with a bounding box around the point
+             * @param[in] point The point
+             * @param[out] candidates The borders that need the exact test
+             */
+            void queryBorders(const IndexPoint& point, std::vector<IndexedBorder>& candidates) const;
+            /**
+             * @brief Collects the adjacent borders of a node with a bounding box around the point
+             * @param[in] point The point
+             * @param[in] node The node of this graph
+             * @param[out] candidates The borders that need the exact test
+             */
+            void queryAdjacentBorders(const IndexPoint& point, const Node* node, std::vector<IndexedBorder>& candidates) const;
+            /**
+             * @brief Returns the borders of the raster cell around a coordinate
+             * The raster covers the vicinity of the airport. Every cell contains the borders that cover the complete
+             * cell and the borders that need the exact test. The altitude restrictions are not checked.
+             * @param[in] coordinate The coordinate
+             * @param[out] entries The borders of the cell
+             * @return True if the coordinate is inside the raster, else false
+             */
+            bool queryRaster(const types::Coordinate& coordinate, std::span<const RasterEntry>& entries) const;
+            /**
+             * @brief Calculates the area around a position in which all positions are inside the same borders
+             * The area is a circle that keeps a distance to the edges of all borders around the position.
+             * The vertical limits are the closest border altitudes below and above the position.
+             * @param[in] position The center of the area
+             * @param[in] range The maximum radius of the area
+             * @return The clearance around the position
+             */
+            BorderClearance borderClearance(const types::Position& position, const types::Length& range) const;
+            /**
+             * @brief Checks if a position and its prediction are inside the clearance
+             * Both positions are inside the same borders as the center of the clearance if the function returns true.
+             * The offsets are calculated in the plane of the center without a geodesic solve.
+             * @param[in] clearance The clearance around a position
+             * @param[in] position The current position
+             * @param[in] distance The distance between the current position and the prediction along the heading
+             * @param[in] altitude The altitude of the prediction
+             * @return True if both positions are inside the clearance, else false
+             */
+            static bool isInsideClearance(const BorderClearance& clearance, const types::Position& position,
+                                          const types::Length& distance, const types::Length& altitude);
+            /**
+             * @brief Calculates the distance between the center of the clearance and a coordinate
+             * @param[in] clearance The clearance around a position
+             * @param[in] coordinate The coordinate
+             * @return The distance in the plane of the center
+             */
+            static types::Length distanceToCenter(const BorderClearance& clearance, const types::Coordinate& coordinate);
+            /**
+             * @brief Serializes the graph
+             * @param[out] writer The writer that receives the graph
+             */
+            void serialize(helper::BinaryWriter& writer) const;
+#endif
+        };
+    }
+}
@@ -16,6 +16,9 @@
 #include <system/ConfigurationRegistry.h>
 #include <types/AirportConfiguration.h>
 #include <types/Flight.h>
+#include <types/FlightId.h>
+#include <types/LocalTangentPlane.h>
+#include <types/ProjectionContext.h>
 
 namespace topskytower {
     namespace management {
@@ -73,8 +76,9 @@ namespace topskytower {
             std::string                                           m_airportIcao;
             StandTree                                             m_standTree;
             StandTreeAdaptor*                                     m_standTreeAdaptor;
-            std::map<std::string, std::string>                    m_aircraftStandRelation;
-            types::Coordinate                                     m_centerPosition;
+            types::FlightMap<std::string>                         m_aircraftStandRelation;
+            types::ProjectionContext*                             m_projection;
+            types::LocalTangentPlane                              m_localPlane;
             std::map<std::string, types::AirlineStandAssignments> m_standPriorities;
             types::Stand                                          m_gatPosition;
 
@@ -92,9 +96,9 @@ namespace topskytower {
             /**
              * @brief Creates a new stand control based on the current configuration
              * @param[in] airport The airport's ICAO code
-             * @param[in] center The airport's center
+             * @param[in] projection The airport's projection context
              */
-            StandControl(const std::string& airport, const types::Coordinate& center);
+            StandControl(const std::string& airport, types::ProjectionContext* projection);
             /**
              * @brief Deletes all internal structures
              */
@@ -108,9 +112,9 @@ namespace topskytower {
             void updateFlight(const types::Flight& flight, types::Flight::Type type);
             /**
              * @brief Removes a flight out of the list
-             * @param[in] callsign The deletable callsign
+             * @param[in] id The flight's identifier
              */
-            void removeFlight(const std::string& callsign);
+            void removeFlight(types::FlightId id);
             /**
              * @brief Assigns a stand manually to a flight
              * @param[in] flight The assignable flight
@@ -38,7 +38,7 @@ namespace topskytower {
 #ifndef DOXYGEN_IGNORE
             std::string                                               m_airportIcao;
             management::HoldingPointMap<management::HoldingPointData> m_holdingPoints;
-            std::list<std::string>                                    m_incursionWarnings;
+            std::list<types::FlightId>                                m_incursionWarnings;
             std::list<std::string>                                    m_inactiveRunways;
 
             void reinitialize(system::ConfigurationRegistry::UpdateType type);
@@ -48,9 +48,9 @@ namespace topskytower {
             /**
              * @brief Creates a ARIWS control instance
              * @param[in] airport The airport's ICAO code
-             * @param[in] center The airport's center position
+             * @param[in] projection The airport's projection context
              */
-            ARIWSControl(const std::string& airport, const types::Coordinate& center);
+            ARIWSControl(const std::string& airport, types::ProjectionContext* projection);
             /**
              * @brief Deletes all internal structures
              */
@@ -64,9 +64,9 @@ namespace topskytower {
             void updateFlight(const types::Flight& flight, types::Flight::Type type);
             /**
              * @brief Removes a flight out of the internal system
-             * @param[in] callsign The removable callsign
+             * @param[in] id The flight's identifier
              */
-            void removeFlight(const std::string& callsign);
+            void removeFlight(types::FlightId id);
             /**
              * @brief Checks if a flight is marked as runway incursion
              * @param[in] flight The requested flight
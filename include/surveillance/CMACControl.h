@@ -8,10 +8,9 @@
 
 #pragma once
 
-#include <map>
-
 #include <management/HoldingPointMap.h>
 #include <types/Flight.h>
+#include <types/FlightId.h>
 
 namespace topskytower {
     namespace surveillance {
@@ -49,7 +48,7 @@ namespace topskytower {
             };
 
             management::HoldingPointMap<management::HoldingPointData> m_holdingPoints;
-            std::map<std::string, FlightHistory>                      m_tracks;
+            types::FlightMap<FlightHistory>                           m_tracks;
 
             void reinitialize(system::ConfigurationRegistry::UpdateType type);
 
@@ -57,9 +56,9 @@ namespace topskytower {
             /**
              * @brief Creates a CMAC control instance
              * @param[in] airport The airport's ICAO code
-             * @param[in] center The airport's center position
+             * @param[in] projection The airport's projection context
              */
-            CMACControl(const std::string& airport, const types::Coordinate& center);
+            CMACControl(const std::string& airport, types::ProjectionContext* projection);
             /**
              * @brief Destroys all internal structures
              */
@@ -73,9 +72,9 @@ namespace topskytower {
             void updateFlight(const types::Flight& flight, types::Flight::Type type);
             /**
              * @brief Removes a flight out of the internal system
-             * @param[in] callsign The removable callsign
+             * @param[in] id The flight's identifier
              */
-            void removeFlight(const std::string& callsign);
+            void removeFlight(types::FlightId id);
             /**
              * @brief Checks if a flight is marked as CMA relevant
              * @param[in] flight The requested flight
@@ -20,6 +20,7 @@
 #pragma warning(pop)
 
 #include <types/Flight.h>
+#include <types/ProjectionContext.h>
 
 namespace bg = boost::geometry;
 
@@ -63,7 +64,7 @@ namespace topskytower {
             };
 
             types::Flight                                                        m_flight;
-            types::Coordinate                                                    m_reference;
+            types::ProjectionContext*                                            m_projection;
             TimePoint                                                            m_lastUpdate;
             Phase                                                                m_currentPhase;
             types::Velocity                                                      m_v2Speed;
@@ -72,6 +73,8 @@ namespace topskytower {
             types::Acceleration                                                  m_acceleration;
             types::Velocity                                                      m_cruiseSpeed;
             std::vector<Waypoint>                                                m_waypoints;
+            std::vector<types::Coordinate>                                       m_waypointCoordinates;
+            mutable std::vector<types::Length>                                   m_waypointDistances;
             bg::model::linestring<bg::model::point<float, 2, bg::cs::cartesian>> m_routeCartesian;
 
             Phase identifyPhase(const types::Length& altitude, const types::Velocity& speed,
@@ -81,8 +84,7 @@ namespace topskytower {
                                            types::Time& requiredTime) const;
             Waypoint predictWaypoint(const Waypoint& waypoint, const types::Coordinate& destination) const;
             void predictWaypoints(const std::vector<types::Coordinate>& waypoints);
-            static bool findSegment(const std::vector<Waypoint>& route, const types::Coordinate& point,
-                                    std::size_t& startIdx, std::size_t& endIdx);
+            bool findSegment(const types::Coordinate& point, std::size_t& startIdx, std::size_t& endIdx) const;
             static types::Length estimateHorizontalSpacing(const Waypoint& waypoint0, const Waypoint& waypoint1);
 
         public:
@@ -94,10 +96,10 @@ namespace topskytower {
             /**
              * @brief Creates a new departure model
              * @param[in] flight The trackable flight
-             * @param[in] reference The reference point for the projections
+             * @param[in] projection The airport's projection context
              * @param[in] waypoints The predicted route
              */
-            DepartureModel(const types::Flight& flight, const types::Coordinate& reference,
+            DepartureModel(const types::Flight& flight, types::ProjectionContext* projection,
                            const std::vector<types::Coordinate>& waypoints);
 
             /**
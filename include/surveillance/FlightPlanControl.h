@@ -8,12 +8,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
-#include <map>
 #include <string>
 
 #include <system/ConfigurationRegistry.h>
 #include <types/Flight.h>
+#include <types/FlightId.h>
 
 namespace topskytower {
     namespace surveillance {
@@ -77,13 +78,14 @@ namespace topskytower {
             struct FlightPlanStatus {
                 std::list<ErrorCode>    errorCodes;
                 bool                    overwritten;
-                std::string             destination;
+                types::IcaoCode         destination;
                 std::string             route;
                 std::string             departureRoute;
                 types::FlightPlan::Type type;
                 bool                    rnavCapable;
                 bool                    transponderAvailable;
                 types::Length           requestedFlightLevel;
+                std::uint64_t           version;
 
                 FlightPlanStatus() :
                         errorCodes(),
@@ -94,10 +96,11 @@ namespace topskytower {
                         type(types::FlightPlan::Type::Unknown),
                         rnavCapable(false),
                         transponderAvailable(false),
-                        requestedFlightLevel() { }
+                        requestedFlightLevel(),
+                        version(0) { }
             };
 
-            std::map<std::string, FlightPlanStatus> m_flightChecks;
+            types::FlightMap<FlightPlanStatus> m_flightChecks;
 
             FlightPlanControl();
 
@@ -120,26 +123,26 @@ namespace topskytower {
             bool validate(const types::Flight& flight);
             /**
              * @brief Removes a flight out of the list
-             * @param[in] callsign The flight's callsign
+             * @param[in] id The flight's identifier
              */
-            void removeFlight(const std::string& callsign);
+            void removeFlight(types::FlightId id);
             /**
              * @brief Marks an invalid flight plan as overwritten by the controller
-             * @param[in] callsign The flight's callsign
+             * @param[in] flight The flight
              */
-            void overwrite(const std::string& callsign);
+            void overwrite(const types::Flight& flight);
             /**
              * @brief Returns the error codes of a flight plan
-             * @param[in] callsign The flight's callsign
+             * @param[in] flight The flight
              * @return The error codes of the corresponding flight plan
              */
-            const std::list<ErrorCode>& errorCodes(const std::string& callsign) const;
+            const std::list<ErrorCode>& errorCodes(const types::Flight& flight) const;
             /**
              * @brief Returns if a check is overwritten or not
-             * @param[in] callsign The flight's callsign
+             * @param[in] flight The flight
              * @return True if the check is overwritten, else false
              */
-            bool overwritten(const std::string& callsign) const;
+            bool overwritten(const types::Flight& flight) const;
             /**
              * @brief Returns the static instance of the flight plan control
              * @return The flight plan control
@@ -13,6 +13,7 @@
 #include <management/DepartureSequenceControl.h>
 #include <surveillance/DepartureModel.h>
 #include <types/Flight.h>
+#include <types/FlightId.h>
 
 namespace topskytower {
     namespace surveillance {
@@ -71,22 +72,22 @@ namespace topskytower {
             typedef std::vector<types::Coordinate>(departureRoute)(const std::string&);
 
         private:
-            types::Coordinate                          m_center;
-            management::DepartureSequenceControl*      m_departureControl;
-            std::function<departureRoute>              m_sidExtractionCallback;
-            std::list<DepartureModel>                  m_departures;
-            std::map<std::string, std::list<Conflict>> m_conflicts;
+            types::ProjectionContext*             m_projection;
+            management::DepartureSequenceControl* m_departureControl;
+            std::function<departureRoute>         m_sidExtractionCallback;
+            std::list<DepartureModel>             m_departures;
+            types::FlightMap<std::list<Conflict>> m_conflicts;
 
             std::list<DepartureModel>::iterator insertFlight(const types::Flight& flight, types::Flight::Type type);
-            void removeConflict(const std::string& callsignModel, const std::string& callsignConflict);
+            void removeConflict(types::FlightId idModel, const std::string& callsignConflict);
 
         public:
             /**
              * @brief Creates a MTCD control instance
-             * @param[in] center The airport's center position
+             * @param[in] projection The airport's projection context
              * @param[in] departureControl The departure sequence control system
              */
-            MTCDControl(const types::Coordinate& center, management::DepartureSequenceControl* departureControl);
+            MTCDControl(types::ProjectionContext* projection, management::DepartureSequenceControl* departureControl);
 
             /**
              * @brief Updates a flight and calculates the MTCA metrices
@@ -96,9 +97,9 @@ namespace topskytower {
             void updateFlight(const types::Flight& flight, types::Flight::Type type);
             /**
              * @brief Removes a flight out of the internal system
-             * @param[in] callsign The removable callsign
+             * @param[in] id The flight's identifier
              */
-            void removeFlight(const std::string& callsign);
+            void removeFlight(types::FlightId id);
             /**
              * @brief Checks if a departure model exists
              * @param[in] flight The requested flight
@@ -9,11 +9,14 @@
 #pragma once
 
 #include <list>
-#include <map>
+#include <vector>
 
 #include <management/DepartureSequenceControl.h>
 #include <system/ConfigurationRegistry.h>
 #include <types/Flight.h>
+#include <types/FlightId.h>
+#include <types/KinematicTable.h>
+#include <types/LocalTangentPlane.h>
 #include <types/Runway.h>
 #include <types/SectorBorder.h>
 
@@ -78,15 +81,23 @@ namespace topskytower {
             std::string                           m_airportIcao;
             types::Length                         m_airportElevation;
             types::Coordinate                     m_reference;
+            types::LocalTangentPlane              m_localPlane;
             management::DepartureSequenceControl* m_departureControl;
             std::list<types::Runway>              m_runways;
             std::list<types::SectorBorder>        m_noTransgressionZones;
-            std::list<std::string>                m_ntzViolations;
-            std::list<types::Flight>              m_inbounds;
-            std::map<std::string, types::Length>  m_conflicts;
+            std::list<types::FlightId>            m_ntzViolations;
+            types::KinematicTable                 m_inbounds;
+            std::vector<types::RunwayCode>        m_inboundRunways;
+            std::vector<types::Aircraft::WTC>     m_inboundWtcs;
+            std::vector<types::Length>            m_inboundDistances;
+            types::FlightMap<types::Length>       m_conflicts;
 
             void reinitialize(system::ConfigurationRegistry::UpdateType type);
             void createNTZ(const std::pair<std::string, std::string>& runwayPair);
+            void updateInbound(const types::Flight& flight);
+            void removeInbound(types::FlightId id);
+            void calculateInboundDistances(const types::Flight& flight);
+            bool approachesRunway(const types::Flight& flight) const;
             void analyzeInbound(const types::Flight& flight);
             void analyzeOutbound(const types::Flight& flight);
 
@@ -114,9 +125,9 @@ namespace topskytower {
             void updateFlight(const types::Flight& flight, types::Flight::Type type);
             /**
              * @brief Removes the flight of this callsign
-             * @param[in] callsign The flight's callsign
+             * @param[in] id The flight's identifier
              */
-            void removeFlight(const std::string& callsign);
+            void removeFlight(types::FlightId id);
             /**
              * @brief Checks if the NTZ was violated
              * @param[in] flight The requested flight
@@ -14,6 +14,7 @@
 #include <formats/AircraftFileFormat.h>
 #include <formats/AirportFileFormat.h>
 #include <formats/EventRoutesFileFormat.h>
+#include <types/Code.h>
 #include <types/RuntimeConfiguration.h>
 #include <types/SystemConfiguration.h>
 
@@ -39,14 +40,15 @@ namespace topskytower {
             };
 
         private:
-            std::list<std::string>                             m_errorMessages;
-            std::mutex                                         m_configurationLock;
-            types::SystemConfiguration                         m_systemConfig;
-            types::RuntimeConfiguration                        m_runtimeConfig;
-            types::EventRoutesConfiguration                    m_eventsConfig;
-            std::map<std::string, types::AirportConfiguration> m_airportConfigurations;
-            formats::AircraftFileFormat                        m_aircraftConfiguration;
-            std::map<void*, std::function<void(UpdateType)>>   m_notificationCallbacks;
+            std::list<std::string>                                 m_errorMessages;
+            std::list<std::string>                                 m_warningMessages;
+            std::mutex                                             m_configurationLock;
+            types::SystemConfiguration                             m_systemConfig;
+            types::RuntimeConfiguration                            m_runtimeConfig;
+            types::EventRoutesConfiguration                        m_eventsConfig;
+            std::map<types::IcaoCode, types::AirportConfiguration> m_airportConfigurations;
+            formats::AircraftFileFormat                            m_aircraftConfiguration;
+            std::map<void*, std::function<void(UpdateType)>>       m_notificationCallbacks;
 
             ConfigurationRegistry();
             void cleanup(UpdateType type);
@@ -80,6 +82,12 @@ namespace topskytower {
              * @return The error messages including the lines and files
              */
             const std::list<std::string>& errorMessages() const;
+            /**
+             * @brief Returns all warning messages of configuration calls
+             * The warnings describe ignored files that do not prevent the configuration.
+             * @return The warning messages including the files
+             */
+            const std::list<std::string>& warningMessages() const;
             /**
              * @brief Returns the system configuration
              * @return The constant reference to the system configuration
@@ -107,6 +115,12 @@ namespace topskytower {
              * @return The airport configuration
              */
             const types::AirportConfiguration& airportConfiguration(const std::string& icao);
+            /**
+             * @brief Returns an airport configuration
+             * @param[in] icao The airport's packed ICAO code
+             * @return The airport configuration
+             */
+            const types::AirportConfiguration& airportConfiguration(const types::IcaoCode& icao);
             /**
              * @brief Returns the parsed aircrafts
              * @return A map of aircrafts
@@ -8,19 +8,73 @@
 
 #pragma once
 
-#include <map>
+#include <memory>
+#include <mutex>
 
 #include <types/Flight.h>
+#include <types/FlightId.h>
 
 namespace topskytower {
     namespace system {
         /**
          * @brief Describes a flight registry that contains all visible flights
          * @ingroup system
+         *
+         * The registry is updated by a single writer, the EuroScope thread, and the writer's functions are not synchronized.
+         * Other threads use snapshots of the registry. The writer publishes a snapshot with an increasing epoch and a snapshot
+         * is never changed afterwards. Unchanged flights are shared between the snapshots.
+         * A reader keeps a consistent view as long as it holds the snapshot and does not block the writer.
          */
         class FlightRegistry {
+        public:
+            /**
+             * @brief Describes an immutable view on the registry
+             */
+            class Snapshot {
+#ifndef DOXYGEN_IGNORE
+                friend class FlightRegistry;
+
+            private:
+                std::uint64_t                                          m_epoch;
+                types::FlightMap<std::shared_ptr<const types::Flight>> m_flights;
+
+            public:
+                /**
+                 * @brief Creates an empty snapshot
+                 */
+                Snapshot();
+
+                /**
+                 * @brief Returns the epoch of the snapshot
+                 * @return The epoch that is increased with every published snapshot
+                 */
+                std::uint64_t epoch() const;
+                /**
+                 * @brief Checks if a flight for a specific callsign exists
+                 * @param[in] callsign The requested callsign
+                 * @return True if the flight exists, else false
+                 */
+                bool flightExists(const std::string& callsign) const;
+                /**
+                 * @brief Returns a specific flight
+                 * @param[in] callsign The requested callsign
+                 * @return The constant reference to the flight that is valid as long as the snapshot exists
+                 */
+                const types::Flight& flight(const std::string& callsign) const;
+                /**
+                 * @brief Returns all flights of the snapshot
+                 * @return The flights
+                 */
+                const types::FlightMap<std::shared_ptr<const types::Flight>>& flights() const;
+#endif
+            };
+
         private:
-            std::map<std::string, std::pair<types::Flight, types::FlightPlan::AtcCommand>> m_flights;
+            types::FlightMap<std::pair<types::Flight, types::FlightPlan::AtcCommand>> m_flights;
+            types::FlightMap<bool>                                                    m_changedFlights;
+            bool                                                                      m_removedFlights;
+            mutable std::mutex                                                        m_snapshotLock;
+            std::shared_ptr<const Snapshot>                                           m_snapshot;
 
             FlightRegistry();
 
@@ -41,24 +95,53 @@ namespace topskytower {
              * @param[in] callsign The flight's callsign
              */
             void removeFlight(const std::string& callsign);
+            /**
+             * @brief Removes a flight out of the registry
+             * @param[in] id The flight's identifier
+             */
+            void removeFlight(types::FlightId id);
             /**
              * @brief Checks if a flight for a specific callsign exists
              * @param[in] callsign The requested callsign
              * @return True if the flight exists, else false
              */
             bool flightExists(const std::string& callsign) const;
+            /**
+             * @brief Checks if a flight for a specific identifier exists
+             * @param[in] id The requested flight's identifier
+             * @return True if the flight exists, else false
+             */
+            bool flightExists(types::FlightId id) const;
             /**
              * @brief Returns a specific flight
              * @param[in] callsign The requested callsign
              * @return The constant reference to the flight
              */
             const types::Flight& flight(const std::string& callsign) const;
+            /**
+             * @brief Returns a specific flight
+             * @param[in] id The requested flight's identifier
+             * @return The constant reference to the flight
+             */
+            const types::Flight& flight(types::FlightId id) const;
             /**
              * @brief Overwrites the ATC clearance flag for a specific flight
              * @param[in] flight The updated flight
              * @param[in] flag The new clearance flag for departure and arrival
              */
             void setAtcClearanceFlag(const types::Flight& flight, std::uint16_t flag);
+            /**
+             * @brief Publishes the current flights as a new snapshot
+             * Only the writer publishes the snapshots, e.g. once per timer event.
+             * The function does not publish a new snapshot if no flight changed since the last snapshot.
+             */
+            void publish();
+            /**
+             * @brief Returns the last published snapshot
+             * The function can be called by any thread.
+             * @return The snapshot
+             */
+            std::shared_ptr<const Snapshot> snapshot() const;
             /**
              * @brief Returns the flight registry instance
              * @return The registry
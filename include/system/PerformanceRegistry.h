@@ -0,0 +1,182 @@
+/*
+ * @brief Defines a registry that collects the runtime statistics of the controls
+ * @file system/PerformanceRegistry.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace topskytower {
+    namespace system {
+        /**
+         * @brief Collects the runtime statistics of the flight updates of all controls
+         * @ingroup system
+         *
+         * Every measured call is written into a ring buffer of the calling thread and into cumulative counters.
+         * The writing thread does not lock anything. The snapshot reads all buffers and skips entries that were
+         * overwritten while they were copied.
+         */
+        class PerformanceRegistry {
+        public:
+            /**
+             * @brief Defines the measured components
+             */
+            enum class Component : std::uint8_t {
+                SectorControl            = 0, /**< The sector control */
+                StandControl             = 1, /**< The stand control */
+                DepartureSequenceControl = 2, /**< The departure sequence control */
+                MTCDControl              = 3, /**< The medium term conflict detection */
+                STCDControl              = 4, /**< The short term conflict detection */
+                ARIWSControl             = 5, /**< The runway incursion warning system */
+                CMACControl              = 6, /**< The conformance monitoring */
+                FlightRegistry           = 7, /**< The flight registry */
+                Count                    = 8  /**< The number of components */
+            };
+
+            /**
+             * @brief Defines a single measured call
+             */
+            struct Sample {
+                Component                component;      /**< The measured component */
+                std::chrono::nanoseconds duration;       /**< The wall time of the call */
+                std::uint64_t            geodesicSolves; /**< The number of solved geodesic problems */
+                std::uint64_t            polygonTests;   /**< The number of point-in-polygon tests */
+                std::uint64_t            allocations;    /**< The number of heap allocations */
+                std::uint64_t            allocatedBytes; /**< The number of allocated bytes */
+            };
+
+            /**
+             * @brief Defines the cumulative statistics of a component
+             */
+            struct Statistics {
+                std::uint64_t            calls;          /**< The number of calls */
+                std::chrono::nanoseconds duration;       /**< The wall time of all calls */
+                std::chrono::nanoseconds maxDuration;    /**< The wall time of the slowest call */
+                std::uint64_t            geodesicSolves; /**< The number of solved geodesic problems */
+                std::uint64_t            polygonTests;   /**< The number of point-in-polygon tests */
+                std::uint64_t            allocations;    /**< The number of heap allocations */
+                std::uint64_t            allocatedBytes; /**< The number of allocated bytes */
+            };
+
+            /**
+             * @brief Defines a consistent copy of the collected data
+             */
+            struct Snapshot {
+                std::array<Statistics, static_cast<std::size_t>(Component::Count)> statistics;           /**< The cumulative statistics per component */
+                std::vector<Sample>                                                samples;              /**< The most recent calls of all threads */
+                bool                                                               allocationAccounting; /**< Marks if the allocations are counted */
+            };
+
+            /**
+             * @brief Measures a call from the construction to the destruction
+             *
+             * The measurement includes nested measurements of other components.
+             */
+            class Measurement {
+#ifndef DOXYGEN_IGNORE
+            private:
+                Component                             m_component;
+                std::chrono::steady_clock::time_point m_start;
+                std::uint64_t                         m_geodesicSolves;
+                std::uint64_t                         m_polygonTests;
+                std::uint64_t                         m_allocations;
+                std::uint64_t                         m_allocatedBytes;
+
+            public:
+                Measurement(const Measurement& other) = delete;
+                Measurement(Measurement&& other) = delete;
+                Measurement& operator=(const Measurement& other) = delete;
+                Measurement& operator=(Measurement&& other) = delete;
+
+                /**
+                 * @brief Starts the measurement
+                 * @param[in] component The measured component
+                 */
+                Measurement(Component component);
+                /**
+                 * @brief Stops the measurement and stores the sample
+                 */
+                ~Measurement();
+#endif
+            };
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            static const std::size_t BufferSize = 1024;
+
+            struct Entry {
+                std::atomic<std::uint64_t> component;
+                std::atomic<std::int64_t>  duration;
+                std::atomic<std::uint64_t> geodesicSolves;
+                std::atomic<std::uint64_t> polygonTests;
+                std::atomic<std::uint64_t> allocations;
+                std::atomic<std::uint64_t> allocatedBytes;
+            };
+
+            struct Counters {
+                std::atomic<std::uint64_t> calls;
+                std::atomic<std::int64_t>  duration;
+                std::atomic<std::int64_t>  maxDuration;
+                std::atomic<std::uint64_t> geodesicSolves;
+                std::atomic<std::uint64_t> polygonTests;
+                std::atomic<std::uint64_t> allocations;
+                std::atomic<std::uint64_t> allocatedBytes;
+            };
+
+            struct RingBuffer {
+                std::array<Entry, BufferSize>                                    entries;
+                std::atomic<std::uint64_t>                                       head;
+                std::array<Counters, static_cast<std::size_t>(Component::Count)> counters;
+
+                RingBuffer();
+            };
+
+            mutable std::mutex                     m_buffersLock;
+            std::list<std::unique_ptr<RingBuffer>> m_buffers;
+
+            PerformanceRegistry();
+
+            RingBuffer& threadBuffer();
+            void record(const Sample& sample);
+
+        public:
+            PerformanceRegistry(const PerformanceRegistry& other) = delete;
+            PerformanceRegistry(PerformanceRegistry&& other) = delete;
+
+            PerformanceRegistry& operator=(const PerformanceRegistry& other) = delete;
+            PerformanceRegistry& operator=(PerformanceRegistry&& other) = delete;
+
+            /**
+             * @brief Returns the collected data of all threads
+             *
+             * The cumulative statistics start with the start of the system.
+             * Two snapshots need to be compared to get the statistics of a time window.
+             * @return The snapshot
+             */
+            Snapshot snapshot() const;
+            /**
+             * @brief Returns the name of a component
+             * @param[in] component The component
+             * @return The name
+             */
+            static const char* componentName(Component component);
+            /**
+             * @brief Returns the performance registry instance
+             * @return The registry
+             */
+            static PerformanceRegistry& instance();
+#endif
+        };
+    }
+}
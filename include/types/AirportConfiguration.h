@@ -14,6 +14,7 @@
 #include <vector>
 
 #include <types/Aircraft.h>
+#include <types/Code.h>
 #include <types/Coordinate.h>
 #include <types/Quantity.hpp>
 
@@ -48,7 +49,7 @@ namespace topskytower {
          * @brief Defines constraints for specific destinations
          */
         struct DestinationConstraint {
-            std::string   destination;        /**< The destination's ICAO */
+            IcaoCode      destination;        /**< The destination's ICAO */
             bool          evenCruiseLevel;    /**< Marks if an even flight level is required */
             types::Length minimumCruiseLevel; /**< Defines the minimum flight level */
             types::Length maximumCruiseLevel; /**< Defines the maximum flight level */
@@ -123,7 +124,7 @@ namespace topskytower {
          */
         struct HoldingPoint {
             std::string          name;            /**< Defines the holding point's name */
-            std::string          runway;          /**< Defines the active runway for this holding point */
+            RunwayCode           runway;          /**< Defines the active runway for this holding point */
             bool                 lowVisibility;   /**< Defines if the holding point is used during low visibility */
             types::Aircraft::WTC maxDepartureWtc; /**< Defines the maximum WTC for departures of this holding point*/
             types::Coordinate    holdingPoint;    /**< Defines the center position of the holding point */
@@ -149,9 +150,9 @@ namespace topskytower {
             std::list<Stand>                                   aircraftStands;         /**< The list of all available aircraft stands */
             std::list<AirlineStandAssignments>                 airlines;               /**< The airline to stand assignments */
             std::list<HoldingPoint>                            holdingPoints;          /**< The holding points of the airport */
-            std::map<std::string, std::list<std::string>>      ipaRunways;             /**< Defines the possible IPA combinations */
-            std::map<std::string, std::list<std::string>>      prmRunways;             /**< Defines the possible PRM combinations */
-            std::map<std::string, std::list<std::string>>      ipdRunways;             /**< Defines the possible IPD combinations */
+            std::map<RunwayCode, std::list<RunwayCode>>        ipaRunways;             /**< Defines the possible IPA combinations */
+            std::map<RunwayCode, std::list<RunwayCode>>        prmRunways;             /**< Defines the possible PRM combinations */
+            std::map<RunwayCode, std::list<RunwayCode>>        ipdRunways;             /**< Defines the possible IPD combinations */
 
             /**
              * @brief Creates an empty and unintialized airport configuration
@@ -0,0 +1,154 @@
+/*
+ * @brief Defines the fixed-width codes of airports and runways
+ * @file types/Code.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace topskytower {
+    namespace types {
+        /**
+         * @brief Describes a short code that is packed into an integer
+         * @ingroup types
+         *
+         * The characters are stored inline with the first character in the most significant byte.
+         * Therefore the comparison and the hash of two codes is an integer operation and the order of the codes is the
+         * lexicographic order of the strings. A string that is longer than the code's width is not a valid code and
+         * results in an empty code. Therefore the parsers validate the strings with fits() before they create a code.
+         *
+         * @tparam N The maximum number of characters
+         */
+        template <std::size_t N>
+        class Code {
+            static_assert(0 < N && 8 >= N, "A code is packed into at most 64 bits");
+
+        public:
+            /**
+             * @brief Defines the integer that stores the characters
+             */
+            typedef std::conditional_t<4 >= N, std::uint32_t, std::uint64_t> Storage;
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            static constexpr std::size_t Bits = sizeof(Storage) * 8;
+
+            Storage m_value;
+
+        public:
+            /**
+             * @brief Creates an empty code
+             */
+            constexpr Code() :
+                    m_value(0) { }
+            /**
+             * @brief Creates a code out of a string
+             * @param[in] code The string that contains at most N characters
+             */
+            explicit constexpr Code(std::string_view code) :
+                    m_value(0) {
+                if (N < code.length())
+                    return;
+
+                for (std::size_t i = 0; i < code.length(); ++i)
+                    this->m_value |= static_cast<Storage>(static_cast<std::uint8_t>(code[i])) << (Bits - 8 * (i + 1));
+            }
+
+            /**
+             * @brief Checks if a string fits into the code
+             * @param[in] code The string
+             * @return True if the string contains at most N characters, else false
+             */
+            static constexpr bool fits(std::string_view code) {
+                return N >= code.length();
+            }
+            /**
+             * @brief Returns the packed characters
+             * @return The integer representation
+             */
+            constexpr Storage value() const {
+                return this->m_value;
+            }
+            /**
+             * @brief Returns the number of characters
+             * @return The length of the code
+             */
+            constexpr std::size_t length() const {
+                std::size_t retval = 0;
+                while (N > retval && 0 != ((this->m_value >> (Bits - 8 * (retval + 1))) & 0xff))
+                    retval += 1;
+                return retval;
+            }
+            /**
+             * @brief Converts the code into a string
+             * The string fits into the small string buffer and does not allocate memory.
+             * @return The string representation
+             */
+            std::string str() const {
+                std::string retval;
+                auto length = this->length();
+
+                retval.reserve(length);
+                for (std::size_t i = 0; i < length; ++i)
+                    retval.push_back(static_cast<char>((this->m_value >> (Bits - 8 * (i + 1))) & 0xff));
+
+                return retval;
+            }
+            /**
+             * @brief Compares two codes
+             * @param[in] other The other code
+             * @return True if both codes are equal, else false
+             */
+            constexpr bool operator==(const Code& other) const {
+                return this->m_value == other.m_value;
+            }
+            /**
+             * @brief Compares the code with a string
+             * @param[in] other The string
+             * @return True if the string contains the same characters, else false
+             */
+            constexpr bool operator==(std::string_view other) const {
+                return N >= other.length() && this->m_value == Code(other).m_value;
+            }
+            /**
+             * @brief Orders two codes lexicographically
+             * @param[in] other The other code
+             * @return The order of both codes
+             */
+            constexpr std::strong_ordering operator<=>(const Code& other) const {
+                return this->m_value <=> other.m_value;
+            }
+#endif
+        };
+
+        /**
+         * @brief Defines the four letter ICAO code of an airport
+         */
+        typedef Code<4> IcaoCode;
+        /**
+         * @brief Defines the identifier of a runway, e.g. 25C
+         */
+        typedef Code<3> RunwayCode;
+    }
+}
+
+namespace std {
+    /**
+     * @brief Hashes a code by its packed characters
+     */
+    template <std::size_t N>
+    struct hash<topskytower::types::Code<N>> {
+        std::size_t operator()(const topskytower::types::Code<N>& code) const {
+            return std::hash<typename topskytower::types::Code<N>::Storage>()(code.value());
+        }
+    };
+}
@@ -55,6 +55,11 @@ namespace topskytower {
             ControllerInfo(const std::string& identifier, const std::string& prefix, const std::string& midfix,
                            const std::string& suffix, const std::string& primaryFrequency, const std::string& fullName,
                            const std::string& latitude, const std::string& longitude);
+            /**
+             * @brief Creates a controller information out of a serialized controller information
+             * @param[in] reader The reader that contains the serialized controller information
+             */
+            ControllerInfo(helper::BinaryReader& reader);
 
             /**
              * @brief Compares this controller with an other instance
@@ -109,6 +114,11 @@ namespace topskytower {
              * @return The sector's center point
              */
             const types::Coordinate& centerPoint() const;
+            /**
+             * @brief Serializes the controller information
+             * @param[out] writer The writer that receives the controller information
+             */
+            void serialize(helper::BinaryWriter& writer) const;
         };
     }
 }
@@ -8,8 +8,10 @@
 
 #pragma once
 
-#include <string>
+#include <span>
+#include <string_view>
 
+#include <helper/Serialization.h>
 #include <types/Quantity.hpp>
 
 namespace topskytower {
@@ -39,10 +41,27 @@ namespace topskytower {
              * The format of the coordinate component needs to be the followin:
              * - Longitude: [N,S]DEGREE.MINUTES.SECONDS.FRACTION
              * - Latitude: [E,W]DEGREE.MINUTES.SECONDS.FRACTION
+             * The components are parsed without any temporary allocation.
              * @param[in] longitude The initial longitudinal value
              * @param[in] latitude The initial latitudinal value
              */
-            Coordinate(const std::string& longitude, const std::string& latitude);
+            Coordinate(std::string_view longitude, std::string_view latitude);
+            /**
+             * @brief Creates a coordinate out of a serialized coordinate
+             * @param[in] reader The reader that contains the serialized coordinate
+             */
+            Coordinate(helper::BinaryReader& reader);
+
+            /**
+             * @brief Parses many coordinates of the sector file format
+             * The format of the components is the same as the one of the string constructor.
+             * The coordinates need to provide at least as many elements as the components.
+             * @param[in] longitudes The longitudinal components
+             * @param[in] latitudes The latitudinal components
+             * @param[out] coordinates The parsed coordinates
+             */
+            static void parse(std::span<const std::string_view> longitudes, std::span<const std::string_view> latitudes,
+                              std::span<Coordinate> coordinates);
 
             /**
              * @brief Checks if two positions are equal
@@ -91,12 +110,33 @@ namespace topskytower {
              * @return The great circle distance between this coordinate and the other
              */
             Length distanceTo(const Coordinate& other) const;
+            /**
+             * @brief Calculates the great circle distances between this coordinate and other coordinates
+             * The distances need to provide at least as many elements as the other coordinates.
+             * @param[in] others The other coordinates
+             * @param[out] distances The great circle distances between this coordinate and the other coordinates
+             * @throw helper::Exception if the distances provide less elements than the other coordinates
+             */
+            void distancesTo(std::span<const Coordinate> others, std::span<Length> distances) const;
             /**
              * @brief Calculates the bearing between this coordinate and the other
              * @param[in] other The other coordinate
              * @return The bearing between this coordinate and the other
              */
             Angle bearingTo(const Coordinate& other) const;
+            /**
+             * @brief Calculates the bearings between this coordinate and other coordinates
+             * The bearings need to provide at least as many elements as the other coordinates.
+             * @param[in] others The other coordinates
+             * @param[out] bearings The bearings between this coordinate and the other coordinates
+             * @throw helper::Exception if the bearings provide less elements than the other coordinates
+             */
+            void bearingsTo(std::span<const Coordinate> others, std::span<Angle> bearings) const;
+            /**
+             * @brief Serializes the coordinate
+             * @param[out] writer The writer that receives the coordinate
+             */
+            void serialize(helper::BinaryWriter& writer) const;
         };
     }
 }
@@ -11,6 +11,7 @@
 #include <list>
 #include <string>
 
+#include <types/Code.h>
 #include <types/Quantity.hpp>
 
 namespace topskytower {
@@ -26,8 +27,8 @@ namespace topskytower {
                 Odd       = 2
             };
 
-            std::string   origin;       /**< The origin airport */
-            std::string   destination;  /**< The destination airport */
+            IcaoCode      origin;       /**< The origin airport */
+            IcaoCode      destination;  /**< The destination airport */
             std::string   route;        /**< The complete route */
             types::Length minimumLevel; /**< The minimum flight level */
             types::Length maximumLevel; /**< The maximum flight level */
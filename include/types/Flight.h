@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <memory>
+
+#include <types/FlightId.h>
 #include <types/FlightPlan.h>
 #include <types/Position.h>
 
@@ -16,6 +19,10 @@ namespace topskytower {
         /**
          * @brief Describes a flight with all kinematic information
          * @ingroup types
+         *
+         * The flight plan is immutable and shared between all copies of the flight.
+         * Therefore a copy of the flight does not copy the flight plan.
+         * A changed flight plan is assigned as a new flight plan with a new version.
          */
         class Flight {
         public:
@@ -29,20 +36,21 @@ namespace topskytower {
             };
 
         private:
-            FlightPlan      m_flightPlan;
-            std::string     m_callsign;
-            bool            m_airborne;
-            Position        m_currentPosition;
-            Velocity        m_groundSpeed;
-            Velocity        m_verticalSpeed;
-            bool            m_markedByController;
-            bool            m_onMissedApproach;
-            bool            m_irregularFlight;
-            bool            m_establishedOnILS;
-            bool            m_departureReady;
-            bool            m_isTrackedByController;
-            bool            m_isTrackedByOtherController;
-            std::string     m_handoffReceivedBy;
+            std::shared_ptr<const FlightPlan> m_flightPlan;
+            std::string                       m_callsign;
+            FlightId                          m_id;
+            bool                              m_airborne;
+            Position                          m_currentPosition;
+            Velocity                          m_groundSpeed;
+            Velocity                          m_verticalSpeed;
+            bool                              m_markedByController;
+            bool                              m_onMissedApproach;
+            bool                              m_irregularFlight;
+            bool                              m_establishedOnILS;
+            bool                              m_departureReady;
+            bool                              m_isTrackedByController;
+            bool                              m_isTrackedByOtherController;
+            std::string                       m_handoffReceivedBy;
 
         public:
             /**
@@ -54,12 +62,23 @@ namespace topskytower {
              * @param[in] callsign The flight's callsign
              */
             explicit Flight(const std::string& callsign);
+            /**
+             * @brief Creates a flight with a defined callsign that is already interned
+             * @param[in] callsign The flight's callsign
+             * @param[in] id The interned identifier of the callsign
+             */
+            Flight(const std::string& callsign, FlightId id);
 
             /**
              * @brief Returns the flight's callsign
              * @return The callsign
              */
             const std::string& callsign() const;
+            /**
+             * @brief Returns the identifier of the flight's interned callsign
+             * @return The identifier
+             */
+            FlightId id() const;
             /**
              * @brief Returns if the flight was airborne in the past or not
              * @return True if the flight was airborne, else false
@@ -111,10 +130,10 @@ namespace topskytower {
              */
             const FlightPlan& flightPlan() const;
             /**
-             * @brief Returns a changable flight plan
-             * @return The changable flight plan
+             * @brief Returns the shared flight plan
+             * @return The flight plan that can be assigned to other flights without a copy
              */
-            FlightPlan& flightPlan();
+            const std::shared_ptr<const FlightPlan>& sharedFlightPlan() const;
             /**
              * @brief Sets the airborne state
              * @param[in] airborne The airborne state
@@ -165,6 +184,11 @@ namespace topskytower {
              * @param[in] plan The flight plan
              */
             void setFlightPlan(const FlightPlan& plan);
+            /**
+             * @brief Shares the flight plan of an other flight
+             * @param[in] plan The shared flight plan
+             */
+            void setFlightPlan(const std::shared_ptr<const FlightPlan>& plan);
             /**
              * @brief Returns if the aircraft is tracked
              * @return True if the aircraft is tracked, else false
@@ -0,0 +1,271 @@
+/*
+ * @brief Defines the interned callsigns and the flight-indexed storage
+ * @file types/FlightId.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <helper/Exception.h>
+
+namespace topskytower {
+    namespace types {
+        /**
+         * @brief Defines the dense identifier of an interned callsign
+         */
+        typedef std::uint32_t FlightId;
+
+        /**
+         * @brief Interns the callsigns of all flights of the process
+         * @ingroup types
+         *
+         * Every callsign receives a dense identifier when it is seen for the first time.
+         * The identifier is stable for the complete runtime and is not reused, even if the flight disconnects.
+         * A reconnecting flight with the same callsign receives the same identifier.
+         * The empty callsign is always interned as zero.
+         *
+         * All functions are thread-safe. The lookups share the lock and only the interning of an unknown callsign
+         * locks the table exclusively. The hot paths intern the callsign once per radar target and use the identifier.
+         */
+        class CallsignTable {
+        public:
+            /**
+             * @brief The identifier of an unknown callsign
+             */
+            static constexpr FlightId Invalid = std::numeric_limits<FlightId>::max();
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            mutable std::shared_mutex                 m_lock;
+            std::unordered_map<std::string, FlightId> m_ids;
+            std::deque<std::string>                   m_callsigns;
+
+            CallsignTable();
+
+        public:
+            CallsignTable(const CallsignTable& other) = delete;
+            CallsignTable(CallsignTable&& other) = delete;
+
+            CallsignTable& operator=(const CallsignTable& other) = delete;
+            CallsignTable& operator=(CallsignTable&& other) = delete;
+
+            /**
+             * @brief Returns the identifier of a callsign and interns it if it is unknown
+             * @param[in] callsign The callsign
+             * @return The identifier
+             */
+            FlightId intern(const std::string& callsign);
+            /**
+             * @brief Returns the identifier of a callsign without interning it
+             * @param[in] callsign The callsign
+             * @return The identifier or Invalid if the callsign is unknown
+             */
+            FlightId find(const std::string& callsign) const;
+            /**
+             * @brief Returns the callsign of an identifier
+             * @param[in] id The identifier
+             * @return The callsign that is valid for the complete runtime or an empty callsign if the identifier is unknown
+             */
+            const std::string& callsign(FlightId id) const;
+            /**
+             * @brief Returns the number of interned callsigns
+             * @return The number of callsigns
+             */
+            std::size_t size() const;
+            /**
+             * @brief Returns the table of the process
+             * @return The callsign table
+             */
+            static CallsignTable& instance();
+#endif
+        };
+
+        /**
+         * @brief Stores a value per flight in a dense table that is indexed by the flight's identifier
+         * @ingroup types
+         *
+         * The lookups do not compare any callsign. The values are stored in slots and the slots of erased values are
+         * reused. Therefore the iteration and the memory of the values are bounded by the maximum number of values that
+         * are stored at the same time. Every identifier costs only the index of its slot.
+         * The values keep their addresses until they are erased. The iteration does not follow the order of the
+         * identifiers.
+         */
+        template <typename T>
+        class FlightMap {
+#ifndef DOXYGEN_IGNORE
+        private:
+            static constexpr std::uint32_t FreeSlot = std::numeric_limits<std::uint32_t>::max();
+
+            std::vector<std::uint32_t>   m_slots;
+            std::deque<std::optional<T>> m_values;
+            std::vector<FlightId>        m_owners;
+            std::vector<std::uint32_t>   m_freeSlots;
+            std::size_t                  m_size;
+
+            std::uint32_t slot(FlightId id) const {
+                if (this->m_slots.size() <= id)
+                    return FlightMap::FreeSlot;
+                return this->m_slots[id];
+            }
+            void release(std::uint32_t slot) {
+                this->m_slots[this->m_owners[slot]] = FlightMap::FreeSlot;
+                this->m_values[slot].reset();
+                this->m_owners[slot] = CallsignTable::Invalid;
+                this->m_freeSlots.push_back(slot);
+                this->m_size -= 1;
+            }
+
+        public:
+            /**
+             * @brief Creates an empty table
+             */
+            FlightMap() :
+                    m_slots(),
+                    m_values(),
+                    m_owners(),
+                    m_freeSlots(),
+                    m_size(0) { }
+
+            /**
+             * @brief Returns the value of a flight
+             * @param[in] id The flight's identifier
+             * @return The value or nullptr if the flight is not stored
+             */
+            T* find(FlightId id) {
+                auto slot = this->slot(id);
+                if (FlightMap::FreeSlot == slot)
+                    return nullptr;
+                return &(*this->m_values[slot]);
+            }
+            /**
+             * @brief Returns the value of a flight
+             * @param[in] id The flight's identifier
+             * @return The value or nullptr if the flight is not stored
+             */
+            const T* find(FlightId id) const {
+                auto slot = this->slot(id);
+                if (FlightMap::FreeSlot == slot)
+                    return nullptr;
+                return &(*this->m_values[slot]);
+            }
+            /**
+             * @brief Checks if a flight is stored
+             * @param[in] id The flight's identifier
+             * @return True if the flight is stored, else false
+             */
+            bool contains(FlightId id) const {
+                return FlightMap::FreeSlot != this->slot(id);
+            }
+            /**
+             * @brief Returns the value of a flight and creates a default value if the flight is not stored
+             * @param[in] id The flight's identifier
+             * @return The value
+             * @throw helper::Exception if the identifier is CallsignTable::Invalid
+             */
+            T& operator[](FlightId id) {
+                /* the unknown identifier would grow the slots to the complete identifier range */
+                if (CallsignTable::Invalid == id)
+                    throw helper::Exception("FlightMap", "Unable to store a value for an unknown flight");
+
+                auto slot = this->slot(id);
+                if (FlightMap::FreeSlot != slot)
+                    return *this->m_values[slot];
+
+                if (this->m_slots.size() <= id)
+                    this->m_slots.resize(static_cast<std::size_t>(id) + 1, FlightMap::FreeSlot);
+
+                /* reuse the slot of an erased value before the table grows */
+                if (0 != this->m_freeSlots.size()) {
+                    slot = this->m_freeSlots.back();
+                    this->m_freeSlots.pop_back();
+                    this->m_owners[slot] = id;
+                }
+                else {
+                    slot = static_cast<std::uint32_t>(this->m_values.size());
+                    this->m_values.emplace_back();
+                    this->m_owners.push_back(id);
+                }
+
+                this->m_slots[id] = slot;
+                this->m_size += 1;
+                return this->m_values[slot].emplace();
+            }
+            /**
+             * @brief Removes the value of a flight
+             * @param[in] id The flight's identifier
+             * @return True if the flight was stored, else false
+             */
+            bool erase(FlightId id) {
+                auto slot = this->slot(id);
+                if (FlightMap::FreeSlot == slot)
+                    return false;
+
+                this->release(slot);
+                return true;
+            }
+            /**
+             * @brief Removes all values for which the predicate returns true
+             * @param[in] predicate The predicate that receives the identifier and the value
+             */
+            template <typename Predicate>
+            void eraseIf(Predicate predicate) {
+                for (std::size_t i = 0; i < this->m_values.size(); ++i) {
+                    auto& value = this->m_values[i];
+                    if (true == value.has_value() && true == predicate(this->m_owners[i], *value))
+                        this->release(static_cast<std::uint32_t>(i));
+                }
+            }
+            /**
+             * @brief Calls a function for every stored value
+             * @param[in] function The function that receives the identifier and the value
+             */
+            template <typename Function>
+            void forEach(Function function) {
+                for (std::size_t i = 0; i < this->m_values.size(); ++i) {
+                    if (true == this->m_values[i].has_value())
+                        function(this->m_owners[i], *this->m_values[i]);
+                }
+            }
+            /**
+             * @brief Calls a function for every stored value
+             * @param[in] function The function that receives the identifier and the value
+             */
+            template <typename Function>
+            void forEach(Function function) const {
+                for (std::size_t i = 0; i < this->m_values.size(); ++i) {
+                    if (true == this->m_values[i].has_value())
+                        function(this->m_owners[i], *this->m_values[i]);
+                }
+            }
+            /**
+             * @brief Removes all values
+             */
+            void clear() {
+                this->m_slots.clear();
+                this->m_values.clear();
+                this->m_owners.clear();
+                this->m_freeSlots.clear();
+                this->m_size = 0;
+            }
+            /**
+             * @brief Returns the number of stored values
+             * @return The number of values
+             */
+            std::size_t size() const {
+                return this->m_size;
+            }
+#endif
+        };
+    }
+}
@@ -8,9 +8,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include <types/Aircraft.h>
+#include <types/Code.h>
 #include <types/Quantity.hpp>
 #include <types/Route.h>
 
@@ -52,12 +54,12 @@ namespace topskytower {
             Type            m_type;
             types::Aircraft m_aircraft;
             std::uint16_t   m_atcCommand;
-            std::string     m_origin;
+            IcaoCode        m_origin;
             std::string     m_textRoute;
             std::string     m_departureRoute;
-            std::string     m_departureRunway;
-            std::string     m_destination;
-            std::string     m_arrivalRunway;
+            RunwayCode      m_departureRunway;
+            IcaoCode        m_destination;
+            RunwayCode      m_arrivalRunway;
             types::Length   m_flightLevel;
             std::string     m_arrivalRoute;
             std::uint16_t   m_assignedSquawk;
@@ -66,6 +68,9 @@ namespace topskytower {
             bool            m_rnavCapable;
             bool            m_transponderExists;
             Route           m_route;
+            std::uint64_t   m_version;
+
+            friend class Flight;
 
         public:
             /**
@@ -102,7 +107,7 @@ namespace topskytower {
              * @brief Returns the flight's origin
              * @return The origin as ICAO
              */
-            const std::string& origin() const;
+            const IcaoCode& origin() const;
             /**
              * @brief Sets the destination of the flight
              * @param[in] destination The new destination
@@ -112,7 +117,7 @@ namespace topskytower {
              * @brief Returns the flight's destiniation
              * @return The destination as ICAO
              */
-            const std::string& destination() const;
+            const IcaoCode& destination() const;
             /**
              * @brief Sets the new text route
              * @param[in] route The filed route
@@ -221,7 +226,7 @@ namespace topskytower {
              * @brief Returns the departure runway
              * @return The departure runway
              */
-            const std::string& departureRunway() const;
+            const RunwayCode& departureRunway() const;
             /**
              * @brief Sets the new arrival runway
              * @param[in] runway The arrival runway
@@ -231,7 +236,7 @@ namespace topskytower {
              * @brief Returns the arrival runway
              * @return The arrival runway
              */
-            const std::string& arrivalRunway() const;
+            const RunwayCode& arrivalRunway() const;
             /**
              * @brief Set the ATC command flag
              * @param[in] command The new command flag, but no combination between arrival and departure is allowed
@@ -252,6 +257,13 @@ namespace topskytower {
              * @return The arrival relevant ATC command
              */
             AtcCommand arrivalFlag() const;
+            /**
+             * @brief Returns the version of the flight plan
+             * A flight plan receives a new version as soon as it is assigned to a flight.
+             * Two flights with the same version share the same flight plan.
+             * @return The version or zero if the flight plan was never assigned to a flight
+             */
+            std::uint64_t version() const;
         };
     }
 }
@@ -0,0 +1,126 @@
+/*
+ * @brief Defines the structure-of-arrays storage of the flight kinematics
+ * @file types/KinematicTable.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <types/Flight.h>
+#include <types/FlightId.h>
+
+namespace topskytower {
+    namespace types {
+        /**
+         * @brief Stores the kinematic information of a set of flights in contiguous arrays
+         * @ingroup types
+         *
+         * Every flight occupies one slot and every component is stored in an own array of base unit values.
+         * The slots are dense, i.e. a removed flight is replaced by the last flight of the table.
+         * Therefore a sweep over all flights reads the components sequentially, e.g. four coordinates per SSE2 block.
+         * A slot is only valid until the next removal.
+         */
+        class KinematicTable {
+        public:
+            /**
+             * @brief The slot of a flight that is not stored
+             */
+            static constexpr std::size_t InvalidSlot = std::numeric_limits<std::size_t>::max();
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            FlightMap<std::uint32_t> m_slots;
+            std::vector<FlightId>    m_ids;
+            std::vector<float>       m_latitudes;
+            std::vector<float>       m_longitudes;
+            std::vector<float>       m_altitudes;
+            std::vector<float>       m_headings;
+            std::vector<float>       m_groundSpeeds;
+            std::vector<float>       m_verticalSpeeds;
+
+        public:
+            /**
+             * @brief Creates an empty table
+             */
+            KinematicTable();
+
+            /**
+             * @brief Adds a flight or updates its kinematic information
+             * @param[in] flight The flight
+             * @return The slot of the flight
+             */
+            std::size_t update(const Flight& flight);
+            /**
+             * @brief Removes a flight out of the table
+             * The last flight of the table moves into the slot of the removed flight.
+             * @param[in] id The flight's identifier
+             * @return True if the flight was stored, else false
+             */
+            bool erase(FlightId id);
+            /**
+             * @brief Removes all flights
+             */
+            void clear();
+            /**
+             * @brief Returns the slot of a flight
+             * @param[in] id The flight's identifier
+             * @return The slot or InvalidSlot if the flight is not stored
+             */
+            std::size_t slot(FlightId id) const;
+            /**
+             * @brief Returns the number of stored flights
+             * @return The number of flights and the size of every component
+             */
+            std::size_t size() const;
+            /**
+             * @brief Returns the identifiers of the flights per slot
+             * @return The identifiers
+             */
+            std::span<const FlightId> ids() const;
+            /**
+             * @brief Returns the latitudes per slot in degrees
+             * @return The latitudes
+             */
+            std::span<const float> latitudes() const;
+            /**
+             * @brief Returns the longitudes per slot in degrees
+             * @return The longitudes
+             */
+            std::span<const float> longitudes() const;
+            /**
+             * @brief Returns the altitudes per slot in metres
+             * @return The altitudes
+             */
+            std::span<const float> altitudes() const;
+            /**
+             * @brief Returns the headings per slot in degrees
+             * @return The headings
+             */
+            std::span<const float> headings() const;
+            /**
+             * @brief Returns the ground speeds per slot in metres per second
+             * @return The ground speeds
+             */
+            std::span<const float> groundSpeeds() const;
+            /**
+             * @brief Returns the vertical speeds per slot in metres per second
+             * @return The vertical speeds
+             */
+            std::span<const float> verticalSpeeds() const;
+            /**
+             * @brief Returns the position of a slot
+             * @param[in] slot The slot
+             * @return The position
+             */
+            Position position(std::size_t slot) const;
+#endif
+        };
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * @brief Defines an airport-anchored local tangent plane
+ * @file types/LocalTangentPlane.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <span>
+
+#include <types/Coordinate.h>
+#include <types/Quantity.hpp>
+
+namespace topskytower {
+    namespace types {
+        /**
+         * @brief Calculates short distances and bearings around an anchor without solving the geodesic problem
+         * @ingroup types
+         *
+         * The plane approximates the WGS84 ellipsoid by its local east-north-up frame.
+         * Both coordinates are mapped into the frame of their mid-latitude with the meridional and the normal radius of
+         * curvature of the ellipsoid. The bearing is corrected by the meridian convergence between the mid-point and the
+         * first coordinate to get the initial azimuth of the geodesic.
+         *
+         * The result is only used if both coordinates are inside the range around the anchor.
+         * Otherwise the functions fall back to the ellipsoidal solver of the coordinate.
+         * Compared to the geodesic between latitudes of 0 and 75 degrees, the maximum errors are:
+         * - 5 NM range: 0.1 m and 0.0002 degree
+         * - 10 NM range: 0.8 m and 0.001 degree
+         * - 20 NM range: 6.5 m and 0.003 degree
+         *
+         * Up to 10 NM the error is in the order of the resolution of the coordinate's single precision components.
+         */
+        class LocalTangentPlane {
+        private:
+            Coordinate m_anchor;
+            Length     m_range;
+            double     m_anchorLatitude;
+            double     m_anchorLongitude;
+            double     m_meridionalRadius;
+            double     m_parallelRadius;
+            double     m_squaredRange;
+
+            bool localOffset(const Coordinate& from, const Coordinate& to, double& east, double& north, double& convergence) const;
+            template <typename Loader, typename Accessor>
+            void batchDistances(const Coordinate& from, std::size_t count, Loader loader, Accessor coordinate,
+                                std::span<Length> distances) const;
+
+        public:
+            /**
+             * @brief Creates a plane without range
+             * All calculations are forwarded to the ellipsoidal solver.
+             */
+            LocalTangentPlane();
+            /**
+             * @brief Creates a plane around an anchor
+             * @param[in] anchor The anchor of the plane, e.g. the airport's center
+             * @param[in] range The range around the anchor in which the plane is used
+             */
+            LocalTangentPlane(const Coordinate& anchor, const Length& range);
+
+            /**
+             * @brief Returns the anchor of the plane
+             * @return The anchor
+             */
+            const Coordinate& anchor() const;
+            /**
+             * @brief Returns the range around the anchor in which the plane is used
+             * @return The range
+             */
+            const Length& range() const;
+            /**
+             * @brief Checks if a coordinate is inside the range of the plane
+             * The check uses the radii of curvature of the anchor and is therefore only approximate.
+             * @param[in] coordinate The coordinate that needs to be checked
+             * @return True if the plane is used for the coordinate, else false
+             */
+            bool covers(const Coordinate& coordinate) const;
+            /**
+             * @brief Calculates the distance between two coordinates
+             * @param[in] from The first coordinate
+             * @param[in] to The second coordinate
+             * @return The distance between both coordinates
+             */
+            Length distance(const Coordinate& from, const Coordinate& to) const;
+            /**
+             * @brief Calculates the distances between one coordinate and many other coordinates
+             * The coordinates are processed in blocks of four with SSE2 if the target supports it.
+             * The radii of curvature are expanded around the first coordinate, which keeps the error inside the bounds
+             * of the single distance calculation. Coordinates outside the range use the ellipsoidal solver.
+             * The distances need to provide at least as many elements as the other coordinates.
+             * @param[in] from The first coordinate
+             * @param[in] to The other coordinates
+             * @param[out] distances The distances between the first coordinate and the other coordinates
+             * @throw helper::Exception if the distances provide less elements than the other coordinates
+             */
+            void distances(const Coordinate& from, std::span<const Coordinate> to, std::span<Length> distances) const;
+            /**
+             * @brief Calculates the distances between one coordinate and many other coordinates in separate component arrays
+             * The components are loaded without a conversion, e.g. out of a kinematic table.
+             * @param[in] from The first coordinate
+             * @param[in] latitudes The latitudes of the other coordinates in degrees
+             * @param[in] longitudes The longitudes of the other coordinates in degrees
+             * @param[out] distances The distances between the first coordinate and the other coordinates
+             * @throw helper::Exception if the components have different sizes or the distances provide less elements
+             */
+            void distances(const Coordinate& from, std::span<const float> latitudes, std::span<const float> longitudes,
+                           std::span<Length> distances) const;
+            /**
+             * @brief Calculates the bearing from the first to the second coordinate
+             * @param[in] from The first coordinate
+             * @param[in] to The second coordinate
+             * @return The initial bearing between both coordinates in [0, 360)
+             */
+            Angle bearing(const Coordinate& from, const Coordinate& to) const;
+            /**
+             * @brief Calculates the bearings from one coordinate to many other coordinates
+             * The bearings need to provide at least as many elements as the other coordinates.
+             * @param[in] from The first coordinate
+             * @param[in] to The other coordinates
+             * @param[out] bearings The initial bearings between the first coordinate and the other coordinates in [0, 360)
+             * @throw helper::Exception if the bearings provide less elements than the other coordinates
+             */
+            void bearings(const Coordinate& from, std::span<const Coordinate> to, std::span<Angle> bearings) const;
+        };
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * @brief Defines the shared gnomonic projection of an airport
+ * @file types/ProjectionContext.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <types/Coordinate.h>
+
+namespace topskytower {
+    namespace types {
+        /**
+         * @brief Projects coordinates into the Cartesian frame around the airport's center
+         * @ingroup types
+         *
+         * All controls of an airport share one context. A radar target update is projected by the first control
+         * that needs the Cartesian position and all other controls receive the cached result of the same update.
+         * The cache is indexed by the coordinate itself. Therefore no invalidation is needed if a flight moves or
+         * disappears. New positions replace the old entries.
+         *
+         * The context is not thread-safe and needs to be used by the thread that updates the controls.
+         */
+        class ProjectionContext {
+        private:
+            struct Entry {
+                std::uint64_t key;
+                bool          valid;
+                float         cartesian[2];
+            };
+
+            static constexpr std::size_t CacheSize = 64;
+
+            Coordinate                   m_center;
+            std::array<Entry, CacheSize> m_cache;
+
+            void project(const Coordinate& coordinate, float cartesian[2]) const;
+
+        public:
+            /**
+             * @brief Creates a context around a center
+             * @param[in] center The center of the projection, e.g. the airport's center
+             */
+            ProjectionContext(const Coordinate& center);
+
+            /**
+             * @brief Returns the center of the projection
+             * @return The center
+             */
+            const Coordinate& center() const;
+            /**
+             * @brief Projects a coordinate into the Cartesian frame
+             * The projection is cached until a different coordinate replaces the entry.
+             * @param[in] coordinate The coordinate that needs to be projected
+             * @param[out] cartesian The Cartesian coordinate in metres
+             */
+            void forward(const Coordinate& coordinate, float cartesian[2]);
+            /**
+             * @brief Projects a Cartesian coordinate back to the geographic coordinate
+             * @param[in] x The x-component in metres
+             * @param[in] y The y-component in metres
+             * @return The geographic coordinate
+             */
+            Coordinate reverse(float x, float y) const;
+        };
+    }
+}
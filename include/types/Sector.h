@@ -72,6 +72,11 @@ namespace topskytower {
             Sector(std::string&& identifier, std::string&& prefix, std::string&& midfix,
                    std::string&& suffix, std::string&& frequency, const std::string& latitude,
                    const std::string& longitude);
+            /**
+             * @brief Creates a sector out of a serialized sector
+             * @param[in] reader The reader that contains the serialized sector
+             */
+            Sector(helper::BinaryReader& reader);
             /**
              * @brief Moves one sector into the other
              * @param[in] other The source sector
@@ -129,6 +134,11 @@ namespace topskytower {
              * @return True if the position is inside one of the borders, else false
              */
             bool isInsideSector(const types::Position& position) const;
+            /**
+             * @brief Serializes the sector with all borders
+             * @param[out] writer The writer that receives the sector
+             */
+            void serialize(helper::BinaryWriter& writer) const;
         };
     }
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <string>
 #include <vector>
@@ -29,9 +30,30 @@ namespace topskytower {
         /**
          * @brief Describes a border of a controller sector
          * @ingroup types
+         *
+         * The border splits its bounding box into a uniform grid of cells.
+         * A cell is either completely inside, completely outside or crossed by the border.
+         * Only the positions in crossed cells are projected and tested against the polygon.
          */
         class SectorBorder {
+        public:
+            /**
+             * @brief Defines how an area is covered by the border
+             */
+            enum class Coverage : std::uint8_t {
+                Outside = 0, /**< No position of the area is inside the border */
+                Inside  = 1, /**< All positions of the area are inside the border */
+                Partial = 2  /**< The positions of the area need the exact test */
+            };
+
         private:
+            enum class Cell : std::uint8_t {
+                Unknown  = 0,
+                Outside  = 1,
+                Inside   = 2,
+                Boundary = 3
+            };
+
             std::string                                                       m_owner;
             std::vector<std::string>                                          m_deputies;
             types::Length                                                     m_lowerAltitude;
@@ -40,6 +62,13 @@ namespace topskytower {
             std::list<types::Coordinate>                                      m_edges;
             bg::model::polygon<bg::model::point<float, 2, bg::cs::cartesian>> m_shape;
             types::Angle                                                      m_boundingBox[2][2];
+            std::size_t                                                       m_gridColumns;
+            std::size_t                                                       m_gridRows;
+            std::vector<Cell>                                                 m_grid;
+
+            void buildGrid();
+            void gridCell(const types::Coordinate& coordinate, std::size_t& column, std::size_t& row) const;
+            bool isInsideShape(const types::Coordinate& coordinate) const;
 
         public:
             /**
@@ -55,6 +84,12 @@ namespace topskytower {
              */
             SectorBorder(std::string&& owner, std::vector<std::string>&& deputies, const types::Length& lowerAltitude,
                          const types::Length& upperAltitude) noexcept;
+            /**
+             * @brief Creates a border out of a serialized border
+             * The projected shape and the grid are restored without any projection.
+             * @param[in] reader The reader that contains the serialized border
+             */
+            SectorBorder(helper::BinaryReader& reader);
             /**
              * @brief Moves other into this border
              * @param[in] other The source border
@@ -121,6 +156,27 @@ namespace topskytower {
              * @return True if the position is inside the border, else false
              */
             bool isInsideBorder(const types::Position& position) const;
+            /**
+             * @brief Checks how a rectangle is covered by the border and ignores the altitude restrictions
+             * The result is conservative and uses the grid of the border without an exact test.
+             * @param[in] southWest The south-western corner of the rectangle
+             * @param[in] northEast The north-eastern corner of the rectangle
+             * @return The coverage of the rectangle
+             */
+            Coverage coverage(const types::Coordinate& southWest, const types::Coordinate& northEast) const;
+            /**
+             * @brief Calculates the distance between a coordinate and the edges of the border
+             * The result is a lower bound and ignores the altitude restrictions.
+             * All positions closer to the coordinate are either inside or outside the border.
+             * @param[in] coordinate The coordinate
+             * @return The distance to the closest edge
+             */
+            types::Length distanceToEdges(const types::Coordinate& coordinate) const;
+            /**
+             * @brief Serializes the border with the projected shape and the grid
+             * @param[out] writer The writer that receives the border
+             */
+            void serialize(helper::BinaryWriter& writer) const;
         };
     }
 }
@@ -46,6 +46,7 @@ namespace topskytower {
             bool                flightPlanCheckNavigation;             /**< Defines if the flight plan checker tests for RNAV-capabilities */
             types::Length       standAssociationDistance;              /**< Defines the maximum distance to assign automatically an aircraft to a stand */
             types::Time         surveillanceVisualizationDuration;     /**< Defines the duration of visualization durations */
+            types::Length       localProjectionRange;                  /**< Defines the range around the airport in which distances are calculated in a local plane */
             bool                ariwsActive;                           /**< Defines if ARIWS is active or not */
             types::Length       ariwsDistanceDeadband;                 /**< Defines the distance in which the RIW is suppressed around the holding point */
             types::Length       ariwsMaximumDistance;                  /**< Defines the maximum distance to check if the flight is on the runway */
@@ -96,6 +97,7 @@ namespace topskytower {
                     flightPlanCheckNavigation(true),
                     standAssociationDistance(10_nm),
                     surveillanceVisualizationDuration(10_s),
+                    localProjectionRange(10_nm),
                     ariwsActive(true),
                     ariwsDistanceDeadband(50_m),
                     ariwsMaximumDistance(100_m),
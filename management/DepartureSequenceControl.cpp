@@ -11,18 +11,20 @@
 
 #include <algorithm>
 
+#include <helper/Clock.h>
 #include <management/DepartureSequenceControl.h>
 #include <system/FlightRegistry.h>
 
+#include <system/PerformanceRegistry.h>
 #include <system/Separation.h>
 
 using namespace topskytower;
 using namespace topskytower::management;
 using namespace topskytower::types;
 
-DepartureSequenceControl::DepartureSequenceControl(const std::string& airport, const types::Coordinate& center) :
+DepartureSequenceControl::DepartureSequenceControl(const std::string& airport, types::ProjectionContext* projection) :
         m_airport(airport),
-        m_holdingPoints(airport, center),
+        m_holdingPoints(airport, projection),
         m_departureReady(),
         m_departedPerRunway() {
     system::ConfigurationRegistry::instance().registerNotificationCallback(this, &DepartureSequenceControl::reinitialize);
@@ -30,6 +32,10 @@ DepartureSequenceControl::DepartureSequenceControl(const std::string& airport, c
 }
 
 void DepartureSequenceControl::reinitialize(system::ConfigurationRegistry::UpdateType type) {
+    if (system::ConfigurationRegistry::UpdateType::System == type) {
+        this->m_holdingPoints.updateLocalPlane();
+        return;
+    }
     if (system::ConfigurationRegistry::UpdateType::All != type && system::ConfigurationRegistry::UpdateType::Runtime != type)
         return;
 
@@ -56,29 +62,26 @@ void DepartureSequenceControl::reinitialize(system::ConfigurationRegistry::Updat
 
     /* insert activated runways */
     for (const auto& depRunway : std::as_const(runways)) {
-        if (this->m_departedPerRunway.cend() == this->m_departedPerRunway.find(depRunway))
-            this->m_departedPerRunway[depRunway] = DepartureInformation();
+        types::RunwayCode runway(depRunway);
+        if (this->m_departedPerRunway.cend() == this->m_departedPerRunway.find(runway))
+            this->m_departedPerRunway[runway] = DepartureInformation();
     }
 
     /* cleanup the old departures, if a runway is deactivated */
     if (true == runwayDisabled) {
-        for (auto it = this->m_departureReady.begin(); this->m_departureReady.end() != it;) {
-            if (false == system::FlightRegistry::instance().flightExists(it->first)) {
-                it = this->m_departureReady.erase(it);
-            }
-            else {
-                const auto& flight = system::FlightRegistry::instance().flight(it->first);
-                auto rIt = this->m_departedPerRunway.find(flight.flightPlan().departureRunway());
-                if (this->m_departedPerRunway.cend() == rIt)
-                    it = this->m_departureReady.erase(it);
-                else
-                    ++it;
-            }
-        }
+        this->m_departureReady.eraseIf([this](types::FlightId id, const DepartureInformation&) {
+            if (false == system::FlightRegistry::instance().flightExists(id))
+                return true;
+
+            const auto& flight = system::FlightRegistry::instance().flight(id);
+            return this->m_departedPerRunway.cend() == this->m_departedPerRunway.find(flight.flightPlan().departureRunway());
+        });
     }
 }
 
 void DepartureSequenceControl::updateFlight(const types::Flight& flight, types::Flight::Type type) {
+    system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::DepartureSequenceControl);
+
     /* ignore non-departure or non-IFR flights */
     if (types::Flight::Type::Departure != type || types::FlightPlan::Type::IFR != flight.flightPlan().type())
         return;
@@ -92,34 +95,34 @@ void DepartureSequenceControl::updateFlight(const types::Flight& flight, types::
     else if (true == this->m_holdingPoints.passedHoldingPoint(flight, type, true, deadband, 20_deg, nullptr))
         passedHoldingPoint = true;
 
-    auto rdyIt = this->m_departureReady.find(flight.callsign());
+    auto ready = this->m_departureReady.find(flight.id());
 
     /* update the internal statistics and check if the flight is departing */
-    if (this->m_departureReady.cend() != rdyIt) {
-        rdyIt->second.reachedHoldingPoint = atHoldingPoint;
+    if (nullptr != ready) {
+        ready->reachedHoldingPoint = atHoldingPoint;
         if (true == passedHoldingPoint)
-            rdyIt->second.passedHoldingPoint = true;
+            ready->passedHoldingPoint = true;
 
         /* flight is departing -> update the internal statistics */
-        if ((types::FlightPlan::AtcCommand::Departure == flight.flightPlan().departureFlag() && true == rdyIt->second.passedHoldingPoint) || 40_kn <= flight.groundSpeed()) {
+        if ((types::FlightPlan::AtcCommand::Departure == flight.flightPlan().departureFlag() && true == ready->passedHoldingPoint) || 40_kn <= flight.groundSpeed()) {
             auto rwyIt = this->m_departedPerRunway.find(flight.flightPlan().departureRunway());
             if (this->m_departedPerRunway.end() != rwyIt) {
-                rwyIt->second = std::move(rdyIt->second);
-                rwyIt->second.actualTakeOffTime = std::chrono::system_clock::now();
+                rwyIt->second = std::move(*ready);
+                rwyIt->second.actualTakeOffTime = helper::Clock::instance().now();
                 rwyIt->second.lastReportedPosition = flight.currentPosition().coordinate();
                 rwyIt->second.flewDistance = 0.0_m;
             }
 
             /* cleanup the ready list */
-            this->m_departureReady.erase(rdyIt);
+            this->m_departureReady.erase(flight.id());
         }
         /* flight is not ready anymore and not at the holding point */
-        else if (false == flight.readyForDeparture() && 0 == rdyIt->second.holdingPoint.name.length()) {
-            this->m_departureReady.erase(rdyIt);
+        else if (false == flight.readyForDeparture() && 0 == ready->holdingPoint.name.length()) {
+            this->m_departureReady.erase(flight.id());
         }
         else if (true == atHoldingPoint) {
-            rdyIt->second.normalProcedureHoldingPoint = false == system::ConfigurationRegistry::instance().runtimeConfiguration().lowVisibilityProcedures;
-            rdyIt->second.holdingPoint = this->m_holdingPoints.holdingPoint(rdyIt->second.normalProcedureHoldingPoint, holdingPointIdx);
+            ready->normalProcedureHoldingPoint = false == system::ConfigurationRegistry::instance().runtimeConfiguration().lowVisibilityProcedures;
+            ready->holdingPoint = this->m_holdingPoints.holdingPoint(ready->normalProcedureHoldingPoint, holdingPointIdx);
         }
     }
     /* check if it is a candidate to be departure ready */
@@ -134,23 +137,23 @@ void DepartureSequenceControl::updateFlight(const types::Flight& flight, types::
         info.holdingPoint = true == atHoldingPoint ? this->m_holdingPoints.holdingPoint(normalProcedure, holdingPointIdx) : types::HoldingPoint();
         info.wtc = flight.flightPlan().aircraft().wtc();
 
-        this->m_departureReady[flight.callsign()] = std::move(info);
+        this->m_departureReady[flight.id()] = std::move(info);
     }
     /* check if the flight departed -> update the internal tracking */
     else {
         auto rwyIt = this->m_departedPerRunway.find(flight.flightPlan().departureRunway());
         if (this->m_departedPerRunway.end() != rwyIt && flight.callsign() == rwyIt->second.callsign) {
-            rwyIt->second.flewDistance += rwyIt->second.lastReportedPosition.distanceTo(flight.currentPosition().coordinate());
+            rwyIt->second.flewDistance += this->m_holdingPoints.localPlane().distance(rwyIt->second.lastReportedPosition,
+                                                                                      flight.currentPosition().coordinate());
             rwyIt->second.lastReportedPosition = flight.currentPosition().coordinate();
         }
     }
 }
 
-void DepartureSequenceControl::removeFlight(const std::string& callsign) {
-    auto dIt = this->m_departureReady.find(callsign);
-    if (this->m_departureReady.end() != dIt)
-        this->m_departureReady.erase(dIt);
+void DepartureSequenceControl::removeFlight(types::FlightId id) {
+    this->m_departureReady.erase(id);
 
+    const auto& callsign = types::CallsignTable::instance().callsign(id);
     for (auto it = this->m_departedPerRunway.begin(); this->m_departedPerRunway.end() != it; ++it) {
         if (it->second.callsign == callsign) {
             it->second.actualTakeOffTime = TimePoint();
@@ -168,35 +171,36 @@ std::list<types::HoldingPoint> DepartureSequenceControl::holdingPointCandidates(
 std::list<std::string> DepartureSequenceControl::allReadyForDepartureFlights() const {
     std::list<std::string> retval;
 
-    for (auto it = this->m_departureReady.cbegin(); this->m_departureReady.cend() != it; ++it) {
-        if (true == it->second.reachedHoldingPoint || true == it->second.passedHoldingPoint)
-            retval.push_back(it->first);
-    }
+    this->m_departureReady.forEach([&retval](types::FlightId, const DepartureInformation& info) {
+        if (true == info.reachedHoldingPoint || true == info.passedHoldingPoint)
+            retval.push_back(info.callsign);
+    });
 
+    /* keep the order of the callsigns for the departure sequence window */
+    retval.sort();
     return retval;
 }
 
 bool DepartureSequenceControl::readyForDeparture(const types::Flight& flight) const {
     auto rwyIt = this->m_departedPerRunway.find(flight.flightPlan().departureRunway());
-    auto it = this->m_departureReady.find(flight.callsign());
+    auto info = this->m_departureReady.find(flight.id());
 
     bool ready = this->m_departedPerRunway.cend() != rwyIt && rwyIt->second.callsign == flight.callsign();
-    ready |= this->m_departureReady.cend() != it && (true == flight.readyForDeparture() || true == it->second.reachedHoldingPoint);
+    ready |= nullptr != info && (true == flight.readyForDeparture() || true == info->reachedHoldingPoint);
 
     return ready;
 }
 
 bool DepartureSequenceControl::hasHoldingPoint(const types::Flight& flight) const {
-    auto it = this->m_departureReady.find(flight.callsign());
-    return this->m_departureReady.cend() != it;
+    return this->m_departureReady.contains(flight.id());
 }
 
 const types::HoldingPoint& DepartureSequenceControl::holdingPoint(const types::Flight& flight) const {
     static types::HoldingPoint __fallback;
 
-    auto it = this->m_departureReady.find(flight.callsign());
-    if (this->m_departureReady.cend() != it)
-        return it->second.holdingPoint;
+    auto info = this->m_departureReady.find(flight.id());
+    if (nullptr != info)
+        return info->holdingPoint;
 
     auto rwyIt = this->m_departedPerRunway.find(flight.flightPlan().departureRunway());
     if (this->m_departedPerRunway.cend() != rwyIt && rwyIt->second.callsign == flight.callsign())
@@ -210,23 +214,23 @@ void DepartureSequenceControl::setHoldingPoint(const types::Flight& flight, cons
     if (0 == holdingPoint.name.length())
         return;
 
-    auto it = this->m_departureReady.find(flight.callsign());
+    auto info = this->m_departureReady.find(flight.id());
 
-    if (this->m_departureReady.end() == it) {
+    if (nullptr == info) {
         bool normalProc = false == system::ConfigurationRegistry::instance().runtimeConfiguration().lowVisibilityProcedures;
 
-        this->m_departureReady[flight.callsign()] = DepartureInformation();
-        this->m_departureReady[flight.callsign()].callsign = flight.callsign();
-        this->m_departureReady[flight.callsign()].reachedHoldingPoint = false;
-        this->m_departureReady[flight.callsign()].passedHoldingPoint = false;
-        this->m_departureReady[flight.callsign()].normalProcedureHoldingPoint = normalProc;
-        this->m_departureReady[flight.callsign()].holdingPoint = holdingPoint;
-        this->m_departureReady[flight.callsign()].wtc = flight.flightPlan().aircraft().wtc();
-        this->m_departureReady[flight.callsign()].lastReportedPosition = flight.currentPosition().coordinate();
-        this->m_departureReady[flight.callsign()].flewDistance = 0.0_m;
+        info = &this->m_departureReady[flight.id()];
+        info->callsign = flight.callsign();
+        info->reachedHoldingPoint = false;
+        info->passedHoldingPoint = false;
+        info->normalProcedureHoldingPoint = normalProc;
+        info->holdingPoint = holdingPoint;
+        info->wtc = flight.flightPlan().aircraft().wtc();
+        info->lastReportedPosition = flight.currentPosition().coordinate();
+        info->flewDistance = 0.0_m;
     }
     else {
-        it->second.holdingPoint = holdingPoint;
+        info->holdingPoint = holdingPoint;
     }
 }
 
@@ -248,7 +252,7 @@ void DepartureSequenceControl::departureSpacing(const types::Flight& flight, typ
         if (0.0_m > separation)
             separation = 0.0_m;
 
-        auto now = std::chrono::system_clock::now();
+        auto now = helper::Clock::instance().now();
         timeSpacing = reqTime->second;
         timeSpacing -= static_cast<float>(std::chrono::duration_cast<std::chrono::seconds>(now - rwyIt->second.actualTakeOffTime).count()) * types::second;
         if (0.0_s > timeSpacing)
@@ -18,6 +18,7 @@
 #define CURL_STATICLIB 1
 #include <curl/curl.h>
 
+#include <helper/Clock.h>
 #include <helper/String.h>
 #include <helper/Time.h>
 #include <management/NotamControl.h>
@@ -348,7 +349,7 @@ void NotamControl::run() {
         this->m_pendingQueueLock.unlock();
 
         /* check if a new update is required */
-        auto now = std::chrono::system_clock::now();
+        auto now = helper::Clock::instance().now();
 
         for (auto it = this->m_airportUpdates.begin(); this->m_airportUpdates.end() != it; ++it) {
             /* perform the update step */
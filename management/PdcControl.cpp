@@ -191,7 +191,7 @@ bool PdcControl::translateToCpdlc(const PdcControl::Message& message, PdcControl
 
 bool PdcControl::handleMessage(PdcControl::Message& message) {
     /* ignore unknown flights */
-    if (false == system::FlightRegistry::instance().flightExists(message.sender))
+    if (false == system::FlightRegistry::instance().snapshot()->flightExists(message.sender))
         return false;
 
     auto& channel = this->m_comChannels[message.sender];
@@ -514,7 +514,7 @@ void PdcControl::sendStandbyMessage(const types::Flight& flight) {
 
     /* create the message */
     PdcControl::CpdlcMessage outbound;
-    outbound.sender = flight.flightPlan().origin();
+    outbound.sender = flight.flightPlan().origin().str();
     outbound.receiver = flight.callsign();
     outbound.answerType = PdcControl::CpdlcMessage::AnswerDefinition::NotRequired;
     outbound.message = "REQUEST RECEIVED @REQUEST BEING PROCESSED @STANDBY";
@@ -13,367 +13,137 @@
 
 #include <management/SectorControl.h>
 #include <system/FlightRegistry.h>
+#include <system/PerformanceRegistry.h>
 
 using namespace topskytower;
 using namespace topskytower::management;
 using namespace topskytower::types;
 
+/* the clearance around a flight covers six predictions */
+static constexpr float __clearanceHorizons = 6.0f;
+
 SectorControl::SectorControl() :
-        m_unicom(new Node(types::Sector("UNICOM", "", "", "FSS", "122.800"))),
-        m_rootNode(nullptr),
-        m_ownSector(nullptr),
-        m_sectorAssociations(),
-        m_handoffs(),
-        m_sectorsOfFlights(),
-        m_handoffOfFlightsToMe() { }
+        SectorControl(std::make_shared<const SectorGraph>()) { }
 
 SectorControl::SectorControl(const std::string& airport, const std::list<types::Sector>& sectors) :
-        m_unicom(new Node(types::Sector("UNICOM", "", "", "FSS", "122.800"))),
-        m_rootNode(nullptr),
+        SectorControl(std::make_shared<const SectorGraph>(airport, sectors)) { }
+
+SectorControl::SectorControl(const std::shared_ptr<const SectorGraph>& graph) :
+        m_graph(graph),
+        m_unicom(types::Sector("UNICOM", "", "", "FSS", "122.800")),
+        m_controllers(graph->nodes().size() + 1),
         m_ownSector(nullptr),
         m_sectorAssociations(),
         m_handoffs(),
-        m_sectorsOfFlights() {
-    std::list<types::Sector> airportSectors;
-
-    /* find the tower sectors of the airport */
-    for (const auto& sector : std::as_const(sectors)) {
-        if (airport == sector.controllerInfo().prefix()) {
-            switch (sector.type()) {
-            case types::Sector::Type::Tower:
-            case types::Sector::Type::Ground:
-            case types::Sector::Type::Delivery:
-                airportSectors.push_back(sector);
-                break;
-            default:
-                break;
-            }
-        }
-    }
-
-    /* find all deputies of the airport that are not other airport sectors */
-    std::list<std::string> deputies;
-    for (const auto& tower : std::as_const(airportSectors)) {
-        for (const auto& border : std::as_const(tower.borders())) {
-            for (const auto& deputy : std::as_const(border.deputies())) {
-                /* check if the deputy is an other airport sector */
-                bool isAirportSector = false;
-                for (const auto& other : std::as_const(airportSectors)) {
-                    if (other.controllerInfo().identifier() == deputy) {
-                        isAirportSector = true;
-                        break;
-                    }
-                }
-
-                /* check if the deputy is known and that it is not an other airport sector */
-                if (false == isAirportSector && deputies.cend() == std::find(deputies.cbegin(), deputies.cend(), deputy))
-                    deputies.push_back(deputy);
-            }
-        }
-    }
-
-    /* get all relevant sectors and sort them in a top-down order */
-    auto sortedSectors(sectors);
-    sortedSectors.sort([](const types::Sector& sector0, const types::Sector& sector1) {
-        if (sector0.type() != sector1.type())
-            return sector0.type() > sector1.type();
-        else if (0 == sector0.borders().size() || 0 == sector1.borders().size())
-            return sector0.borders().size() > sector1.borders().size();
-        else
-            return sector0.borders().back().upperAltitude() > sector1.borders().back().upperAltitude();
-    });
-    auto nodes = SectorControl::findRelevantSectors(deputies, sortedSectors);
-    for (const auto& sector : std::as_const(airportSectors))
-        SectorControl::insertNode(nodes, sector);
-
-    /* sort the sectors from upper to lower airspaces */
-    nodes.sort([](const std::shared_ptr<SectorControl::Node>& node0, const std::shared_ptr<SectorControl::Node>& node1) {
-        /* ensure that all types are equal */
-        if (node0->sector.type() != node1->sector.type())
-            return node0->sector.type() > node1->sector.type();
-        /* ensure that the siblings are sorted together */
-        else if (node0->sector.controllerInfo().prefix() != node1->sector.controllerInfo().prefix())
-            return node0->sector.controllerInfo().prefix() > node1->sector.controllerInfo().prefix();
-        /* ensure that the sector without borders is lower */
-        else if (0 == node0->sector.borders().size() || node1->sector.borders().size())
-            return node0->sector.borders().size() > node1->sector.borders().size();
-        /* ensure that the upper levels are above */
-        else
-            return node0->sector.borders().back().upperAltitude() > node1->sector.borders().back().upperAltitude();
-    });
-
-    /* create all relevant siblings */
-    auto siblings = SectorControl::linkSiblings(nodes);
-
-    /* create the final graph */
-    SectorControl::createGraph(siblings);
-
-    /* add the centers of the top-level to get the complete hierarchy */
-    for (const auto& deputy : std::as_const(siblings.front().front()->sector.borders().front().deputies())) {
-        for (const auto& sector : std::as_const(sectors)) {
-            /* found the correct deputy */
-            if (sector.controllerInfo().identifier() == deputy) {
-                std::shared_ptr<Node> node(new Node(sector));
-
-                if (nullptr == this->m_rootNode) {
-                    node->children = siblings.front();
-
-                    for (auto& sibling : siblings.front())
-                        sibling->parents.push_back(node);
-                }
-                else {
-                    this->m_rootNode->parents.push_back(node);
-                    node->children.push_back(this->m_rootNode);
-                }
-
-                this->m_rootNode = node;
+        m_sectorsOfFlights(),
+        m_handoffOfFlightsToMe(),
+        m_clearancesOfFlights(),
+        m_onlineStations(),
+        m_currentQuery(),
+        m_predictedQuery(),
+        m_neighborBorders(),
+        m_responsibleCandidates() {
+    /* UNICOM is always online and uses the last entry of the controllers */
+    this->m_controllers.back().push_back(types::ControllerInfo());
+}
+
+std::vector<types::ControllerInfo>& SectorControl::controllers(const Node* node) {
+    if (&this->m_unicom == node)
+        return this->m_controllers.back();
+    return this->m_controllers[this->m_graph->index(node)];
+}
+
+const std::vector<types::ControllerInfo>& SectorControl::controllers(const Node* node) const {
+    if (&this->m_unicom == node)
+        return this->m_controllers.back();
+    return this->m_controllers[this->m_graph->index(node)];
+}
+
+void SectorControl::queryBorderIndex(SectorQuery& query, const Node* hint) const {
+    /* the raster around the airport provides the borders without a search */
+    std::span<const SectorGraph::RasterEntry> entries;
+    if (true == this->m_graph->queryRaster(query.position.coordinate(), entries)) {
+        for (const auto& entry : entries) {
+            if (entry.border.second->lowerAltitude() > query.position.altitude() || entry.border.second->upperAltitude() < query.position.altitude())
+                continue;
 
-                break;
-            }
+            if (true == entry.inside)
+                query.results.push_back(std::make_pair(entry.border.first, true));
+            else
+                query.candidates.push_back(entry.border);
         }
-    }
-
-    this->m_unicom->controllers.push_back(types::ControllerInfo());
-}
 
-SectorControl::~SectorControl() {
-    SectorControl::destroyNode(this->m_rootNode);
-    this->m_rootNode = nullptr;
-    this->m_ownSector = nullptr;
-    this->m_handoffs.clear();
-}
-
-void SectorControl::destroyNode(std::shared_ptr<Node>& node) {
-    if (nullptr == node)
         return;
-
-    for (auto& child : node->children)
-        SectorControl::destroyNode(child);
-
-    node->children.clear();
-}
-
-void SectorControl::insertNode(std::list<std::shared_ptr<Node>>& nodes, const types::Sector& sector) {
-    /* check if the sector is already a node */
-    bool alreadyRegistered = false;
-    for (const auto& node : std::as_const(nodes)) {
-        if (node->sector.controllerInfo().identifier() == sector.controllerInfo().identifier()) {
-            alreadyRegistered = true;
-            break;
-        }
     }
 
-    /* create the new node */
-    if (false == alreadyRegistered) {
-        std::shared_ptr<SectorControl::Node> node(new SectorControl::Node(sector));
-        nodes.push_back(node);
-    }
-}
-
-std::list<std::shared_ptr<SectorControl::Node>> SectorControl::findRelevantSectors(std::list<std::string>& deputies,
-                                                                                   const std::list<types::Sector>& sectors) {
-    std::list<std::shared_ptr<SectorControl::Node>> retval;
+    auto point = SectorGraph::indexPoint(query.position);
 
-    /* filter out the centers */
-    for (auto it = deputies.begin(); deputies.end() != it;) {
-        bool erased = false, found = false;
+    /* aircraft rarely leave the sector between two updates -> the borders around the last sector are sufficient */
+    if (nullptr != hint) {
+        this->m_graph->queryAdjacentBorders(point, hint, query.candidates);
+        if (true == SectorControl::isInsideSector(query, hint))
+            return;
 
-        for (const auto& sector : std::as_const(sectors)) {
-            if (*it == sector.controllerInfo().identifier()) {
-                found = true;
-                if (types::Sector::Type::Center == sector.type() || types::Sector::Type::FlightService == sector.type()) {
-                    it = deputies.erase(it);
-                    erased = true;
-                }
-                break;
+        /* check if the aircraft moved into one of the neighbors */
+        auto& neighbors = this->m_neighborBorders;
+        neighbors.clear();
+        neighbors.swap(query.candidates);
+        query.results.clear();
+
+        for (const auto& neighbor : std::as_const(neighbors)) {
+            if (hint != neighbor.first && true == neighbor.second->isInsideBorder(query.position)) {
+                query.results.push_back(std::make_pair(neighbor.first, true));
+                this->m_graph->queryAdjacentBorders(point, neighbor.first, query.candidates);
+                return;
             }
         }
-
-        if (false == found)
-            it = deputies.erase(it);
-        else if (false == erased)
-            ++it;
     }
 
-    /* create the nodes for all deputies */
-    std::string approachPrefix;
-    for (const auto& deputy : std::as_const(deputies)) {
-        for (const auto& sector : std::as_const(sectors)) {
-            if (sector.controllerInfo().identifier() == deputy) {
-                /* assume that all approaches have the same prefix */
-                if (types::Sector::Type::Approach == sector.type() && 0 == approachPrefix.length())
-                    approachPrefix = sector.controllerInfo().prefix();
-
-                if (types::Sector::Type::Approach == sector.type()) {
-                    if (approachPrefix == sector.controllerInfo().prefix())
-                        SectorControl::insertNode(retval, sector);
-                }
-                else {
-                    SectorControl::insertNode(retval, sector);
-                }
-            }
-            else if (0 != sector.borders().size()) {
-                auto it = std::find(sector.borders().front().deputies().cbegin(), sector.borders().front().deputies().cend(), deputy);
-                if (sector.borders().front().deputies().cend() != it) {
-                    if (types::Sector::Type::Approach == sector.type()) {
-                        if (approachPrefix == sector.controllerInfo().prefix())
-                            SectorControl::insertNode(retval, sector);
-                    }
-                    else {
-                        SectorControl::insertNode(retval, sector);
-                    }
-                }
-            }
-        }
-    }
-
-    return retval;
+    /* only the borders with a box around the position need the exact test */
+    this->m_graph->queryBorders(point, query.candidates);
 }
 
-std::list<std::list<std::shared_ptr<SectorControl::Node>>> SectorControl::linkSiblings(std::list<std::shared_ptr<Node>>& nodes) {
-    std::list<std::list<std::shared_ptr<SectorControl::Node>>> retval;
-
-    for (auto it = nodes.begin(); nodes.end() != it; ++it) {
-        if (0 != retval.size()) {
-            /* both sectors have the same type -> further analysis is needed */
-            if (retval.back().front()->sector.type() == (*it)->sector.type()) {
-                switch (retval.back().front()->sector.type()) {
-                case types::Sector::Type::Approach:
-                {
-                    /*
-                     * The idea is to differentiate the feeder from the pick up.
-                     * It is only possible by the analyzis of the highest controlled altitute.
-                     *
-                     * If the altitudes are comparable (max. 10% difference), they are the same.
-                     * In the end we get two or more approaches where the lowest approach is the feeder.
-                     */
-                    auto ratio = (retval.back().front()->sector.borders().back().upperAltitude() - (*it)->sector.borders().back().upperAltitude()) / (*it)->sector.borders().back().upperAltitude();
-                    if (-0.1 <= ratio.value() && 0.1 >= ratio.value())
-                        retval.back().push_back(*it);
-                    else
-                        retval.push_back({ *it });
-                    break;
-                }
-                case types::Sector::Type::Departure:
-                case types::Sector::Type::Tower:
-                case types::Sector::Type::Ground:
-                    /*
-                     * Assume that the link to the airport allows only one departure airspace
-                     * that can be splitted into multiple sectors.
-                     *
-                     * Assume that all siblings have the same prefix.
-                     */
-                    if (retval.back().front()->sector.controllerInfo().prefix() == (*it)->sector.controllerInfo().prefix())
-                        retval.back().push_back({ *it });
-                    else
-                        retval.push_back({ *it });
-                    break;
-                case types::Sector::Type::Delivery:
-                    retval.push_back({ *it });
-                    break;
-                default:
-                    break;
-                }
-            }
-            else if (types::Sector::Type::Departure == (*it)->sector.type()) {
-                retval.back().push_back(*it);
-            }
-            else {
-                retval.push_back({ *it });
-            }
-        }
-        else {
-            retval.push_back({ *it });
-        }
+bool SectorControl::isInsideSector(SectorQuery& query, const Node* node) {
+    /* the graph contains nodes with multiple parents -> test every node only once per position */
+    for (const auto& result : std::as_const(query.results)) {
+        if (result.first == node)
+            return result.second;
     }
 
-    return retval;
-}
-
-void SectorControl::createGraph(std::list<std::list<std::shared_ptr<Node>>>& siblings) {
-    std::list<std::shared_ptr<SectorControl::Node>> parents;
-
-    for (auto it = siblings.cbegin(); siblings.cend() != it; ++it) {
-        if (types::Sector::Type::Ground == it->front()->sector.type()) {
-            for (const auto& level : std::as_const(siblings)) {
-                if (types::Sector::Type::Tower == level.front()->sector.type() &&
-                    it->front()->sector.controllerInfo().prefix() == level.front()->sector.controllerInfo().prefix())
-                {
-                    for (auto& node : *it)
-                        node->parents = level;
-                    for (auto& node : level)
-                        node->children = *it;
-                }
-            }
-        }
-        else if (types::Sector::Type::Delivery == it->front()->sector.type()) {
-            for (const auto& level : std::as_const(siblings)) {
-                if (types::Sector::Type::Ground == level.front()->sector.type() &&
-                    it->front()->sector.controllerInfo().prefix() == level.front()->sector.controllerInfo().prefix())
-                {
-                    for (auto& node : *it)
-                        node->parents = level;
-                    for (auto& node : level)
-                        node->children = *it;
-                }
-            }
-        }
-        else {
-            for (auto& node : *it)
-                node->parents = parents;
-            for (auto& node : parents)
-                node->children.insert(node->children.end(), it->begin(), it->end());
-
-            if (types::Sector::Type::Tower < it->front()->sector.type())
-                parents = *it;
+    bool inside = false;
+    for (const auto& candidate : std::as_const(query.candidates)) {
+        if (candidate.first == node && true == candidate.second->isInsideBorder(query.position)) {
+            inside = true;
+            break;
         }
     }
-}
 
-void SectorControl::cleanupHandoffList(std::shared_ptr<SectorControl::Node>& node) {
-    if (0 == node->controllers.size()) {
-        for (auto it = this->m_handoffs.begin(); this->m_handoffs.end() != it;) {
-            if (it->second.nextSector == node)
-                it = this->m_handoffs.erase(it);
-            else
-                ++it;
-        }
-    }
+    query.results.push_back(std::make_pair(node, inside));
+    return inside;
 }
 
-std::shared_ptr<SectorControl::Node> SectorControl::findNode(const std::shared_ptr<Node>& node, const types::ControllerInfo& info) {
-    if (nullptr == node)
-        return nullptr;
-
-    /* test if the identifier matches */
-    if (node->sector.controllerInfo().identifier() == info.identifier())
-        return node;
-
-    /* test if the primary frequencies match and if the callsigns match */
-    if (node->sector.controllerInfo().primaryFrequency() == info.primaryFrequency()) {
-        if (node->sector.controllerInfo().prefix() == info.prefix() && node->sector.controllerInfo().suffix() == info.suffix())
-            return node;
-        else
-            return nullptr;
-    }
+SectorControl::~SectorControl() {
+    this->m_ownSector = nullptr;
+    this->m_handoffs.clear();
+}
 
-    for (const auto& child : std::as_const(node->children)) {
-        auto candidate = SectorControl::findNode(child, info);
-        if (nullptr != candidate)
-            return candidate;
+void SectorControl::cleanupHandoffList(const Node* node) {
+    if (0 == this->controllers(node).size()) {
+        this->m_handoffs.eraseIf([node](types::FlightId, const FlightData& data) {
+            return data.nextSector == node;
+        });
     }
-
-    return nullptr;
 }
 
 void SectorControl::controllerUpdate(const types::ControllerInfo& info) {
-    auto node = SectorControl::findNode(this->m_rootNode, info);
+    auto node = this->m_graph->findNode(info);
     if (nullptr != node) {
         auto assoc = this->m_sectorAssociations.find(info.callsign());
         if (this->m_sectorAssociations.cend() == assoc || assoc->second.identifier() != info.identifier()) {
             this->controllerOffline(info);
             this->m_sectorAssociations[info.callsign()] = info;
-            node->controllers.push_back(info);
+            this->controllers(node).push_back(info);
+            this->m_onlineStations.clear();
         }
     }
     else {
@@ -385,12 +155,14 @@ void SectorControl::controllerUpdate(const types::ControllerInfo& info) {
 void SectorControl::controllerOffline(const types::ControllerInfo& info) {
     auto assocIt = this->m_sectorAssociations.find(info.callsign());
     if (this->m_sectorAssociations.end() != assocIt) {
-        auto node = SectorControl::findNode(this->m_rootNode, assocIt->second);
+        auto node = this->m_graph->findNode(assocIt->second);
         if (nullptr != node) {
             /* remove the controller info */
-            for (auto it = node->controllers.begin(); node->controllers.end() != it; ++it) {
+            auto& controllers = this->controllers(node);
+            for (auto it = controllers.begin(); controllers.end() != it; ++it) {
                 if (it->callsign() == info.callsign()) {
-                    node->controllers.erase(it);
+                    controllers.erase(it);
+                    this->m_onlineStations.clear();
                     this->cleanupHandoffList(node);
                     break;
                 }
@@ -406,59 +178,35 @@ void SectorControl::setOwnSector(const types::ControllerInfo& info) {
     if (nullptr != this->m_ownSector && info.identifier() == this->m_ownSector->sector.controllerInfo().identifier())
         return;
 
-    auto newOwnSector = SectorControl::findNode(this->m_rootNode, info);
+    auto newOwnSector = this->m_graph->findNode(info);
     if (this->m_ownSector != newOwnSector)
         this->controllerOffline(info);
 
     this->m_ownSector = newOwnSector;
     if (nullptr != this->m_ownSector) {
         this->m_sectorAssociations[info.callsign()] = info;
-        this->m_ownSector->controllers.push_back(info);
-    }
-}
-
-std::shared_ptr<SectorControl::Node> SectorControl::findSectorInList(const std::list<std::shared_ptr<SectorControl::Node>>& nodes,
-                                                                     const types::Position& position,
-                                                                     types::Flight::Type type, bool lowerSectors) {
-    types::Sector::Type bestType = types::Sector::Type::Approach;
-
-    if (types::Flight::Type::Unknown == type) {
-        for (const auto& node : std::as_const(nodes)) {
-            if (true == node->sector.isInsideSector(position))
-                return node;
-        }
-    }
-    else if (types::Flight::Type::Departure == type && false == lowerSectors) {
-        bestType = types::Sector::Type::Departure;
+        this->controllers(this->m_ownSector).push_back(info);
+        this->m_onlineStations.clear();
     }
-
-    /* find the next responsible sector and priorize the correct sector type */
-    std::shared_ptr<SectorControl::Node> retval = nullptr;
-    for (const auto& node : std::as_const(nodes)) {
-        if (true == node->sector.isInsideSector(position)) {
-            if (nullptr == retval || node->sector.type() == bestType)
-                retval = node;
-        }
-    }
-
-    return retval;
 }
 
 const types::ControllerInfo& SectorControl::ownSector() const {
     if (nullptr == this->m_ownSector)
-        return this->m_unicom->sector.controllerInfo();
+        return this->m_unicom.sector.controllerInfo();
     else
         return this->m_ownSector->sector.controllerInfo();
 }
 
-std::shared_ptr<SectorControl::Node> SectorControl::findOnlineResponsible(const types::Flight& flight,
-                                                                          types::Flight::Type type,
-                                                                          const types::Position& position,
-                                                                          bool ignoreClearanceFlag) const {
-    std::list<std::shared_ptr<Node>> candidates;
+const SectorControl::Node* SectorControl::findOnlineResponsible(const types::Flight& flight,
+                                                                types::Flight::Type type,
+                                                                SectorQuery& query,
+                                                                bool ignoreClearanceFlag) const {
+    /* the scratch buffer keeps its capacity between the queries */
+    auto& candidates = this->m_responsibleCandidates;
+    candidates.clear();
 
-    for (const auto& parent : std::as_const(this->m_ownSector->parents)) {
-        auto candidate = SectorControl::findLowestSector(parent, flight, position, type, ignoreClearanceFlag);
+    for (const auto& parent : this->m_graph->parents(this->m_ownSector)) {
+        auto candidate = this->findLowestSector(&this->m_graph->nodes()[parent], flight, query, type, ignoreClearanceFlag);
         if (nullptr != candidate) {
             candidates.push_back(candidate);
 
@@ -471,7 +219,7 @@ std::shared_ptr<SectorControl::Node> SectorControl::findOnlineResponsible(const
     if (0 == candidates.size())
         return nullptr;
 
-    std::shared_ptr<Node> node = candidates.front();
+    const Node* node = candidates.front();
 
     /* check if a departure or an approach is more helpful */
     if (1 < candidates.size()) {
@@ -489,42 +237,52 @@ std::shared_ptr<SectorControl::Node> SectorControl::findOnlineResponsible(const
 
     /* avoid wrong calls */
     if (nullptr == node)
-        return this->m_unicom;
+        return &this->m_unicom;
+
+    return this->findOnlineStation(node);
+}
+
+const SectorControl::Node* SectorControl::findOnlineStation(const Node* node) const {
+    /* the online station changes only if a controller connects or disconnects */
+    auto it = this->m_onlineStations.find(node);
+    if (this->m_onlineStations.cend() != it)
+        return it->second;
+
+    auto station = this->resolveOnlineStation(node);
+    this->m_onlineStations[node] = station;
+    return station;
+}
 
+const SectorControl::Node* SectorControl::resolveOnlineStation(const Node* node) const {
     /* this is the next online station */
-    if (0 != node->controllers.size())
+    if (0 != this->controllers(node).size())
         return node;
 
     /* check which deputy is online */
     for (const auto& deputy : std::as_const(node->sector.borders().front().deputies())) {
-        ControllerInfo deputyInfo(deputy, "", "", "");
-
-        auto deputyNode = SectorControl::findNode(this->m_rootNode, deputyInfo);
-        if (nullptr != deputyNode && 0 != deputyNode->controllers.size())
+        auto deputyNode = this->m_graph->findNode(deputy);
+        if (nullptr != deputyNode && 0 != this->controllers(deputyNode).size())
             return deputyNode;
 
         /* some deliveries do not have the complete deputy-hierarchy -> check the deputies of the deputies */
-        if (types::Sector::Type::Delivery == node->sector.type()) {
+        if (nullptr != deputyNode && types::Sector::Type::Delivery == node->sector.type()) {
             for (const auto& depDeputy : std::as_const(deputyNode->sector.borders().front().deputies())) {
-                ControllerInfo depDeputyInfo(depDeputy, "", "", "");
-
-                auto secondStageNode = SectorControl::findNode(this->m_rootNode, depDeputyInfo);
-                if (nullptr != secondStageNode && 0 != secondStageNode->controllers.size())
+                auto secondStageNode = this->m_graph->findNode(depDeputy);
+                if (nullptr != secondStageNode && 0 != this->controllers(secondStageNode).size())
                     return secondStageNode;
             }
         }
     }
 
     /* no other real station is online */
-    return this->m_unicom;
+    return &this->m_unicom;
 }
 
-std::shared_ptr<SectorControl::Node> SectorControl::findLowestSector(const std::shared_ptr<SectorControl::Node>& node,
-                                                                     const types::Flight& flight, const types::Position& position,
-                                                                     types::Flight::Type type, bool ignoreClearanceFlag) {
+const SectorControl::Node* SectorControl::findLowestSector(const Node* node, const types::Flight& flight, SectorQuery& query,
+                                                           types::Flight::Type type, bool ignoreClearanceFlag) const {
     /* check the children */
-    for (const auto& child : std::as_const(node->children)) {
-        auto retval = SectorControl::findLowestSector(child, flight, position, type, ignoreClearanceFlag);
+    for (const auto& child : this->m_graph->children(node)) {
+        auto retval = this->findLowestSector(&this->m_graph->nodes()[child], flight, query, type, ignoreClearanceFlag);
         if (nullptr != retval) {
             /* non-departures do not go to the delivery */
             if (types::Flight::Type::Departure != type && types::Sector::Type::Delivery == retval->sector.type())
@@ -539,183 +297,222 @@ std::shared_ptr<SectorControl::Node> SectorControl::findLowestSector(const std::
     }
 
     /* check the node itself */
-    if (true == node->sector.isInsideSector(position))
+    if (true == SectorControl::isInsideSector(query, node))
         return node;
 
     return nullptr;
 }
 
-bool SectorControl::isInOwnSectors(const types::Flight& flight, const types::Position& position,
+bool SectorControl::isInOwnSectors(const types::Flight& flight, SectorQuery& query,
                                    types::Flight::Type type, bool ignoreClearanceFlag) const {
-    auto node = this->findOnlineResponsible(flight, type, position, ignoreClearanceFlag);
+    auto node = this->findOnlineResponsible(flight, type, query, ignoreClearanceFlag);
     if (nullptr == node)
         return false;
 
     return this->m_ownSector == node && nullptr != this->m_ownSector;
 }
 
+bool SectorControl::remainsInsideBorders(const types::Flight& flight, const types::Length& distance, const types::Length& altitude) {
+    auto& clearance = this->m_clearancesOfFlights[flight.id()];
+    if (true == SectorGraph::isInsideClearance(clearance, flight.currentPosition(), distance, altitude))
+        return true;
+
+    /* the borders are close to the flight -> check them again after the flight moved by one prediction */
+    if (0.0f != clearance.northScale && distance > SectorGraph::distanceToCenter(clearance, flight.currentPosition().coordinate()))
+        return false;
+
+    clearance = this->m_graph->borderClearance(flight.currentPosition(), __clearanceHorizons * distance);
+    return SectorGraph::isInsideClearance(clearance, flight.currentPosition(), distance, altitude);
+}
+
 void SectorControl::updateFlight(const types::Flight& flight, types::Flight::Type type) {
-    if (nullptr == this->m_rootNode || nullptr == this->m_ownSector)
+    system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::SectorControl);
+
+    if (nullptr == this->m_graph->root() || nullptr == this->m_ownSector)
         return;
 
     /* check if the handoff is initiated or manually changed */
     bool manuallyChanged = false, handoffDone = false;
-    auto it = this->m_handoffs.find(flight.callsign());
-    if (this->m_handoffs.end() != it && (true == it->second.manuallyChanged || true == it->second.handoffPerformed)) {
-        manuallyChanged = it->second.manuallyChanged;
-        handoffDone = it->second.handoffPerformed;
+    auto handoff = this->m_handoffs.find(flight.id());
+    if (nullptr != handoff && (true == handoff->manuallyChanged || true == handoff->handoffPerformed)) {
+        manuallyChanged = handoff->manuallyChanged;
+        handoffDone = handoff->handoffPerformed;
     }
 
     /* get current sector of the flight */
-    this->m_sectorsOfFlights[flight.callsign()] = this->findLowestSector(this->m_rootNode, flight, flight.currentPosition(), type, false);
-    if (nullptr == this->m_sectorsOfFlights[flight.callsign()])
-        this->m_sectorsOfFlights.erase(flight.callsign());
+    auto& sectorOfFlight = this->m_sectorsOfFlights[flight.id()];
+    auto& current = this->m_currentQuery;
+    current.reset(flight.currentPosition());
+    this->queryBorderIndex(current, sectorOfFlight);
+    sectorOfFlight = this->findLowestSector(this->m_graph->root(), flight, current, type, false);
+    const Node* currentSector = sectorOfFlight;
+    if (nullptr == currentSector)
+        this->m_sectorsOfFlights.erase(flight.id());
 
     bool ignoreClearanceFlag = types::Sector::Type::Delivery == this->m_ownSector->sector.type();
-    bool insideOwnBorder = this->isInOwnSectors(flight, flight.currentPosition(), type, ignoreClearanceFlag);
+    bool insideOwnBorder = this->isInOwnSectors(flight, current, type, ignoreClearanceFlag);
     if (false == manuallyChanged && false == handoffDone && (true == insideOwnBorder || true == flight.isTracked()))
     {
-        types::Position predicted;
+        types::Time horizon;
+        types::Velocity minGroundSpeed;
 
         /* use the exactly same position, but change the evaluation of the clearance flag */
-        if (types::Sector::Type::Delivery == this->m_ownSector->sector.type())
-            predicted = flight.currentPosition();
+        if (types::Sector::Type::Delivery == this->m_ownSector->sector.type()) {
+            horizon = 0_s;
+            minGroundSpeed = 0_kn;
+        }
         /* the flight is moving on the ground -> predict only 10 seconds */
-        else if (40_kn > flight.groundSpeed())
-            predicted = flight.predict(10_s, 20_kn);
+        else if (40_kn > flight.groundSpeed()) {
+            horizon = 10_s;
+            minGroundSpeed = 20_kn;
+        }
         /* the flight is assumed to be in the air */
-        else
-            predicted = flight.predict(20_s, flight.groundSpeed());
+        else {
+            horizon = 20_s;
+            minGroundSpeed = flight.groundSpeed();
+        }
 
         /* get the handoff initiator to avoid rehandoffs if we received an early handoff */
-        auto handoffIt = this->m_handoffOfFlightsToMe.find(flight.callsign());
+        auto handoffToMe = this->m_handoffOfFlightsToMe.find(flight.id());
         if (false == insideOwnBorder) {
-            if (this->m_handoffOfFlightsToMe.end() == handoffIt) {
-                this->m_handoffOfFlightsToMe[flight.callsign()] = flight.handoffInitiatedId();
-                handoffIt = this->m_handoffOfFlightsToMe.find(flight.callsign());
+            if (nullptr == handoffToMe) {
+                handoffToMe = &this->m_handoffOfFlightsToMe[flight.id()];
+                *handoffToMe = flight.handoffInitiatedId();
             }
         }
         /* delete the handoff tracker if the flight is in our sector */
-        else if (this->m_handoffOfFlightsToMe.end() != handoffIt) {
-            this->m_handoffOfFlightsToMe.erase(handoffIt);
-            handoffIt = this->m_handoffOfFlightsToMe.end();
+        else if (nullptr != handoffToMe) {
+            this->m_handoffOfFlightsToMe.erase(flight.id());
+            handoffToMe = nullptr;
+        }
+
+        /* the prediction uses the borders of the current position as long as the flight does not cross a border before */
+        SectorQuery* prediction = &current;
+        if (0_s != horizon) {
+            auto distance = (minGroundSpeed > flight.groundSpeed() ? minGroundSpeed : flight.groundSpeed()) * horizon;
+            auto altitude = flight.currentPosition().altitude() + flight.verticalSpeed() * horizon;
+            if (0_m > altitude)
+                altitude = 0_m;
+
+            if (false == this->remainsInsideBorders(flight, distance, altitude)) {
+                this->m_predictedQuery.reset(flight.predict(horizon, minGroundSpeed));
+                this->queryBorderIndex(this->m_predictedQuery, currentSector);
+                prediction = &this->m_predictedQuery;
+            }
         }
 
         /* the aircraft remains in own sector */
-        if (true == this->isInOwnSectors(flight, predicted, type, false)) {
+        if (true == this->isInOwnSectors(flight, *prediction, type, false)) {
             /* check if an old handoff exists */
-            it = this->m_handoffs.find(flight.callsign());
-            if (this->m_handoffs.end() != it)
-                this->m_handoffs.erase(it);
+            this->m_handoffs.erase(flight.id());
             return;
         }
 
         /* get the next responsible node and the next online station */
-        auto nextNode = this->findOnlineResponsible(flight, type, predicted, false);
+        auto nextNode = this->findOnlineResponsible(flight, type, *prediction, false);
 
         /* found a possible handoff candidate */
         if (nullptr != nextNode && nextNode != this->m_ownSector) {
             /* give the flight to an other sector */
-            if (this->m_handoffOfFlightsToMe.end() == handoffIt || handoffIt->second != nextNode->sector.controllerInfo().identifier()) {
-                this->m_handoffs[flight.callsign()] = FlightData(flight, nextNode);
+            if (nullptr == handoffToMe || *handoffToMe != nextNode->sector.controllerInfo().identifier()) {
+                this->m_handoffs[flight.id()] = FlightData(nextNode);
             }
             /* delete the old entry, because of a new controller */
-            else if (this->m_handoffOfFlightsToMe.end() != handoffIt && handoffIt->second == nextNode->sector.controllerInfo().identifier()) {
-                auto hIt = this->m_handoffs.find(flight.callsign());
-                if (this->m_handoffs.end() != hIt)
-                    this->m_handoffs.erase(hIt);
+            else if (nullptr != handoffToMe && *handoffToMe == nextNode->sector.controllerInfo().identifier()) {
+                this->m_handoffs.erase(flight.id());
             }
         }
     }
     /* check if we have to remove the handoff information */
-    else if (this->m_handoffs.end() != it && true == it->second.handoffPerformed) {
+    else if (nullptr != handoff && true == handoff->handoffPerformed) {
         /* find the current online controller but ignore the clearance flag to avoid too early deletions, if Delivery is online */
-        auto currentNode = this->findOnlineResponsible(flight, type, flight.currentPosition(), ignoreClearanceFlag);
+        auto currentNode = this->findOnlineResponsible(flight, type, current, ignoreClearanceFlag);
 
         /* check if an other controller is responsible */
         if (currentNode != this->m_ownSector && false == flight.isTracked())
-            this->m_handoffs.erase(it);
+            this->m_handoffs.erase(flight.id());
     }
 }
 
-void SectorControl::removeFlight(const std::string& callsign) {
-    auto it = this->m_handoffs.find(callsign);
-    if (this->m_handoffs.end() != it)
-        this->m_handoffs.erase(it);
-
-    auto sit = this->m_sectorsOfFlights.find(callsign);
-    if (this->m_sectorsOfFlights.end() != sit)
-        this->m_sectorsOfFlights.erase(sit);
-
-    auto hit = this->m_handoffOfFlightsToMe.find(callsign);
-    if (this->m_handoffOfFlightsToMe.end() != hit)
-        this->m_handoffOfFlightsToMe.erase(hit);
+void SectorControl::removeFlight(types::FlightId id) {
+    this->m_handoffs.erase(id);
+    this->m_sectorsOfFlights.erase(id);
+    this->m_handoffOfFlightsToMe.erase(id);
+    this->m_clearancesOfFlights.erase(id);
 }
 
 bool SectorControl::isInOwnSector(const types::Flight& flight, types::Flight::Type type) {
-    auto it = this->m_sectorsOfFlights.find(flight.callsign());
+    auto sectorOfFlight = this->m_sectorsOfFlights.find(flight.id());
 
-    if (this->m_sectorsOfFlights.cend() != it) {
-        if (it->second == this->m_ownSector)
+    if (nullptr != sectorOfFlight) {
+        if (*sectorOfFlight == this->m_ownSector)
             return true;
 
-        return this->isInOwnSectors(flight, flight.currentPosition(), type, false);
+        auto& query = this->m_currentQuery;
+        query.reset(flight.currentPosition());
+        this->queryBorderIndex(query, *sectorOfFlight);
+        return this->isInOwnSectors(flight, query, type, false);
     }
 
     return false;
 }
 
 bool SectorControl::handoffRequired(const types::Flight& flight) const {
-    auto it = this->m_handoffs.find(flight.callsign());
-    if (this->m_handoffs.cend() != it)
-        return false == it->second.handoffPerformed;
+    auto handoff = this->m_handoffs.find(flight.id());
+    if (nullptr != handoff)
+        return false == handoff->handoffPerformed;
     return false;
 }
 
 bool SectorControl::handoffRequired(const std::string& callsign) const {
-    auto it = this->m_handoffs.find(callsign);
-    if (this->m_handoffs.cend() != it)
-        return false == it->second.handoffPerformed;
+    auto handoff = this->m_handoffs.find(types::CallsignTable::instance().find(callsign));
+    if (nullptr != handoff)
+        return false == handoff->handoffPerformed;
     return false;
 }
 
 bool SectorControl::handoffPossible(const types::Flight& flight, types::Flight::Type type) const {
-    if (nullptr == this->m_rootNode || nullptr == this->m_ownSector)
+    if (nullptr == this->m_graph->root() || nullptr == this->m_ownSector)
         return false;
 
-    bool inOwnSector = this->isInOwnSectors(flight, flight.currentPosition(), type, false);
+    auto sectorOfFlight = this->m_sectorsOfFlights.find(flight.id());
+    auto& query = this->m_currentQuery;
+    query.reset(flight.currentPosition());
+    this->queryBorderIndex(query, nullptr != sectorOfFlight ? *sectorOfFlight : nullptr);
+
+    bool inOwnSector = this->isInOwnSectors(flight, query, type, false);
     return true == inOwnSector || true == flight.isTracked();
 }
 
 void SectorControl::handoffPerformed(const types::Flight& flight) {
-    auto it = this->m_handoffs.find(flight.callsign());
-    if (this->m_handoffs.end() != it)
-        it->second.handoffPerformed = true;
+    auto handoff = this->m_handoffs.find(flight.id());
+    if (nullptr != handoff)
+        handoff->handoffPerformed = true;
 }
 
 const types::ControllerInfo& SectorControl::handoffSector(const types::Flight& flight) const {
-    auto it = this->m_handoffs.find(flight.callsign());
-    if (this->m_handoffs.cend() == it)
-        return this->m_unicom->sector.controllerInfo();
+    auto handoff = this->m_handoffs.find(flight.id());
+    if (nullptr == handoff)
+        return this->m_unicom.sector.controllerInfo();
 
-    return it->second.nextSector->sector.controllerInfo();
+    return handoff->nextSector->sector.controllerInfo();
 }
 
 const types::ControllerInfo& SectorControl::handoffSector(const std::string& callsign) const {
-    auto it = this->m_handoffs.find(callsign);
-    if (this->m_handoffs.cend() == it)
-        return this->m_unicom->sector.controllerInfo();
+    auto handoff = this->m_handoffs.find(types::CallsignTable::instance().find(callsign));
+    if (nullptr == handoff)
+        return this->m_unicom.sector.controllerInfo();
 
-    return it->second.nextSector->sector.controllerInfo();
+    return handoff->nextSector->sector.controllerInfo();
 }
 
 std::list<std::string> SectorControl::handoffStations(const types::Flight& flight) const {
-    auto it = this->m_handoffs.find(flight.callsign());
+    auto handoff = this->m_handoffs.find(flight.id());
     std::list<std::string> retval;
-    if (this->m_handoffs.cend() == it)
+    if (nullptr == handoff)
         return retval;
 
-    for (const auto& controller : std::as_const(it->second.nextSector->controllers)) {
+    for (const auto& controller : std::as_const(this->controllers(handoff->nextSector))) {
         if (0 != controller.prefix().size())
             retval.push_back(controller.callsign());
         else
@@ -725,32 +522,18 @@ std::list<std::string> SectorControl::handoffStations(const types::Flight& fligh
     return retval;
 }
 
-std::list<std::shared_ptr<SectorControl::Node>> SectorControl::findSectorCandidates(const std::shared_ptr<SectorControl::Node>& node) const {
-    std::list<std::shared_ptr<SectorControl::Node>> retval;
-
-    if (this->m_ownSector != node && 0 != node->controllers.size())
-        retval.push_back(node);
-
-    for (const auto& child : std::as_const(node->children))
-        retval.splice(retval.end(), this->findSectorCandidates(child));
-
-    return retval;
-}
-
 std::list<types::ControllerInfo> SectorControl::handoffSectors() const {
     std::list<types::ControllerInfo> retval;
+    std::vector<const Node*> nodes;
 
-    auto nodes = this->findSectorCandidates(this->m_rootNode);
-
-    /* erase duplicates */
-    nodes.sort([](const std::shared_ptr<SectorControl::Node>& node0, const std::shared_ptr<SectorControl::Node>& node1) {
-        return node0 < node1;
-    });
-    auto last = std::unique(nodes.begin(), nodes.end());
-    nodes.erase(last, nodes.end());
+    /* every sector of the graph is stored once */
+    for (const auto& node : std::as_const(this->m_graph->nodes())) {
+        if (this->m_ownSector != &node && 0 != this->controllers(&node).size())
+            nodes.push_back(&node);
+    }
 
     /* sort based on type */
-    nodes.sort([](const std::shared_ptr<SectorControl::Node>& node0, const std::shared_ptr<SectorControl::Node>& node1) {
+    std::stable_sort(nodes.begin(), nodes.end(), [](const Node* node0, const Node* node1) {
         return node0->sector.type() > node1->sector.type();
     });
 
@@ -761,25 +544,24 @@ std::list<types::ControllerInfo> SectorControl::handoffSectors() const {
 }
 
 void SectorControl::handoffSectorSelect(const types::Flight& flight, const std::string& identifier) {
-    ControllerInfo info(identifier, "", "", "");
-    auto node = SectorControl::findNode(this->m_rootNode, info);
+    auto node = this->m_graph->findNode(identifier);
     if (nullptr == node)
         return;
 
-    auto it = this->m_handoffs.find(flight.callsign());
-    if (this->m_handoffs.end() == it) {
-        this->m_handoffs[flight.callsign()] = FlightData(flight, nullptr);
-        it = this->m_handoffs.find(flight.callsign());
+    auto handoff = this->m_handoffs.find(flight.id());
+    if (nullptr == handoff) {
+        handoff = &this->m_handoffs[flight.id()];
+        *handoff = FlightData(nullptr);
     }
 
-    it->second.manuallyChanged = true;
-    it->second.handoffPerformed = false;
-    it->second.nextSector = node;
+    handoff->manuallyChanged = true;
+    handoff->handoffPerformed = false;
+    handoff->nextSector = node;
 }
 
 bool SectorControl::sectorHandoverPossible() const {
-    if (nullptr != this->m_rootNode && nullptr != this->m_ownSector)
-        return 1 < this->m_ownSector->controllers.size();
+    if (nullptr != this->m_graph->root() && nullptr != this->m_ownSector)
+        return 1 < this->controllers(this->m_ownSector).size();
     else
         return false;
 }
@@ -787,8 +569,8 @@ bool SectorControl::sectorHandoverPossible() const {
 std::list<types::ControllerInfo> SectorControl::sectorHandoverCandidates() const {
     std::list<types::ControllerInfo> retval;
 
-    if (nullptr != this->m_rootNode && nullptr != this->m_ownSector) {
-        for (const auto& controller : std::as_const(this->m_ownSector->controllers))
+    if (nullptr != this->m_graph->root() && nullptr != this->m_ownSector) {
+        for (const auto& controller : std::as_const(this->controllers(this->m_ownSector)))
             retval.push_back(controller);
     }
 
@@ -796,31 +578,9 @@ std::list<types::ControllerInfo> SectorControl::sectorHandoverCandidates() const
 }
 
 bool SectorControl::isInSector(const types::Flight& flight) const {
-    auto it = this->m_sectorsOfFlights.find(flight.callsign());
-    if (this->m_sectorsOfFlights.cend() != it && nullptr != it->second)
+    auto sectorOfFlight = this->m_sectorsOfFlights.find(flight.id());
+    if (nullptr != sectorOfFlight && nullptr != *sectorOfFlight)
         return true;
     else
         return false;
 }
-
-std::list<types::ControllerInfo> SectorControl::findOnlineControllers(const std::shared_ptr<Node>& node) const {
-    std::list<types::ControllerInfo> retval;
-
-    for (const auto& child : std::as_const(node->children)) {
-        auto children = this->findOnlineControllers(child);
-
-        for (const auto& elem : std::as_const(children)) {
-            auto it = std::find(retval.cbegin(), retval.cend(), elem);
-            if (retval.cend() == it)
-                retval.push_back(elem);
-        }
-    }
-
-    for (const auto& controller : std::as_const(node->controllers)) {
-        auto it = std::find(retval.cbegin(), retval.cend(), controller);
-        if (retval.cend() == it)
-            retval.push_back(controller);
-    }
-
-    return retval;
-}
@@ -0,0 +1,792 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the immutable sector graph
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <mutex>
+
+#include <helper/Exception.h>
+#include <helper/PerformanceCounter.h>
+#include <management/SectorGraph.h>
+
+using namespace topskytower;
+using namespace topskytower::management;
+using namespace topskytower::types;
+
+/* the raster covers 20 NM around the airport with cells of one NM */
+static constexpr float __rasterRange = 20.0f;
+static constexpr float __rasterResolution = 1.0f;
+static constexpr float __rasterMargin = 1e-5f;
+
+/* the clearance keeps 50 m and one percent of the radius to the edges to cover the approximation of the plane */
+static constexpr float __clearanceMargin = 50.0f;
+static constexpr float __clearanceScale = 0.99f;
+
+/* the graphs that are shared between the users of the same key */
+static std::mutex __sharedGraphsLock;
+static std::map<std::string, std::weak_ptr<const SectorGraph>> __sharedGraphs;
+
+SectorGraph::SectorGraph() :
+        m_nodes(),
+        m_links(),
+        m_nodesByIdentifier(),
+        m_nodesByFrequency(),
+        m_indexedBorders(),
+        m_borderIndex(),
+        m_rasterOrigin{ 0.0f, 0.0f },
+        m_rasterStep{ 0.0f, 0.0f },
+        m_rasterColumns(0),
+        m_rasterRows(0),
+        m_rasterOffsets(),
+        m_rasterEntries() { }
+
+SectorGraph::SectorGraph(const std::string& airport, const std::list<types::Sector>& sectors) :
+        m_nodes(),
+        m_links(),
+        m_nodesByIdentifier(),
+        m_nodesByFrequency(),
+        m_indexedBorders(),
+        m_borderIndex(),
+        m_rasterOrigin{ 0.0f, 0.0f },
+        m_rasterStep{ 0.0f, 0.0f },
+        m_rasterColumns(0),
+        m_rasterRows(0),
+        m_rasterOffsets(),
+        m_rasterEntries() {
+    std::list<types::Sector> airportSectors;
+
+    /* find the tower sectors of the airport */
+    for (const auto& sector : std::as_const(sectors)) {
+        if (airport == sector.controllerInfo().prefix()) {
+            switch (sector.type()) {
+            case types::Sector::Type::Tower:
+            case types::Sector::Type::Ground:
+            case types::Sector::Type::Delivery:
+                airportSectors.push_back(sector);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    /* find all deputies of the airport that are not other airport sectors */
+    std::list<std::string> deputies;
+    for (const auto& tower : std::as_const(airportSectors)) {
+        for (const auto& border : std::as_const(tower.borders())) {
+            for (const auto& deputy : std::as_const(border.deputies())) {
+                /* check if the deputy is an other airport sector */
+                bool isAirportSector = false;
+                for (const auto& other : std::as_const(airportSectors)) {
+                    if (other.controllerInfo().identifier() == deputy) {
+                        isAirportSector = true;
+                        break;
+                    }
+                }
+
+                /* check if the deputy is known and that it is not an other airport sector */
+                if (false == isAirportSector && deputies.cend() == std::find(deputies.cbegin(), deputies.cend(), deputy))
+                    deputies.push_back(deputy);
+            }
+        }
+    }
+
+    /* get all relevant sectors and sort them in a top-down order */
+    auto sortedSectors(sectors);
+    sortedSectors.sort([](const types::Sector& sector0, const types::Sector& sector1) {
+        if (sector0.type() != sector1.type())
+            return sector0.type() > sector1.type();
+        else if (0 == sector0.borders().size() || 0 == sector1.borders().size())
+            return sector0.borders().size() > sector1.borders().size();
+        else
+            return sector0.borders().back().upperAltitude() > sector1.borders().back().upperAltitude();
+    });
+    auto nodes = SectorGraph::findRelevantSectors(deputies, sortedSectors);
+    for (const auto& sector : std::as_const(airportSectors))
+        SectorGraph::insertNode(nodes, sector);
+
+    /* sort the sectors from upper to lower airspaces */
+    nodes.sort([](const std::shared_ptr<SectorGraph::GraphNode>& node0, const std::shared_ptr<SectorGraph::GraphNode>& node1) {
+        /* ensure that all types are equal */
+        if (node0->sector.type() != node1->sector.type())
+            return node0->sector.type() > node1->sector.type();
+        /* ensure that the siblings are sorted together */
+        else if (node0->sector.controllerInfo().prefix() != node1->sector.controllerInfo().prefix())
+            return node0->sector.controllerInfo().prefix() > node1->sector.controllerInfo().prefix();
+        /* ensure that the sector without borders is lower */
+        else if (0 == node0->sector.borders().size() || node1->sector.borders().size())
+            return node0->sector.borders().size() > node1->sector.borders().size();
+        /* ensure that the upper levels are above */
+        else
+            return node0->sector.borders().back().upperAltitude() > node1->sector.borders().back().upperAltitude();
+    });
+
+    /* create all relevant siblings */
+    auto siblings = SectorGraph::linkSiblings(nodes);
+
+    /* create the final graph */
+    SectorGraph::createGraph(siblings);
+
+    /* add the centers of the top-level to get the complete hierarchy */
+    std::shared_ptr<GraphNode> root;
+    for (const auto& deputy : std::as_const(siblings.front().front()->sector.borders().front().deputies())) {
+        for (const auto& sector : std::as_const(sectors)) {
+            /* found the correct deputy */
+            if (sector.controllerInfo().identifier() == deputy) {
+                std::shared_ptr<GraphNode> node(new GraphNode(sector));
+
+                if (nullptr == root) {
+                    node->children = siblings.front();
+
+                    for (auto& sibling : siblings.front())
+                        sibling->parents.push_back(node);
+                }
+                else {
+                    root->parents.push_back(node);
+                    node->children.push_back(root);
+                }
+
+                root = node;
+
+                break;
+            }
+        }
+    }
+
+    /* store the graph in contiguous arrays and release the shared nodes of the construction */
+    this->flattenGraph(root);
+    SectorGraph::destroyNode(root);
+
+    this->buildIndexes();
+    this->buildRaster();
+}
+
+SectorGraph::SectorGraph(helper::BinaryReader& reader) :
+        m_nodes(),
+        m_links(),
+        m_nodesByIdentifier(),
+        m_nodesByFrequency(),
+        m_indexedBorders(),
+        m_borderIndex(),
+        m_rasterOrigin{ 0.0f, 0.0f },
+        m_rasterStep{ 0.0f, 0.0f },
+        m_rasterColumns(0),
+        m_rasterRows(0),
+        m_rasterOffsets(),
+        m_rasterEntries() {
+    auto count = reader.read<std::uint32_t>();
+    this->m_nodes.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        Node node{ types::Sector(reader) };
+
+        node.parentsBegin = reader.read<std::uint32_t>();
+        node.parentsEnd = reader.read<std::uint32_t>();
+        node.childrenBegin = reader.read<std::uint32_t>();
+        node.childrenEnd = reader.read<std::uint32_t>();
+
+        this->m_nodes.push_back(std::move(node));
+    }
+
+    count = reader.read<std::uint32_t>();
+    this->m_links.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+        this->m_links.push_back(reader.read<std::uint32_t>());
+
+    /* reject graphs that refer to unknown nodes or links */
+    for (const auto& node : std::as_const(this->m_nodes)) {
+        if (node.parentsBegin > node.parentsEnd || node.parentsEnd > this->m_links.size() ||
+            node.childrenBegin > node.childrenEnd || node.childrenEnd > this->m_links.size())
+        {
+            throw helper::Exception("SectorGraph", "Invalid links in the serialized sector graph");
+        }
+    }
+    for (const auto& link : std::as_const(this->m_links)) {
+        if (link >= this->m_nodes.size())
+            throw helper::Exception("SectorGraph", "Invalid links in the serialized sector graph");
+    }
+
+    this->buildIndexes();
+    this->buildRaster();
+}
+
+std::shared_ptr<const SectorGraph> SectorGraph::shared(const std::string& key,
+                                                       const std::function<std::shared_ptr<const SectorGraph>()>& create) {
+    std::lock_guard guard(__sharedGraphsLock);
+
+    /* forget the graphs that are released by all users */
+    for (auto it = __sharedGraphs.begin(); __sharedGraphs.end() != it;) {
+        if (true == it->second.expired())
+            it = __sharedGraphs.erase(it);
+        else
+            ++it;
+    }
+
+    auto graph = __sharedGraphs[key].lock();
+    if (nullptr == graph) {
+        graph = create();
+        __sharedGraphs[key] = graph;
+    }
+
+    return graph;
+}
+
+std::shared_ptr<const SectorGraph> SectorGraph::find(const std::string& key) {
+    std::lock_guard guard(__sharedGraphsLock);
+
+    auto it = __sharedGraphs.find(key);
+    if (__sharedGraphs.cend() == it)
+        return nullptr;
+
+    return it->second.lock();
+}
+
+const std::vector<SectorGraph::Node>& SectorGraph::nodes() const {
+    return this->m_nodes;
+}
+
+const SectorGraph::Node* SectorGraph::root() const {
+    if (0 != this->m_nodes.size())
+        return &this->m_nodes.front();
+    return nullptr;
+}
+
+std::size_t SectorGraph::index(const Node* node) const {
+    return static_cast<std::size_t>(node - this->m_nodes.data());
+}
+
+std::span<const std::uint32_t> SectorGraph::parents(const Node* node) const {
+    return std::span<const std::uint32_t>(this->m_links.data() + node->parentsBegin, node->parentsEnd - node->parentsBegin);
+}
+
+std::span<const std::uint32_t> SectorGraph::children(const Node* node) const {
+    return std::span<const std::uint32_t>(this->m_links.data() + node->childrenBegin, node->childrenEnd - node->childrenBegin);
+}
+
+void SectorGraph::flattenGraph(const std::shared_ptr<GraphNode>& root) {
+    std::list<std::shared_ptr<GraphNode>> pending = { root };
+    std::unordered_map<const GraphNode*, std::uint32_t> indices;
+    std::vector<const GraphNode*> nodes;
+
+    /* number the nodes from the top to the bottom and visit nodes with multiple parents only once */
+    while (0 != pending.size()) {
+        auto node = pending.front();
+        pending.pop_front();
+
+        if (nullptr == node || indices.cend() != indices.find(node.get()))
+            continue;
+
+        indices[node.get()] = static_cast<std::uint32_t>(nodes.size());
+        nodes.push_back(node.get());
+        pending.insert(pending.end(), node->children.cbegin(), node->children.cend());
+    }
+
+    /* the graph is not modified afterwards -> the nodes keep their addresses */
+    this->m_nodes.reserve(nodes.size());
+    for (const auto& node : std::as_const(nodes)) {
+        Node flat(node->sector);
+
+        /* the links keep the order of the graph, because the searches priorize the first matching sector */
+        flat.parentsBegin = static_cast<std::uint32_t>(this->m_links.size());
+        for (const auto& parent : std::as_const(node->parents)) {
+            auto it = indices.find(parent.get());
+            if (indices.cend() != it)
+                this->m_links.push_back(it->second);
+        }
+        flat.parentsEnd = static_cast<std::uint32_t>(this->m_links.size());
+
+        flat.childrenBegin = static_cast<std::uint32_t>(this->m_links.size());
+        for (const auto& child : std::as_const(node->children))
+            this->m_links.push_back(indices[child.get()]);
+        flat.childrenEnd = static_cast<std::uint32_t>(this->m_links.size());
+
+        this->m_nodes.push_back(std::move(flat));
+    }
+}
+
+void SectorGraph::buildIndexes() {
+    std::vector<IndexEntry> entries;
+    std::vector<Node*> owners;
+
+    this->m_nodesByIdentifier.clear();
+    this->m_nodesByFrequency.clear();
+    this->m_indexedBorders.clear();
+
+    /* collect the stations and borders of all nodes of the graph */
+    for (auto& node : this->m_nodes) {
+        /* the upper sectors are stored first and keep the identifier if it is used multiple times */
+        const auto& info = node.sector.controllerInfo();
+        this->m_nodesByIdentifier.emplace(info.identifier(), &node);
+        if (0 != info.primaryFrequency().length())
+            this->m_nodesByFrequency[info.primaryFrequency()].push_back(&node);
+
+        for (const auto& border : std::as_const(node.sector.borders())) {
+            /* borders without a valid shape never contain a position */
+            if (0 == border.edges().size())
+                continue;
+
+            float minLon = std::numeric_limits<float>::max(), maxLon = -std::numeric_limits<float>::max();
+            float minLat = std::numeric_limits<float>::max(), maxLat = -std::numeric_limits<float>::max();
+            for (const auto& edge : std::as_const(border.edges())) {
+                minLon = std::min(minLon, edge.longitude().convert(types::degree));
+                maxLon = std::max(maxLon, edge.longitude().convert(types::degree));
+                minLat = std::min(minLat, edge.latitude().convert(types::degree));
+                maxLat = std::max(maxLat, edge.latitude().convert(types::degree));
+            }
+
+            IndexBox box(IndexPoint(minLon, minLat, border.lowerAltitude().convert(types::feet)),
+                         IndexPoint(maxLon, maxLat, border.upperAltitude().convert(types::feet)));
+            entries.push_back(std::make_pair(box, this->m_indexedBorders.size()));
+            owners.push_back(&node);
+            this->m_indexedBorders.push_back(std::make_pair(&node, &border));
+        }
+    }
+
+    /* the range constructor packs the tree */
+    this->m_borderIndex = bgi::rtree<IndexEntry, bgi::quadratic<16>>(entries);
+
+    /*
+     * every position inside a border is inside its box
+     * all sectors that contain the same position have a box that overlaps the box of this border
+     * the adjacent borders of a sector are all borders that share the sectorlines, are nested or stacked
+     */
+    std::vector<const Node*> adjacentTo(entries.size(), nullptr);
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        auto& adjacent = owners[i]->adjacentBorders;
+
+        /* the borders of a node are indexed consecutively -> the last owner is sufficient to find duplicates */
+        for (auto it = this->m_borderIndex.qbegin(bgi::intersects(entries[i].first)); this->m_borderIndex.qend() != it; ++it) {
+            if (owners[i] != adjacentTo[it->second]) {
+                adjacentTo[it->second] = owners[i];
+                adjacent.push_back(*it);
+            }
+        }
+    }
+}
+
+void SectorGraph::buildRaster() {
+    this->m_rasterColumns = 0;
+    this->m_rasterRows = 0;
+    this->m_rasterOffsets.clear();
+    this->m_rasterEntries.clear();
+
+    /* the visibility center of the airport sectors defines the center of the raster */
+    bool centerFound = false;
+    types::Coordinate center;
+    float minLon = std::numeric_limits<float>::max(), maxLon = -std::numeric_limits<float>::max();
+    float minLat = std::numeric_limits<float>::max(), maxLat = -std::numeric_limits<float>::max();
+    for (const auto& node : std::as_const(this->m_nodes)) {
+        if (types::Sector::Type::Delivery > node.sector.type() || types::Sector::Type::Tower < node.sector.type())
+            continue;
+
+        const auto& centerPoint = node.sector.controllerInfo().centerPoint();
+        if (0.0_deg != centerPoint.longitude() || 0.0_deg != centerPoint.latitude()) {
+            center = centerPoint;
+            centerFound = true;
+            break;
+        }
+
+        /* collect the bounding box of the airport sectors for stations without a visibility center */
+        for (const auto& border : std::as_const(node.sector.borders())) {
+            for (const auto& edge : std::as_const(border.edges())) {
+                minLon = std::min(minLon, edge.longitude().convert(types::degree));
+                maxLon = std::max(maxLon, edge.longitude().convert(types::degree));
+                minLat = std::min(minLat, edge.latitude().convert(types::degree));
+                maxLat = std::max(maxLat, edge.latitude().convert(types::degree));
+            }
+        }
+    }
+    if (false == centerFound) {
+        /* no airport sector with a shape -> the border index handles all queries */
+        if (minLon > maxLon)
+            return;
+        center = types::Coordinate((0.5f * (minLon + maxLon)) * types::degree, (0.5f * (minLat + maxLat)) * types::degree);
+    }
+
+    float latitude = center.latitude().convert(types::degree);
+    if (80.0f < std::abs(latitude))
+        return;
+
+    /* the cells are squares with an edge length of one nautical mile */
+    std::size_t cells = static_cast<std::size_t>(2.0f * __rasterRange / __rasterResolution);
+    this->m_rasterStep[1] = __rasterResolution / 60.0f;
+    this->m_rasterStep[0] = this->m_rasterStep[1] / std::cos(center.latitude().convert(types::radian));
+    this->m_rasterOrigin[0] = center.longitude().convert(types::degree) - 0.5f * static_cast<float>(cells) * this->m_rasterStep[0];
+    this->m_rasterOrigin[1] = latitude - 0.5f * static_cast<float>(cells) * this->m_rasterStep[1];
+
+    std::vector<std::size_t> borders;
+    this->m_rasterOffsets.reserve(cells * cells + 1);
+    this->m_rasterOffsets.push_back(0);
+    for (std::size_t row = 0; row < cells; ++row) {
+        for (std::size_t column = 0; column < cells; ++column) {
+            /* extend the cell to be robust against rounding errors of the lookup */
+            float minLon = this->m_rasterOrigin[0] + static_cast<float>(column) * this->m_rasterStep[0] - __rasterMargin;
+            float maxLon = this->m_rasterOrigin[0] + static_cast<float>(column + 1) * this->m_rasterStep[0] + __rasterMargin;
+            float minLat = this->m_rasterOrigin[1] + static_cast<float>(row) * this->m_rasterStep[1] - __rasterMargin;
+            float maxLat = this->m_rasterOrigin[1] + static_cast<float>(row + 1) * this->m_rasterStep[1] + __rasterMargin;
+            types::Coordinate southWest(minLon * types::degree, minLat * types::degree);
+            types::Coordinate northEast(maxLon * types::degree, maxLat * types::degree);
+
+            IndexBox box(IndexPoint(minLon, minLat, -std::numeric_limits<float>::max()),
+                         IndexPoint(maxLon, maxLat, std::numeric_limits<float>::max()));
+            borders.clear();
+            for (auto it = this->m_borderIndex.qbegin(bgi::intersects(box)); this->m_borderIndex.qend() != it; ++it)
+                borders.push_back(it->second);
+            std::sort(borders.begin(), borders.end());
+
+            for (const auto& index : std::as_const(borders)) {
+                const auto& border = this->m_indexedBorders[index];
+
+                auto coverage = border.second->coverage(southWest, northEast);
+                if (types::SectorBorder::Coverage::Outside != coverage)
+                    this->m_rasterEntries.push_back({ border, types::SectorBorder::Coverage::Inside == coverage });
+            }
+
+            this->m_rasterOffsets.push_back(static_cast<std::uint32_t>(this->m_rasterEntries.size()));
+        }
+    }
+
+    this->m_rasterColumns = cells;
+    this->m_rasterRows = cells;
+}
+
+void SectorGraph::destroyNode(std::shared_ptr<GraphNode>& node) {
+    if (nullptr == node)
+        return;
+
+    for (auto& child : node->children)
+        SectorGraph::destroyNode(child);
+
+    node->children.clear();
+}
+
+void SectorGraph::insertNode(std::list<std::shared_ptr<GraphNode>>& nodes, const types::Sector& sector) {
+    /* check if the sector is already a node */
+    bool alreadyRegistered = false;
+    for (const auto& node : std::as_const(nodes)) {
+        if (node->sector.controllerInfo().identifier() == sector.controllerInfo().identifier()) {
+            alreadyRegistered = true;
+            break;
+        }
+    }
+
+    /* create the new node */
+    if (false == alreadyRegistered) {
+        std::shared_ptr<SectorGraph::GraphNode> node(new SectorGraph::GraphNode(sector));
+        nodes.push_back(node);
+    }
+}
+
+std::list<std::shared_ptr<SectorGraph::GraphNode>> SectorGraph::findRelevantSectors(std::list<std::string>& deputies,
+                                                                                        const std::list<types::Sector>& sectors) {
+    std::list<std::shared_ptr<SectorGraph::GraphNode>> retval;
+
+    /* filter out the centers */
+    for (auto it = deputies.begin(); deputies.end() != it;) {
+        bool erased = false, found = false;
+
+        for (const auto& sector : std::as_const(sectors)) {
+            if (*it == sector.controllerInfo().identifier()) {
+                found = true;
+                if (types::Sector::Type::Center == sector.type() || types::Sector::Type::FlightService == sector.type()) {
+                    it = deputies.erase(it);
+                    erased = true;
+                }
+                break;
+            }
+        }
+
+        if (false == found)
+            it = deputies.erase(it);
+        else if (false == erased)
+            ++it;
+    }
+
+    /* create the nodes for all deputies */
+    std::string approachPrefix;
+    for (const auto& deputy : std::as_const(deputies)) {
+        for (const auto& sector : std::as_const(sectors)) {
+            if (sector.controllerInfo().identifier() == deputy) {
+                /* assume that all approaches have the same prefix */
+                if (types::Sector::Type::Approach == sector.type() && 0 == approachPrefix.length())
+                    approachPrefix = sector.controllerInfo().prefix();
+
+                if (types::Sector::Type::Approach == sector.type()) {
+                    if (approachPrefix == sector.controllerInfo().prefix())
+                        SectorGraph::insertNode(retval, sector);
+                }
+                else {
+                    SectorGraph::insertNode(retval, sector);
+                }
+            }
+            else if (0 != sector.borders().size()) {
+                auto it = std::find(sector.borders().front().deputies().cbegin(), sector.borders().front().deputies().cend(), deputy);
+                if (sector.borders().front().deputies().cend() != it) {
+                    if (types::Sector::Type::Approach == sector.type()) {
+                        if (approachPrefix == sector.controllerInfo().prefix())
+                            SectorGraph::insertNode(retval, sector);
+                    }
+                    else {
+                        SectorGraph::insertNode(retval, sector);
+                    }
+                }
+            }
+        }
+    }
+
+    return retval;
+}
+
+std::list<std::list<std::shared_ptr<SectorGraph::GraphNode>>> SectorGraph::linkSiblings(std::list<std::shared_ptr<GraphNode>>& nodes) {
+    std::list<std::list<std::shared_ptr<SectorGraph::GraphNode>>> retval;
+
+    for (auto it = nodes.begin(); nodes.end() != it; ++it) {
+        if (0 != retval.size()) {
+            /* both sectors have the same type -> further analysis is needed */
+            if (retval.back().front()->sector.type() == (*it)->sector.type()) {
+                switch (retval.back().front()->sector.type()) {
+                case types::Sector::Type::Approach:
+                {
+                    /*
+                     * The idea is to differentiate the feeder from the pick up.
+                     * It is only possible by the analyzis of the highest controlled altitute.
+                     *
+                     * If the altitudes are comparable (max. 10% difference), they are the same.
+                     * In the end we get two or more approaches where the lowest approach is the feeder.
+                     */
+                    auto ratio = (retval.back().front()->sector.borders().back().upperAltitude() - (*it)->sector.borders().back().upperAltitude()) / (*it)->sector.borders().back().upperAltitude();
+                    if (-0.1 <= ratio.value() && 0.1 >= ratio.value())
+                        retval.back().push_back(*it);
+                    else
+                        retval.push_back({ *it });
+                    break;
+                }
+                case types::Sector::Type::Departure:
+                case types::Sector::Type::Tower:
+                case types::Sector::Type::Ground:
+                    /*
+                     * Assume that the link to the airport allows only one departure airspace
+                     * that can be splitted into multiple sectors.
+                     *
+                     * Assume that all siblings have the same prefix.
+                     */
+                    if (retval.back().front()->sector.controllerInfo().prefix() == (*it)->sector.controllerInfo().prefix())
+                        retval.back().push_back({ *it });
+                    else
+                        retval.push_back({ *it });
+                    break;
+                case types::Sector::Type::Delivery:
+                    retval.push_back({ *it });
+                    break;
+                default:
+                    break;
+                }
+            }
+            else if (types::Sector::Type::Departure == (*it)->sector.type()) {
+                retval.back().push_back(*it);
+            }
+            else {
+                retval.push_back({ *it });
+            }
+        }
+        else {
+            retval.push_back({ *it });
+        }
+    }
+
+    return retval;
+}
+
+void SectorGraph::createGraph(std::list<std::list<std::shared_ptr<GraphNode>>>& siblings) {
+    std::list<std::shared_ptr<SectorGraph::GraphNode>> parents;
+
+    for (auto it = siblings.cbegin(); siblings.cend() != it; ++it) {
+        if (types::Sector::Type::Ground == it->front()->sector.type()) {
+            for (const auto& level : std::as_const(siblings)) {
+                if (types::Sector::Type::Tower == level.front()->sector.type() &&
+                    it->front()->sector.controllerInfo().prefix() == level.front()->sector.controllerInfo().prefix())
+                {
+                    for (auto& node : *it)
+                        node->parents = level;
+                    for (auto& node : level)
+                        node->children = *it;
+                }
+            }
+        }
+        else if (types::Sector::Type::Delivery == it->front()->sector.type()) {
+            for (const auto& level : std::as_const(siblings)) {
+                if (types::Sector::Type::Ground == level.front()->sector.type() &&
+                    it->front()->sector.controllerInfo().prefix() == level.front()->sector.controllerInfo().prefix())
+                {
+                    for (auto& node : *it)
+                        node->parents = level;
+                    for (auto& node : level)
+                        node->children = *it;
+                }
+            }
+        }
+        else {
+            for (auto& node : *it)
+                node->parents = parents;
+            for (auto& node : parents)
+                node->children.insert(node->children.end(), it->begin(), it->end());
+
+            if (types::Sector::Type::Tower < it->front()->sector.type())
+                parents = *it;
+        }
+    }
+}
+
+const SectorGraph::Node* SectorGraph::findNode(const std::string& identifier) const {
+    auto it = this->m_nodesByIdentifier.find(identifier);
+    if (this->m_nodesByIdentifier.cend() != it)
+        return it->second;
+    return nullptr;
+}
+
+const SectorGraph::Node* SectorGraph::findNode(const types::ControllerInfo& info) const {
+    /* test if the identifier matches */
+    auto node = this->findNode(info.identifier());
+    if (nullptr != node || 0 == info.primaryFrequency().length())
+        return node;
+
+    /* test if the primary frequencies match and if the callsigns match */
+    auto it = this->m_nodesByFrequency.find(info.primaryFrequency());
+    if (this->m_nodesByFrequency.cend() != it) {
+        for (const auto& candidate : std::as_const(it->second)) {
+            if (candidate->sector.controllerInfo().prefix() == info.prefix() && candidate->sector.controllerInfo().suffix() == info.suffix())
+                return candidate;
+        }
+    }
+
+    return nullptr;
+}
+
+SectorGraph::IndexPoint SectorGraph::indexPoint(const types::Position& position) {
+    return IndexPoint(position.coordinate().longitude().convert(types::degree),
+                      position.coordinate().latitude().convert(types::degree),
+                      position.altitude().convert(types::feet));
+}
+
+void SectorGraph::queryBorders(const IndexPoint& point, std::vector<IndexedBorder>& candidates) const {
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::BorderQuery);
+    for (auto it = this->m_borderIndex.qbegin(bgi::intersects(point)); this->m_borderIndex.qend() != it; ++it)
+        candidates.push_back(this->m_indexedBorders[it->second]);
+}
+
+void SectorGraph::queryAdjacentBorders(const IndexPoint& point, const Node* node, std::vector<IndexedBorder>& candidates) const {
+    for (const auto& entry : std::as_const(node->adjacentBorders)) {
+        if (true == bg::intersects(point, entry.first))
+            candidates.push_back(this->m_indexedBorders[entry.second]);
+    }
+}
+
+bool SectorGraph::queryRaster(const types::Coordinate& coordinate, std::span<const RasterEntry>& entries) const {
+    if (0 == this->m_rasterColumns)
+        return false;
+
+    float column = (coordinate.longitude().convert(types::degree) - this->m_rasterOrigin[0]) / this->m_rasterStep[0];
+    float row = (coordinate.latitude().convert(types::degree) - this->m_rasterOrigin[1]) / this->m_rasterStep[1];
+    if (0.0f > column || 0.0f > row || static_cast<float>(this->m_rasterColumns) <= column || static_cast<float>(this->m_rasterRows) <= row)
+        return false;
+
+    auto cell = static_cast<std::size_t>(row) * this->m_rasterColumns + static_cast<std::size_t>(column);
+    entries = std::span<const RasterEntry>(this->m_rasterEntries.data() + this->m_rasterOffsets[cell],
+                                           this->m_rasterOffsets[cell + 1] - this->m_rasterOffsets[cell]);
+    return true;
+}
+
+SectorGraph::BorderClearance SectorGraph::borderClearance(const types::Position& position, const types::Length& range) const {
+    BorderClearance clearance;
+    clearance.lowerAltitude = -std::numeric_limits<float>::max() * types::metre;
+    clearance.upperAltitude = std::numeric_limits<float>::max() * types::metre;
+
+    /* the positions outside the bounding boxes of all borders are outside of them */
+    const auto& center = position.coordinate();
+    float latRange = range.convert(types::metre) / 110000.0f;
+    float lonRange = latRange / std::cos(center.latitude().convert(types::radian));
+    IndexBox box(IndexPoint(center.longitude().convert(types::degree) - lonRange, center.latitude().convert(types::degree) - latRange,
+                            -std::numeric_limits<float>::max()),
+                 IndexPoint(center.longitude().convert(types::degree) + lonRange, center.latitude().convert(types::degree) + latRange,
+                            std::numeric_limits<float>::max()));
+
+    auto radius = range;
+    for (auto it = this->m_borderIndex.qbegin(bgi::intersects(box)); this->m_borderIndex.qend() != it; ++it) {
+        const auto& border = *this->m_indexedBorders[it->second].second;
+
+        /* the border's limits split the altitudes into bands with the same containment */
+        const types::Length* limits[2] = { &border.lowerAltitude(), &border.upperAltitude() };
+        for (const auto& limit : limits) {
+            if (*limit <= position.altitude())
+                clearance.lowerAltitude = std::max(clearance.lowerAltitude, *limit);
+            if (*limit >= position.altitude())
+                clearance.upperAltitude = std::min(clearance.upperAltitude, *limit);
+        }
+
+        radius = std::min(radius, border.distanceToEdges(center));
+    }
+
+    /* the radii of curvature of the WGS84 ellipsoid define the plane around the center */
+    double sinLatitude = std::sin(center.latitude().convert(types::radian)), squaredEccentricity = 6.69437999014e-3;
+    double denominator = 1.0 - squaredEccentricity * sinLatitude * sinLatitude;
+    double perDegree = static_cast<double>((1.0_deg).convert(types::radian));
+    clearance.center = center;
+    clearance.northScale = static_cast<float>(perDegree * 6378137.0 * (1.0 - squaredEccentricity) / (denominator * std::sqrt(denominator)));
+    clearance.eastScale = static_cast<float>(perDegree * 6378137.0 / std::sqrt(denominator) * std::cos(center.latitude().convert(types::radian)));
+    clearance.radius = __clearanceScale * radius - __clearanceMargin * types::metre;
+
+    return clearance;
+}
+
+bool SectorGraph::isInsideClearance(const BorderClearance& clearance, const types::Position& position,
+                                    const types::Length& distance, const types::Length& altitude) {
+    if (0_m >= clearance.radius)
+        return false;
+
+    /* the borders change at the limits */
+    if (clearance.lowerAltitude >= position.altitude() || clearance.upperAltitude <= position.altitude())
+        return false;
+    if (clearance.lowerAltitude >= altitude || clearance.upperAltitude <= altitude)
+        return false;
+
+    /* move the position along the heading inside the plane around the center */
+    float north = (position.coordinate().latitude() - clearance.center.latitude()).convert(types::degree) * clearance.northScale;
+    float east = std::remainder((position.coordinate().longitude() - clearance.center.longitude()).convert(types::degree), 360.0f) * clearance.eastScale;
+    float radius = clearance.radius.convert(types::metre);
+    if (radius * radius < north * north + east * east)
+        return false;
+
+    north += distance.convert(types::metre) * std::cos(position.heading().convert(types::radian));
+    east += distance.convert(types::metre) * std::sin(position.heading().convert(types::radian));
+    return radius * radius >= north * north + east * east;
+}
+
+types::Length SectorGraph::distanceToCenter(const BorderClearance& clearance, const types::Coordinate& coordinate) {
+    float north = (coordinate.latitude() - clearance.center.latitude()).convert(types::degree) * clearance.northScale;
+    float east = std::remainder((coordinate.longitude() - clearance.center.longitude()).convert(types::degree), 360.0f) * clearance.eastScale;
+    return std::sqrt(north * north + east * east) * types::metre;
+}
+
+void SectorGraph::serialize(helper::BinaryWriter& writer) const {
+    writer.write(static_cast<std::uint32_t>(this->m_nodes.size()));
+    for (const auto& node : std::as_const(this->m_nodes)) {
+        node.sector.serialize(writer);
+        writer.write(node.parentsBegin);
+        writer.write(node.parentsEnd);
+        writer.write(node.childrenBegin);
+        writer.write(node.childrenEnd);
+    }
+
+    writer.write(static_cast<std::uint32_t>(this->m_links.size()));
+    for (const auto& link : std::as_const(this->m_links))
+        writer.write(link);
+}
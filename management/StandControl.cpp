@@ -10,24 +10,25 @@
  */
 
 #include <algorithm>
-
-#include <GeographicLib/Gnomonic.hpp>
+#include <vector>
 
 #include <management/NotamControl.h>
 #include <management/StandControl.h>
 #include <system/ConfigurationRegistry.h>
+#include <system/PerformanceRegistry.h>
 #include <types/Quantity.hpp>
 
 using namespace topskytower;
 using namespace topskytower::management;
 using namespace topskytower::types;
 
-StandControl::StandControl(const std::string& airport, const types::Coordinate& center) :
+StandControl::StandControl(const std::string& airport, types::ProjectionContext* projection) :
         m_airportIcao(airport),
         m_standTree(),
         m_standTreeAdaptor(nullptr),
         m_aircraftStandRelation(),
-        m_centerPosition(center),
+        m_projection(projection),
+        m_localPlane(),
         m_gatPosition() {
     system::ConfigurationRegistry::instance().registerNotificationCallback(this, &StandControl::reinitialize);
     management::NotamControl::instance().registerNotificationCallback(this, &StandControl::notamsChanged);
@@ -66,6 +67,11 @@ void StandControl::copyStandData(const types::Stand& config, StandData& block) {
 }
 
 void StandControl::reinitialize(system::ConfigurationRegistry::UpdateType type) {
+    if (system::ConfigurationRegistry::UpdateType::All == type || system::ConfigurationRegistry::UpdateType::System == type) {
+        const auto& range = system::ConfigurationRegistry::instance().systemConfiguration().localProjectionRange;
+        this->m_localPlane = types::LocalTangentPlane(this->m_projection->center(), range);
+    }
+
     if (system::ConfigurationRegistry::UpdateType::All != type && system::ConfigurationRegistry::UpdateType::Airports != type)
         return;
 
@@ -82,7 +88,6 @@ void StandControl::reinitialize(system::ConfigurationRegistry::UpdateType type)
         return;
 
     /* copy the stand data into the new structure and convert the coordinate to Cartesian coordinates */
-    GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
     for (const auto& stand : std::as_const(config.aircraftStands)) {
         /* the GAT is a special stand */
         if ("GAT" == stand.name) {
@@ -93,12 +98,7 @@ void StandControl::reinitialize(system::ConfigurationRegistry::UpdateType type)
         StandData data;
         StandControl::copyStandData(stand, data);
 
-        projection.Forward(this->m_centerPosition.latitude().convert(types::degree),
-                           this->m_centerPosition.longitude().convert(types::degree),
-                           data.position.latitude().convert(types::degree),
-                           data.position.longitude().convert(types::degree),
-                           data.cartesianPosition[0],
-                           data.cartesianPosition[1]);
+        this->m_projection->forward(data.position, data.cartesianPosition);
 
         this->m_standTree.stands[data.name] = data;
     }
@@ -118,7 +118,7 @@ void StandControl::reinitialize(system::ConfigurationRegistry::UpdateType type)
 void StandControl::markStandAsOccupied(std::map<std::string, StandData>::iterator& iter, const types::Flight& flight, types::Flight::Type type) {
     /* mark the direct stand as occupied */
     iter->second.occupancyFlights.push_back(std::make_pair(flight, type));
-    this->m_aircraftStandRelation[flight.callsign()] = iter->first;
+    this->m_aircraftStandRelation[flight.id()] = iter->first;
 
     /* mark the blocking stands as occupied */
     for (const auto& neighbor : std::as_const(iter->second.blockingStands)) {
@@ -186,16 +186,28 @@ bool StandControl::findOptimalStand(const types::Flight& flight, types::Flight::
     types::Aircraft::WTC bestWtc = types::Aircraft::WTC::Super;
     std::string bestStand;
 
+    /* calculate the distances to all candidates in one batch */
+    std::vector<std::map<std::string, StandData>::iterator> candidates;
+    std::vector<types::Coordinate> positions;
+    candidates.reserve(availableStands.size());
+    positions.reserve(availableStands.size());
     for (const auto& stand : std::as_const(availableStands)) {
-        auto it = this->m_standTree.stands.find(stand);
-        auto distance = it->second.position.distanceTo(flight.currentPosition().coordinate());
+        candidates.push_back(this->m_standTree.stands.find(stand));
+        positions.push_back(candidates.back()->second.position);
+    }
+    std::vector<types::Length> distances(positions.size());
+    this->m_localPlane.distances(flight.currentPosition().coordinate(), positions, distances);
+
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        const auto& it = candidates[i];
+        const auto& distance = distances[i];
 
         /* most important is the optimal WTC category */
         if (0 != it->second.wtcWhitelist.size()) {
             if (bestWtc < it->second.wtcWhitelist.front()) {
                 minDistance = distance;
                 bestWtc = it->second.wtcWhitelist.front();
-                bestStand = stand;
+                bestStand = it->first;
                 continue;
             }
         }
@@ -203,7 +215,7 @@ bool StandControl::findOptimalStand(const types::Flight& flight, types::Flight::
         /* second priority is the distance */
         if (minDistance > distance) {
             minDistance = distance;
-            bestStand = stand;
+            bestStand = it->first;
         }
     }
 
@@ -242,37 +254,34 @@ bool StandControl::assignStand(const types::Flight& flight, types::Flight::Type
 }
 
 void StandControl::updateFlight(const types::Flight& flight, types::Flight::Type type) {
+    system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::StandControl);
+
     if (nullptr == this->m_standTreeAdaptor)
         return;
 
     const auto& maxDist = system::ConfigurationRegistry::instance().systemConfiguration().standAssociationDistance;
-    if (maxDist < flight.currentPosition().coordinate().distanceTo(this->m_centerPosition))
+    if (maxDist < this->m_localPlane.distance(flight.currentPosition().coordinate(), this->m_projection->center()))
         return;
 
     /* unknown and departures have the priority */
     if (types::Flight::Type::Arrival != type) {
         /* check if we have to delete the old assignment due to push-back or taxi */
-        auto relIt = this->m_aircraftStandRelation.find(flight.callsign());
-        if (this->m_aircraftStandRelation.end() != relIt) {
-            const auto& stand = this->m_standTree.stands[relIt->second];
-            auto distance = stand.position.distanceTo(flight.currentPosition().coordinate());
+        auto relation = this->m_aircraftStandRelation.find(flight.id());
+        if (nullptr != relation) {
+            const auto& stand = this->m_standTree.stands[*relation];
+            auto distance = this->m_localPlane.distance(stand.position, flight.currentPosition().coordinate());
 
             /* flight is too far away */
             if (distance > stand.assignmentRadius)
-                this->removeFlight(flight.callsign());
+                this->removeFlight(flight.id());
 
             return;
         }
 
-        GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
         float queryPt[2];
 
         /* calculate the Cartesian coordinate */
-        projection.Forward(this->m_centerPosition.latitude().convert(types::degree),
-                           this->m_centerPosition.longitude().convert(types::degree),
-                           flight.currentPosition().coordinate().latitude().convert(types::degree),
-                           flight.currentPosition().coordinate().longitude().convert(types::degree),
-                           queryPt[0], queryPt[1]);
+        this->m_projection->forward(flight.currentPosition().coordinate(), queryPt);
 
         /* search the nearest stand */
         size_t index;
@@ -282,17 +291,17 @@ void StandControl::updateFlight(const types::Flight& flight, types::Flight::Type
             std::advance(it, index);
 
             /* check that the distance matches */
-            if (it->second.assignmentRadius < it->second.position.distanceTo(flight.currentPosition().coordinate()))
+            if (it->second.assignmentRadius < this->m_localPlane.distance(it->second.position, flight.currentPosition().coordinate()))
                 return;
 
             /* remove arrival flights out of the stand */
-            std::list<std::string> arrivalCallsigns;
+            std::list<types::FlightId> arrivalIds;
             for (auto oit = it->second.occupancyFlights.cbegin(); it->second.occupancyFlights.cend() != oit; ++oit) {
                 if (types::Flight::Type::Arrival == oit->second)
-                    arrivalCallsigns.push_back(oit->first.callsign());
+                    arrivalIds.push_back(oit->first.id());
             }
-            for (const auto& cs : std::as_const(arrivalCallsigns))
-                this->removeFlight(cs);
+            for (const auto& id : std::as_const(arrivalIds))
+                this->removeFlight(id);
 
             /* reserve the stand */
             this->markStandAsOccupied(it, flight, type);
@@ -301,8 +310,7 @@ void StandControl::updateFlight(const types::Flight& flight, types::Flight::Type
     /* handle only IFR arrival flights */
     else if (types::FlightPlan::Type::IFR == flight.flightPlan().type() && types::Flight::Type::Arrival == type) {
         /* check if we need to assign a new stand */
-        auto it = this->m_aircraftStandRelation.find(flight.callsign());
-        if (this->m_aircraftStandRelation.cend() != it)
+        if (true == this->m_aircraftStandRelation.contains(flight.id()))
             return;
 
         auto availableStands = this->findAvailableAndUsableStands(flight, false);
@@ -324,20 +332,20 @@ void StandControl::updateFlight(const types::Flight& flight, types::Flight::Type
     }
     else if (types::FlightPlan::Type::VFR == flight.flightPlan().type() && types::Flight::Type::Arrival == type) {
         if (0 != this->m_gatPosition.name.length())
-            this->m_aircraftStandRelation[flight.callsign()] = this->m_gatPosition.name;
+            this->m_aircraftStandRelation[flight.id()] = this->m_gatPosition.name;
     }
 }
 
-void StandControl::removeFlight(const std::string& callsign) {
+void StandControl::removeFlight(types::FlightId id) {
     /* check if the flight is registered at a stand */
-    auto it = this->m_aircraftStandRelation.find(callsign);
-    if (this->m_aircraftStandRelation.end() != it) {
+    auto relation = this->m_aircraftStandRelation.find(id);
+    if (nullptr != relation) {
         /* find the coorect stand */
-        auto standIt = this->m_standTree.stands.find(it->second);
+        auto standIt = this->m_standTree.stands.find(*relation);
         if (this->m_standTree.stands.end() != standIt) {
             /* mark the stand as free */
             for (auto csIt = standIt->second.occupancyFlights.begin(); csIt != standIt->second.occupancyFlights.end(); ++csIt) {
-                if (csIt->first.callsign() == callsign) {
+                if (csIt->first.id() == id) {
                     standIt->second.occupancyFlights.erase(csIt);
                     break;
                 }
@@ -348,7 +356,7 @@ void StandControl::removeFlight(const std::string& callsign) {
                 auto neighborIt = this->m_standTree.stands.find(neighbor);
                 if (this->m_standTree.stands.end() != neighborIt) {
                     for (auto csIt = neighborIt->second.occupancyFlights.begin(); csIt != neighborIt->second.occupancyFlights.end(); ++csIt) {
-                        if (csIt->first.callsign() == callsign) {
+                        if (csIt->first.id() == id) {
                             neighborIt->second.occupancyFlights.erase(csIt);
                             break;
                         }
@@ -358,15 +366,15 @@ void StandControl::removeFlight(const std::string& callsign) {
         }
 
         /* erase the relation */
-        this->m_aircraftStandRelation.erase(it);
+        this->m_aircraftStandRelation.erase(id);
     }
 }
 
 void StandControl::assignManually(const types::Flight& flight, types::Flight::Type type, const std::string& stand) {
-    this->removeFlight(flight.callsign());
+    this->removeFlight(flight.id());
 
     if (0 != this->m_gatPosition.name.length() && this->m_gatPosition.name == stand) {
-        this->m_aircraftStandRelation[flight.callsign()] = stand;
+        this->m_aircraftStandRelation[flight.id()] = stand;
     }
     else {
         auto it = this->m_standTree.stands.find(stand);
@@ -386,9 +394,9 @@ bool StandControl::standExists(const std::string& name) const {
 }
 
 std::string StandControl::stand(const types::Flight& flight) const {
-    auto it = this->m_aircraftStandRelation.find(flight.callsign());
-    if (this->m_aircraftStandRelation.cend() != it)
-        return it->second;
+    auto relation = this->m_aircraftStandRelation.find(flight.id());
+    if (nullptr != relation)
+        return *relation;
     else
         return "";
 }
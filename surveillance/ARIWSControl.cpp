@@ -12,14 +12,15 @@
 #include <management/NotamControl.h>
 #include <surveillance/ARIWSControl.h>
 #include <system/ConfigurationRegistry.h>
+#include <system/PerformanceRegistry.h>
 
 using namespace topskytower;
 using namespace topskytower::surveillance;
 using namespace topskytower::types;
 
-ARIWSControl::ARIWSControl(const std::string& airport, const types::Coordinate& center) :
+ARIWSControl::ARIWSControl(const std::string& airport, types::ProjectionContext* projection) :
         m_airportIcao(airport),
-        m_holdingPoints(airport, center),
+        m_holdingPoints(airport, projection),
         m_incursionWarnings(),
         m_inactiveRunways() {
     system::ConfigurationRegistry::instance().registerNotificationCallback(this, &ARIWSControl::reinitialize);
@@ -34,6 +35,10 @@ ARIWSControl::~ARIWSControl() {
 }
 
 void ARIWSControl::reinitialize(system::ConfigurationRegistry::UpdateType type) {
+    if (system::ConfigurationRegistry::UpdateType::System == type) {
+        this->m_holdingPoints.updateLocalPlane();
+        return;
+    }
     if (system::ConfigurationRegistry::UpdateType::All != type && system::ConfigurationRegistry::UpdateType::Airports != type)
         return;
 
@@ -60,6 +65,8 @@ void ARIWSControl::notamsChanged() {
 }
 
 void ARIWSControl::updateFlight(const types::Flight& flight, types::Flight::Type type) {
+    system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::ARIWSControl);
+
     /* check if the system is active */
     if (false == system::ConfigurationRegistry::instance().systemConfiguration().ariwsActive ||
         false == system::ConfigurationRegistry::instance().runtimeConfiguration().ariwsActive)
@@ -72,12 +79,12 @@ void ARIWSControl::updateFlight(const types::Flight& flight, types::Flight::Type
         return;
 
     /* ignore departing or lining up flights */
-    auto aIt = std::find(this->m_incursionWarnings.begin(), this->m_incursionWarnings.end(), flight.callsign());
+    auto aIt = std::find(this->m_incursionWarnings.begin(), this->m_incursionWarnings.end(), flight.id());
     if (types::FlightPlan::AtcCommand::LineUp == flight.flightPlan().departureFlag() ||
         types::FlightPlan::AtcCommand::Departure == flight.flightPlan().departureFlag() ||
         40_kn < flight.groundSpeed())
     {
-        this->removeFlight(flight.callsign());
+        this->removeFlight(flight.id());
         return;
     }
     /* check if the flight is marked as RIW */
@@ -91,12 +98,12 @@ void ARIWSControl::updateFlight(const types::Flight& flight, types::Flight::Type
         auto point = this->m_holdingPoints.holdingPoint(system::ConfigurationRegistry::instance().runtimeConfiguration().lowVisibilityProcedures, index);
         auto it = std::find(this->m_inactiveRunways.cbegin(), this->m_inactiveRunways.cend(), point.runway);
         if (this->m_inactiveRunways.cend() == it)
-            this->m_incursionWarnings.push_back(flight.callsign());
+            this->m_incursionWarnings.push_back(flight.id());
     }
 }
 
-void ARIWSControl::removeFlight(const std::string& callsign) {
-    auto aIt = std::find(this->m_incursionWarnings.begin(), this->m_incursionWarnings.end(), callsign);
+void ARIWSControl::removeFlight(types::FlightId id) {
+    auto aIt = std::find(this->m_incursionWarnings.begin(), this->m_incursionWarnings.end(), id);
     if (this->m_incursionWarnings.end() != aIt)
         this->m_incursionWarnings.erase(aIt);
 }
@@ -109,6 +116,6 @@ bool ARIWSControl::runwayIncursionWarning(const types::Flight& flight) const {
         return false;
     }
 
-    auto aIt = std::find(this->m_incursionWarnings.begin(), this->m_incursionWarnings.end(), flight.callsign());
+    auto aIt = std::find(this->m_incursionWarnings.begin(), this->m_incursionWarnings.end(), flight.id());
     return this->m_incursionWarnings.end() != aIt;
 }
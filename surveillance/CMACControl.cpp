@@ -13,13 +13,14 @@
 
 #include <surveillance/CMACControl.h>
 #include <system/ConfigurationRegistry.h>
+#include <system/PerformanceRegistry.h>
 
 using namespace topskytower;
 using namespace topskytower::surveillance;
 using namespace topskytower::types;
 
-CMACControl::CMACControl(const std::string& airport, const types::Coordinate& center) :
-        m_holdingPoints(airport, center),
+CMACControl::CMACControl(const std::string& airport, types::ProjectionContext* projection) :
+        m_holdingPoints(airport, projection),
         m_tracks() {
     system::ConfigurationRegistry::instance().registerNotificationCallback(this, &CMACControl::reinitialize);
 
@@ -31,6 +32,10 @@ CMACControl::~CMACControl() {
 }
 
 void CMACControl::reinitialize(system::ConfigurationRegistry::UpdateType type) {
+    if (system::ConfigurationRegistry::UpdateType::System == type) {
+        this->m_holdingPoints.updateLocalPlane();
+        return;
+    }
     if (system::ConfigurationRegistry::UpdateType::All != type && system::ConfigurationRegistry::UpdateType::Airports != type)
         return;
 
@@ -38,6 +43,8 @@ void CMACControl::reinitialize(system::ConfigurationRegistry::UpdateType type) {
 }
 
 void CMACControl::updateFlight(const types::Flight& flight, types::Flight::Type type) {
+    system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::CMACControl);
+
     /* check if the system is active */
     if (false == system::ConfigurationRegistry::instance().systemConfiguration().cmacActive ||
         false == system::ConfigurationRegistry::instance().runtimeConfiguration().cmacActive)
@@ -46,20 +53,19 @@ void CMACControl::updateFlight(const types::Flight& flight, types::Flight::Type
     }
 
     if (40.0_kn < flight.groundSpeed()) {
-        this->removeFlight(flight.callsign());
+        this->m_tracks.erase(flight.id());
         return;
     }
 
-    auto it = this->m_tracks.find(flight.callsign());
+    auto track = this->m_tracks.find(flight.id());
 
-    if (this->m_tracks.end() == it) {
-        this->m_tracks[flight.callsign()] = FlightHistory();
-        it = this->m_tracks.find(flight.callsign());
+    if (nullptr == track) {
+        track = &this->m_tracks[flight.id()];
 
-        it->second.expectedCommand = types::FlightPlan::AtcCommand::Unknown;
-        it->second.behindHoldingPoint = false;
-        it->second.cycleCounter = 0;
-        it->second.referencePosition = flight.currentPosition().coordinate();
+        track->expectedCommand = types::FlightPlan::AtcCommand::Unknown;
+        track->behindHoldingPoint = false;
+        track->cycleCounter = 0;
+        track->referencePosition = flight.currentPosition().coordinate();
 
         return;
     }
@@ -68,28 +74,28 @@ void CMACControl::updateFlight(const types::Flight& flight, types::Flight::Type
 
     /* check if we have to increase the cycle counter */
     if (true == helper::Math::almostEqual(0.0f, flight.groundSpeed().value())) {
-        it->second.cycleCounter += 1;
+        track->cycleCounter += 1;
 
         /* check if we need to reset the internal data */
-        if (config.cmacCycleReset < it->second.cycleCounter) {
-            it->second.cycleCounter = 0;
-            it->second.expectedCommand = types::FlightPlan::AtcCommand::Unknown;
-            it->second.referencePosition = flight.currentPosition().coordinate();
+        if (config.cmacCycleReset < track->cycleCounter) {
+            track->cycleCounter = 0;
+            track->expectedCommand = types::FlightPlan::AtcCommand::Unknown;
+            track->referencePosition = flight.currentPosition().coordinate();
         }
 
         return;
     }
     else {
-        it->second.cycleCounter = 0;
+        track->cycleCounter = 0;
     }
 
     /* check if we moved far enough to check the parameters */
-    auto distance = it->second.referencePosition.distanceTo(flight.currentPosition().coordinate());
+    auto distance = this->m_holdingPoints.localPlane().distance(track->referencePosition, flight.currentPosition().coordinate());
     if (config.cmacMinimumDistance > distance)
         return;
 
     /* get the difference between the current heading and the heading between the old and new position */
-    auto heading = it->second.referencePosition.bearingTo(flight.currentPosition().coordinate());
+    auto heading = this->m_holdingPoints.localPlane().bearing(track->referencePosition, flight.currentPosition().coordinate());
     auto delta = heading - flight.currentPosition().heading();
 
     /* normalize the delta */
@@ -101,32 +107,30 @@ void CMACControl::updateFlight(const types::Flight& flight, types::Flight::Type
     /* compare the expected with the current ATC command */
     if (types::Flight::Type::Departure == type) {
         if (90.0_deg < delta && 270.0_deg > delta)
-            it->second.expectedCommand = types::FlightPlan::AtcCommand::Pushback;
+            track->expectedCommand = types::FlightPlan::AtcCommand::Pushback;
         else
-            it->second.expectedCommand = types::FlightPlan::AtcCommand::TaxiOut;
+            track->expectedCommand = types::FlightPlan::AtcCommand::TaxiOut;
     }
     /* check if the flight crossed a runway exit */
-    else if (false == it->second.behindHoldingPoint) {
+    else if (false == track->behindHoldingPoint) {
         if (true == this->m_holdingPoints.passedHoldingPoint(flight, type, false, 0.0_m, 30.0_deg, nullptr) || 0.0_kn == flight.groundSpeed()) {
-            it->second.expectedCommand = types::FlightPlan::AtcCommand::TaxiIn;
-            it->second.behindHoldingPoint = true;
+            track->expectedCommand = types::FlightPlan::AtcCommand::TaxiIn;
+            track->behindHoldingPoint = true;
         }
         else {
-            it->second.expectedCommand = types::FlightPlan::AtcCommand::Land;
+            track->expectedCommand = types::FlightPlan::AtcCommand::Land;
         }
     }
     /* already left the runway */
     else {
-        it->second.expectedCommand = types::FlightPlan::AtcCommand::TaxiIn;
+        track->expectedCommand = types::FlightPlan::AtcCommand::TaxiIn;
     }
 
-    it->second.referencePosition = flight.currentPosition().coordinate();
+    track->referencePosition = flight.currentPosition().coordinate();
 }
 
-void CMACControl::removeFlight(const std::string& callsign) {
-    auto it = this->m_tracks.find(callsign);
-    if (this->m_tracks.end() != it)
-        this->m_tracks.erase(it);
+void CMACControl::removeFlight(types::FlightId id) {
+    this->m_tracks.erase(id);
 }
 
 bool CMACControl::conformanceMonitoringAlert(const types::Flight& flight, types::Flight::Type type) const {
@@ -137,17 +141,17 @@ bool CMACControl::conformanceMonitoringAlert(const types::Flight& flight, types:
         return false;
     }
 
-    auto it = this->m_tracks.find(flight.callsign());
+    auto track = this->m_tracks.find(flight.id());
 
-    if (this->m_tracks.cend() != it && types::FlightPlan::AtcCommand::Unknown != it->second.expectedCommand) {
+    if (nullptr != track && types::FlightPlan::AtcCommand::Unknown != track->expectedCommand) {
         if (types::Flight::Type::Departure == type) {
-            if (types::FlightPlan::AtcCommand::Pushback == it->second.expectedCommand)
-                return flight.flightPlan().departureFlag() != it->second.expectedCommand;
+            if (types::FlightPlan::AtcCommand::Pushback == track->expectedCommand)
+                return flight.flightPlan().departureFlag() != track->expectedCommand;
             else
-                return flight.flightPlan().departureFlag() < it->second.expectedCommand;
+                return flight.flightPlan().departureFlag() < track->expectedCommand;
         }
         else {
-            return flight.flightPlan().arrivalFlag() != it->second.expectedCommand;
+            return flight.flightPlan().arrivalFlag() != track->expectedCommand;
         }
     }
 
@@ -9,8 +9,7 @@
  *   GNU General Public License v3 (GPLv3)
  */
 
-#include <GeographicLib/Gnomonic.hpp>
-
+#include <helper/Clock.h>
 #include <surveillance/DepartureModel.h>
 #include <system/ConfigurationRegistry.h>
 
@@ -20,7 +19,7 @@ using namespace topskytower::types;
 
 DepartureModel::DepartureModel(const std::string& callsign) :
         m_flight(types::Flight(callsign)),
-        m_reference(),
+        m_projection(nullptr),
         m_lastUpdate(),
         m_currentPhase(Phase::TakeOff),
         m_v2Speed(),
@@ -29,13 +28,15 @@ DepartureModel::DepartureModel(const std::string& callsign) :
         m_acceleration(),
         m_cruiseSpeed(),
         m_waypoints(),
+        m_waypointCoordinates(),
+        m_waypointDistances(),
         m_routeCartesian() { }
 
-DepartureModel::DepartureModel(const types::Flight& flight, const types::Coordinate& reference,
+DepartureModel::DepartureModel(const types::Flight& flight, types::ProjectionContext* projection,
                                const std::vector<types::Coordinate>& waypoints) :
         m_flight(flight),
-        m_reference(reference),
-        m_lastUpdate(std::chrono::system_clock::now()),
+        m_projection(projection),
+        m_lastUpdate(helper::Clock::instance().now()),
         m_currentPhase(Phase::TakeOff),
         m_v2Speed(),
         m_climbRate(),
@@ -43,6 +44,8 @@ DepartureModel::DepartureModel(const types::Flight& flight, const types::Coordin
         m_acceleration(),
         m_cruiseSpeed(),
         m_waypoints(),
+        m_waypointCoordinates(),
+        m_waypointDistances(),
         m_routeCartesian() {
     const auto& config = system::ConfigurationRegistry::instance().systemConfiguration();
 
@@ -238,17 +241,12 @@ void DepartureModel::predictWaypoints(const std::vector<types::Coordinate>& wayp
     this->m_routeCartesian.clear();
 
     /* transform the route to Cartesian coordinates to perform some intersection-tests */
-    GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
     for (const auto& waypoint : std::as_const(waypoints)) {
-        float x, y;
-
-        projection.Forward(this->m_reference.latitude().convert(types::degree),
-                           this->m_reference.longitude().convert(types::degree),
-                           waypoint.latitude().convert(types::degree),
-                           waypoint.longitude().convert(types::degree),
-                           x, y);
+        float cartesian[2];
 
-        bg::append(this->m_routeCartesian, bg::model::point<float, 2, bg::cs::cartesian>(x, y));
+        /* the departures share the fixes of the SIDs -> the context returns most of them from the cache */
+        this->m_projection->forward(waypoint, cartesian);
+        bg::append(this->m_routeCartesian, bg::model::point<float, 2, bg::cs::cartesian>(cartesian[0], cartesian[1]));
     }
 
     std::vector<types::Coordinate>::const_iterator it;
@@ -280,11 +278,16 @@ void DepartureModel::predictWaypoints(const std::vector<types::Coordinate>& wayp
 
         this->m_waypoints.push_back(wp);
     }
+
+    /* keep the coordinates for the batched distances of the conflict detection */
+    this->m_waypointCoordinates.clear();
+    for (const auto& waypoint : std::as_const(this->m_waypoints))
+        this->m_waypointCoordinates.push_back(waypoint.position.coordinate());
 }
 
 void DepartureModel::update(const types::Flight& flight, const std::vector<types::Coordinate>& waypoints) {
     /* get the DT and update the internal timestamp */
-    auto now = std::chrono::system_clock::now();
+    auto now = helper::Clock::instance().now();
     auto dt = static_cast<float>(std::chrono::duration_cast<std::chrono::milliseconds>(now - this->m_lastUpdate).count()) * types::millisecond;
     this->m_lastUpdate = now;
 
@@ -315,11 +318,17 @@ void DepartureModel::update(const types::Flight& flight, const std::vector<types
     this->predictWaypoints(waypoints);
 }
 
-bool DepartureModel::findSegment(const std::vector<Waypoint>& route, const types::Coordinate& point,
-                                 std::size_t& startIdx, std::size_t& endIdx) {
+bool DepartureModel::findSegment(const types::Coordinate& point, std::size_t& startIdx, std::size_t& endIdx) const {
+    const auto& route = this->m_waypoints;
+    auto& distances = this->m_waypointDistances;
+
+    /* every waypoint is the end of one and the start of the next segment -> calculate the distances once */
+    distances.resize(this->m_waypointCoordinates.size());
+    point.distancesTo(this->m_waypointCoordinates, distances);
+
     for (std::size_t i = 0; i < route.size() - 1; ++i) {
-        auto distanceAC = point.distanceTo(route[i + 1].position.coordinate());
-        auto distanceAB = point.distanceTo(route[i].position.coordinate());
+        const auto& distanceAC = distances[i + 1];
+        const auto& distanceAB = distances[i];
         auto distanceBC = route[i].position.coordinate().distanceTo(route[i + 1].position.coordinate());
 
         /* definitly not on the line segment */
@@ -368,19 +377,14 @@ std::list<DepartureModel::ConflictPosition> DepartureModel::findConflictCandidat
     bg::intersection(this->m_routeCartesian, other.m_routeCartesian, intersections);
 
     /* test all intersections */
-    GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
     for (const auto& point : std::as_const(intersections)) {
         ConflictPosition conflict;
-        float lat, lon;
-
-        projection.Reverse(this->m_reference.latitude().convert(types::degree), this->m_reference.longitude().convert(types::degree),
-                           point.get<0>(), point.get<1>(), lat, lon);
 
-        conflict.coordinate = types::Coordinate(lon * types::degree, lat * types::degree);
+        conflict.coordinate = this->m_projection->reverse(point.get<0>(), point.get<1>());
 
         std::size_t startThis, startOther, endThis, endOther;
-        bool foundSegments = DepartureModel::findSegment(this->m_waypoints, conflict.coordinate, startThis, endThis);
-        foundSegments &= DepartureModel::findSegment(other.m_waypoints, conflict.coordinate, startOther, endOther);
+        bool foundSegments = this->findSegment(conflict.coordinate, startThis, endThis);
+        foundSegments &= other.findSegment(conflict.coordinate, startOther, endOther);
 
         /* found relevant segments */
         if (true == foundSegments) {
@@ -135,87 +135,91 @@ bool FlightPlanControl::validateFiledRoute(const types::FlightPlan& plan) {
 bool FlightPlanControl::validate(const types::Flight& flight) {
     /* ignore VFR flights */
     if (types::FlightPlan::Type::VFR == flight.flightPlan().type()) {
-        this->m_flightChecks[flight.callsign()].errorCodes = { surveillance::FlightPlanControl::ErrorCode::VFR };
+        this->m_flightChecks[flight.id()].errorCodes = { surveillance::FlightPlanControl::ErrorCode::VFR };
         return true;
     }
 
     /* validate the input flight plan */
     if (0 == flight.flightPlan().destination().length()) {
-        this->removeFlight(flight.callsign());
+        this->m_flightChecks.erase(flight.id());
         return false;
     }
     if (0 == flight.flightPlan().departureRoute().length()) {
-        this->removeFlight(flight.callsign());
+        this->m_flightChecks.erase(flight.id());
         return false;
     }
     if (types::FlightPlan::Type::Unknown == flight.flightPlan().type()) {
-        this->removeFlight(flight.callsign());
+        this->m_flightChecks.erase(flight.id());
         return false;
     }
 
-    auto it = this->m_flightChecks.find(flight.callsign());
+    auto status = this->m_flightChecks.find(flight.id());
+
+    /* the shared flight plan is unchanged since the last validation */
+    if (nullptr != status && 0 != status->version && flight.flightPlan().version() == status->version)
+        return false;
 
     /* check if a new validation is required */
-    bool validationRequired = this->m_flightChecks.end() == it;
+    bool validationRequired = nullptr == status;
     if (false == validationRequired) {
-        validationRequired |= flight.flightPlan().type() != it->second.type;
-        validationRequired |= flight.flightPlan().textRoute() != it->second.route;
-        validationRequired |= flight.flightPlan().departureRoute() != it->second.departureRoute;
-        validationRequired |= flight.flightPlan().destination() != it->second.destination;
-        validationRequired |= flight.flightPlan().flightLevel() != it->second.requestedFlightLevel;
-        validationRequired |= flight.flightPlan().rnavCapable() != it->second.rnavCapable;
-        validationRequired |= flight.flightPlan().transponderExists() != it->second.transponderAvailable;
+        validationRequired |= flight.flightPlan().type() != status->type;
+        validationRequired |= flight.flightPlan().textRoute() != status->route;
+        validationRequired |= flight.flightPlan().departureRoute() != status->departureRoute;
+        validationRequired |= flight.flightPlan().destination() != status->destination;
+        validationRequired |= flight.flightPlan().flightLevel() != status->requestedFlightLevel;
+        validationRequired |= flight.flightPlan().rnavCapable() != status->rnavCapable;
+        validationRequired |= flight.flightPlan().transponderExists() != status->transponderAvailable;
     }
     else {
-        this->m_flightChecks[flight.callsign()] = FlightPlanStatus();
-        it = this->m_flightChecks.find(flight.callsign());
+        status = &this->m_flightChecks[flight.id()];
     }
+    status->version = flight.flightPlan().version();
 
     /* validate the flight plan */
     if (true == validationRequired) {
         /* update the information */
-        it->second.destination = flight.flightPlan().destination();
-        it->second.route = flight.flightPlan().textRoute();
-        it->second.departureRoute = flight.flightPlan().departureRoute();
-        it->second.type =  flight.flightPlan().type();
-        it->second.overwritten = false;
-        it->second.rnavCapable = flight.flightPlan().rnavCapable();
-        it->second.transponderAvailable = flight.flightPlan().transponderExists();
-        it->second.requestedFlightLevel = flight.flightPlan().flightLevel();
-        it->second.errorCodes.clear();
+        status->destination = flight.flightPlan().destination();
+        status->route = flight.flightPlan().textRoute();
+        status->departureRoute = flight.flightPlan().departureRoute();
+        status->type =  flight.flightPlan().type();
+        status->overwritten = false;
+        status->rnavCapable = flight.flightPlan().rnavCapable();
+        status->transponderAvailable = flight.flightPlan().transponderExists();
+        status->requestedFlightLevel = flight.flightPlan().flightLevel();
+        status->errorCodes.clear();
 
         const auto& config = system::ConfigurationRegistry::instance().airportConfiguration(flight.flightPlan().origin());
 
         /* no configuration for the SID found */
-        auto sit = config.sids.find(it->second.departureRoute);
+        auto sit = config.sids.find(status->departureRoute);
         if (config.sids.cend() == sit) {
-            it->second.errorCodes.push_back(ErrorCode::DepartureRoute);
+            status->errorCodes.push_back(ErrorCode::DepartureRoute);
             return validationRequired;
         }
 
         /* the engine-type needs to be checked */
         if (types::Aircraft::EngineType::Unknown != sit->second.engineType) {
             if (sit->second.engineType != flight.flightPlan().aircraft().engineType())
-                it->second.errorCodes.push_back(ErrorCode::EngineType);
+                status->errorCodes.push_back(ErrorCode::EngineType);
         }
 
         /* RNAV is required */
         if (true == system::ConfigurationRegistry::instance().systemConfiguration().flightPlanCheckNavigation) {
             if (true == sit->second.requiresRnav && false == flight.flightPlan().rnavCapable())
-                it->second.errorCodes.push_back(ErrorCode::Navigation);
+                status->errorCodes.push_back(ErrorCode::Navigation);
         }
 
         /* transponder is required */
         if (true == sit->second.requiresTransponder && false == flight.flightPlan().transponderExists())
-            it->second.errorCodes.push_back(ErrorCode::Transponder);
+            status->errorCodes.push_back(ErrorCode::Transponder);
 
         /* check the flight level constraints */
         if (sit->second.minimumCruiseLevel > flight.flightPlan().flightLevel() || sit->second.maximumCruiseLevel < flight.flightPlan().flightLevel())
-            it->second.errorCodes.push_back(ErrorCode::FlightLevel);
+            status->errorCodes.push_back(ErrorCode::FlightLevel);
 
         /* check the event routes */
         if (false == FlightPlanControl::validateFiledRoute(flight.flightPlan()))
-            it->second.errorCodes.push_back(ErrorCode::Event);
+            status->errorCodes.push_back(ErrorCode::Event);
 
         /* prepare for the even-odd checks */
         bool even = 0 == static_cast<int>(flight.flightPlan().flightLevel().convert(types::feet)) % 2000;
@@ -225,7 +229,7 @@ bool FlightPlanControl::validate(const types::Flight& flight) {
         for (const auto& constraint : std::as_const(config.destinationConstraints)) {
             if (constraint.destination == flight.flightPlan().destination()) {
                 if ((true == constraint.evenCruiseLevel && false == even) || (false == constraint.evenCruiseLevel && true == even))
-                    it->second.errorCodes.push_back(ErrorCode::EvenOddLevel);
+                    status->errorCodes.push_back(ErrorCode::EvenOddLevel);
 
                 foundDestinationConstraint = true;
                 break;
@@ -236,7 +240,7 @@ bool FlightPlanControl::validate(const types::Flight& flight) {
             true == system::ConfigurationRegistry::instance().systemConfiguration().flightPlanCheckEvenOdd)
         {
             if (0 == flight.flightPlan().route().waypoints().size()) {
-                it->second.errorCodes.push_back(ErrorCode::Route);
+                status->errorCodes.push_back(ErrorCode::Route);
             }
             else {
                 /* find the bearing between start and destination */
@@ -245,45 +249,43 @@ bool FlightPlanControl::validate(const types::Flight& flight) {
 
                 /* use the half circle rule*/
                 if ((180_deg > bearing && true == even) || (180_deg <= bearing && false == even))
-                    it->second.errorCodes.push_back(ErrorCode::EvenOddLevel);
+                    status->errorCodes.push_back(ErrorCode::EvenOddLevel);
             }
         }
 
         /* no error found */
-        if (0 == it->second.errorCodes.size())
-            it->second.errorCodes.push_back(ErrorCode::NoError);
+        if (0 == status->errorCodes.size())
+            status->errorCodes.push_back(ErrorCode::NoError);
     }
 
     return validationRequired;
 }
 
-void FlightPlanControl::removeFlight(const std::string& callsign) {
-    auto it = this->m_flightChecks.find(callsign);
-    if (this->m_flightChecks.end() != it)
-        this->m_flightChecks.erase(it);
+void FlightPlanControl::removeFlight(types::FlightId id) {
+    this->m_flightChecks.erase(id);
 }
 
-void FlightPlanControl::overwrite(const std::string& callsign) {
-    auto it = this->m_flightChecks.find(callsign);
-    if (this->m_flightChecks.end() != it)
-        it->second.overwritten = true;
+void FlightPlanControl::overwrite(const types::Flight& flight) {
+    auto status = this->m_flightChecks.find(flight.id());
+    if (nullptr != status)
+        status->overwritten = true;
 }
 
-const std::list<FlightPlanControl::ErrorCode>& FlightPlanControl::errorCodes(const std::string& callsign) const {
+const std::list<FlightPlanControl::ErrorCode>& FlightPlanControl::errorCodes(const types::Flight& flight) const {
     static std::list<FlightPlanControl::ErrorCode> fallback{ FlightPlanControl::ErrorCode::Unknown };
-    auto it = this->m_flightChecks.find(callsign);
+    auto status = this->m_flightChecks.find(flight.id());
 
-    if (this->m_flightChecks.cend() != it)
-        return it->second.errorCodes;
+    if (nullptr != status)
+        return status->errorCodes;
     else
         return fallback;
 }
 
-bool FlightPlanControl::overwritten(const std::string& callsign) const {
-    auto it = this->m_flightChecks.find(callsign);
+bool FlightPlanControl::overwritten(const types::Flight& flight) const {
+    auto status = this->m_flightChecks.find(flight.id());
 
-    if (this->m_flightChecks.cend() != it)
-        return it->second.overwritten;
+    if (nullptr != status)
+        return status->overwritten;
     else
         return false;
 }
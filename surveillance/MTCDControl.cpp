@@ -9,14 +9,17 @@
  *   GNU General Public License v3 (GPLv3)
  */
 
+#include <algorithm>
+
 #include <surveillance/MTCDControl.h>
+#include <system/PerformanceRegistry.h>
 
 using namespace topskytower;
 using namespace topskytower::surveillance;
 using namespace topskytower::types;
 
-MTCDControl::MTCDControl(const types::Coordinate& center, management::DepartureSequenceControl* departureControl) :
-        m_center(center),
+MTCDControl::MTCDControl(types::ProjectionContext* projection, management::DepartureSequenceControl* departureControl) :
+        m_projection(projection),
         m_departureControl(departureControl),
         m_sidExtractionCallback(),
         m_departures(),
@@ -33,11 +36,11 @@ std::list<DepartureModel>::iterator MTCDControl::insertFlight(const types::Fligh
         if (0 == route.size())
             return this->m_departures.end();
 
-        this->m_departures.push_back(DepartureModel(flight, this->m_center, route));
+        this->m_departures.push_back(DepartureModel(flight, this->m_projection, route));
     }
     /* check if it is a departure candidate */
     else if (true == this->m_departureControl->readyForDeparture(flight)) {
-        this->m_departures.push_back(DepartureModel(flight, this->m_center, this->m_sidExtractionCallback(flight.callsign())));
+        this->m_departures.push_back(DepartureModel(flight, this->m_projection, this->m_sidExtractionCallback(flight.callsign())));
     }
     else {
         return this->m_departures.end();
@@ -50,6 +53,8 @@ std::list<DepartureModel>::iterator MTCDControl::insertFlight(const types::Fligh
 }
 
 void MTCDControl::updateFlight(const types::Flight& flight, types::Flight::Type type) {
+    system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::MTCDControl);
+
     /* the controller disabled the system */
     if (false == system::ConfigurationRegistry::instance().systemConfiguration().mtcdActive ||
         false == system::ConfigurationRegistry::instance().runtimeConfiguration().mtcdActive)
@@ -61,7 +66,9 @@ void MTCDControl::updateFlight(const types::Flight& flight, types::Flight::Type
     if (nullptr == this->m_sidExtractionCallback)
         return;
 
-    auto it = std::find(this->m_departures.begin(), this->m_departures.end(), DepartureModel(flight.callsign()));
+    auto it = std::find_if(this->m_departures.begin(), this->m_departures.end(), [&flight](const DepartureModel& model) {
+        return model.flight().id() == flight.id();
+    });
 
     /* we've got a new candidate -> check how to insert it */
     if (this->m_departures.end() == it) {
@@ -83,16 +90,14 @@ void MTCDControl::updateFlight(const types::Flight& flight, types::Flight::Type
 
     /* check if the flight reached the SIDs exit */
     if (0 == it->waypoints().size()) {
-        this->removeFlight(flight.callsign());
+        this->removeFlight(flight.id());
         return;
     }
 
     /* do not check departed flights */
     if (types::FlightPlan::AtcCommand::Departure == flight.flightPlan().departureFlag() || 40_kn < flight.groundSpeed()) {
         /* erase flights where this flight is the initiator of the conflict */
-        auto cit = this->m_conflicts.find(flight.callsign());
-        if (this->m_conflicts.end() != cit)
-            this->m_conflicts.erase(cit);
+        this->m_conflicts.erase(flight.id());
         return;
     }
 
@@ -104,7 +109,7 @@ void MTCDControl::updateFlight(const types::Flight& flight, types::Flight::Type
 
             /* erase all existing conflicts for this combination */
             if (0 == candidates.size()) {
-                this->removeConflict(it->flight().callsign(), departure.flight().callsign());
+                this->removeConflict(it->flight().id(), departure.flight().callsign());
                 continue;
             }
 
@@ -126,7 +131,7 @@ void MTCDControl::updateFlight(const types::Flight& flight, types::Flight::Type
 
                     /* update the statistic */
                     bool updated = false;
-                    auto& conflicts = this->m_conflicts[it->flight().callsign()];
+                    auto& conflicts = this->m_conflicts[it->flight().id()];
                     for (auto cit = conflicts.begin(); conflicts.end() != cit; ++cit) {
                         if (cit->callsign == departure.flight().callsign()) {
                             *cit = conflict;
@@ -142,51 +147,56 @@ void MTCDControl::updateFlight(const types::Flight& flight, types::Flight::Type
             }
 
             /* no relevant conflict found -> delete the old conflicts */
-            this->removeConflict(it->flight().callsign(), departure.flight().callsign());
+            this->removeConflict(it->flight().id(), departure.flight().callsign());
         }
     }
 }
 
-void MTCDControl::removeConflict(const std::string& callsignModel, const std::string& callsignConflict) {
-    auto it = this->m_conflicts.find(callsignModel);
-    if (this->m_conflicts.end() != it) {
-        for (auto cit = it->second.begin(); it->second.end() != cit; ++cit) {
+void MTCDControl::removeConflict(types::FlightId idModel, const std::string& callsignConflict) {
+    auto conflicts = this->m_conflicts.find(idModel);
+    if (nullptr != conflicts) {
+        for (auto cit = conflicts->begin(); conflicts->end() != cit; ++cit) {
             if (cit->callsign == callsignConflict) {
-                it->second.erase(cit);
+                conflicts->erase(cit);
                 return;
             }
         }
     }
 }
 
-void MTCDControl::removeFlight(const std::string& callsign) {
-    auto it = std::find(this->m_departures.begin(), this->m_departures.end(), DepartureModel(callsign));
+void MTCDControl::removeFlight(types::FlightId id) {
+    auto it = std::find_if(this->m_departures.begin(), this->m_departures.end(), [id](const DepartureModel& model) {
+        return model.flight().id() == id;
+    });
     if (this->m_departures.end() != it)
         this->m_departures.erase(it);
 
-    for (auto cit = this->m_conflicts.begin(); this->m_conflicts.end() != cit; ++cit) {
-        for (auto oit = cit->second.begin(); oit != cit->second.end();) {
+    const auto& callsign = types::CallsignTable::instance().callsign(id);
+    this->m_conflicts.forEach([&callsign](types::FlightId, std::list<Conflict>& conflicts) {
+        for (auto oit = conflicts.begin(); oit != conflicts.end();) {
             if (oit->callsign == callsign)
-                oit = cit->second.erase(oit);
+                oit = conflicts.erase(oit);
             else
                 ++oit;
         }
-    }
+    });
 
-    auto cit = this->m_conflicts.find(callsign);
-    if (this->m_conflicts.end() != cit)
-        this->m_conflicts.erase(cit);
+    this->m_conflicts.erase(id);
 }
 
 bool MTCDControl::departureModelExists(const types::Flight& flight) const {
-    auto it = std::find(this->m_departures.cbegin(), this->m_departures.cend(), DepartureModel(flight.callsign()));
+    auto it = std::find_if(this->m_departures.cbegin(), this->m_departures.cend(), [&flight](const DepartureModel& model) {
+        return model.flight().id() == flight.id();
+    });
     return this->m_departures.cend() != it;
 }
 
 const DepartureModel& MTCDControl::departureModel(const types::Flight& flight) const {
     static DepartureModel __fallback("");
 
-    auto it = std::find(this->m_departures.cbegin(), this->m_departures.cend(), DepartureModel(flight.callsign()));
+    auto it = std::find_if(this->m_departures.cbegin(), this->m_departures.cend(), [&flight](const DepartureModel& model) {
+        return model.flight().id() == flight.id();
+    });
     if (this->m_departures.cend() != it)
         return *it;
     else
@@ -201,9 +211,9 @@ bool MTCDControl::conflictsExist(const types::Flight& flight) const {
         return false;
     }
 
-    auto it = this->m_conflicts.find(flight.callsign());
-    if (this->m_conflicts.cend() != it)
-        return 0 != it->second.size();
+    auto conflicts = this->m_conflicts.find(flight.id());
+    if (nullptr != conflicts)
+        return 0 != conflicts->size();
 
     return false;
 }
@@ -219,9 +229,9 @@ const std::list<MTCDControl::Conflict>& MTCDControl::conflicts(const types::Flig
     }
 
     /* find the conflict */
-    auto it = this->m_conflicts.find(flight.callsign());
-    if (this->m_conflicts.cend() != it)
-        return it->second;
+    auto conflicts = this->m_conflicts.find(flight.id());
+    if (nullptr != conflicts)
+        return *conflicts;
 
     return __fallback;
 }
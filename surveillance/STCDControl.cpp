@@ -18,6 +18,7 @@
 
 #include <surveillance/STCDControl.h>
 
+#include <system/PerformanceRegistry.h>
 #include <system/Separation.h>
 
 using namespace topskytower;
@@ -29,11 +30,15 @@ STCDControl::STCDControl(const std::string& airport, const types::Length& elevat
         m_airportIcao(airport),
         m_airportElevation(elevation + 100_ft),
         m_reference(center),
+        m_localPlane(),
         m_departureControl(departureControl),
         m_runways(runways),
         m_noTransgressionZones(),
         m_ntzViolations(),
         m_inbounds(),
+        m_inboundRunways(),
+        m_inboundWtcs(),
+        m_inboundDistances(),
         m_conflicts() {
     system::ConfigurationRegistry::instance().registerNotificationCallback(this, &STCDControl::reinitialize);
 
@@ -118,6 +123,11 @@ void STCDControl::createNTZ(const std::pair<std::string, std::string>& runwayPai
 }
 
 void STCDControl::reinitialize(system::ConfigurationRegistry::UpdateType type) {
+    if (system::ConfigurationRegistry::UpdateType::All == type || system::ConfigurationRegistry::UpdateType::System == type) {
+        const auto& range = system::ConfigurationRegistry::instance().systemConfiguration().localProjectionRange;
+        this->m_localPlane = types::LocalTangentPlane(this->m_reference, range);
+    }
+
     if (system::ConfigurationRegistry::UpdateType::All != type && system::ConfigurationRegistry::UpdateType::Runtime != type)
         return;
 
@@ -145,8 +155,9 @@ void STCDControl::reinitialize(system::ConfigurationRegistry::UpdateType type) {
         std::advance(cit, 1);
 
         /* check if IPA is available for this runway */
-        if (airportConfig.ipaRunways.cend() != airportConfig.ipaRunways.find(*it)) {
-            const auto& partnerRwys = airportConfig.ipaRunways.find(*it)->second;
+        types::RunwayCode runway(*it);
+        if (airportConfig.ipaRunways.cend() != airportConfig.ipaRunways.find(runway)) {
+            const auto& partnerRwys = airportConfig.ipaRunways.find(runway)->second;
 
             for (; arrivalRunways.cend() != cit; ++cit) {
                 auto partner = std::find(partnerRwys.cbegin(), partnerRwys.cend(), *cit);
@@ -156,8 +167,8 @@ void STCDControl::reinitialize(system::ConfigurationRegistry::UpdateType type) {
         }
 
         /* check if PRM is available for this runway */
-        if (airportConfig.prmRunways.cend() != airportConfig.prmRunways.find(*it)) {
-            const auto& partnerRwys = airportConfig.prmRunways.find(*it)->second;
+        if (airportConfig.prmRunways.cend() != airportConfig.prmRunways.find(runway)) {
+            const auto& partnerRwys = airportConfig.prmRunways.find(runway)->second;
 
             for (; arrivalRunways.cend() != cit; ++cit) {
                 auto partner = std::find(partnerRwys.cbegin(), partnerRwys.cend(), *cit);
@@ -181,86 +192,120 @@ static __inline void __normalizeAngle(types::Angle& angle) {
         angle -= 360.0_deg;
 }
 
-void STCDControl::analyzeInbound(const types::Flight& flight) {
-    /* flight violated NTZ -> has to go around */
-    auto ntzViolationIt = std::find(this->m_ntzViolations.cbegin(), this->m_ntzViolations.cend(), flight.callsign());
-    bool violatesNtz = this->m_ntzViolations.cend() != ntzViolationIt;
+void STCDControl::updateInbound(const types::Flight& flight) {
+    auto slot = this->m_inbounds.update(flight);
+
+    /* the runway and WTC columns follow the slots of the kinematic table */
+    if (this->m_inboundRunways.size() == slot) {
+        this->m_inboundRunways.push_back(flight.flightPlan().arrivalRunway());
+        this->m_inboundWtcs.push_back(flight.flightPlan().aircraft().wtc());
+    }
+    else {
+        this->m_inboundRunways[slot] = flight.flightPlan().arrivalRunway();
+        this->m_inboundWtcs[slot] = flight.flightPlan().aircraft().wtc();
+    }
+}
+
+void STCDControl::removeInbound(types::FlightId id) {
+    auto slot = this->m_inbounds.slot(id);
+    if (types::KinematicTable::InvalidSlot == slot)
+        return;
 
-    this->removeFlight(flight.callsign());
+    /* the table moves the last flight into the free slot -> move its columns as well */
+    this->m_inbounds.erase(id);
+    this->m_inboundRunways[slot] = this->m_inboundRunways.back();
+    this->m_inboundRunways.pop_back();
+    this->m_inboundWtcs[slot] = this->m_inboundWtcs.back();
+    this->m_inboundWtcs.pop_back();
+}
 
+void STCDControl::calculateInboundDistances(const types::Flight& flight) {
+    /* the buffer keeps its capacity between the updates */
+    this->m_inboundDistances.resize(this->m_inbounds.size());
+    this->m_localPlane.distances(flight.currentPosition().coordinate(), this->m_inbounds.latitudes(),
+                                 this->m_inbounds.longitudes(), this->m_inboundDistances);
+}
+
+bool STCDControl::approachesRunway(const types::Flight& flight) const {
     /* ignore landed or going around flights */
     bool landed = 40_kn > flight.groundSpeed() || this->m_airportElevation >= flight.currentPosition().altitude();
     if (true == landed || types::FlightPlan::AtcCommand::GoAround == flight.flightPlan().arrivalFlag())
-        return;
+        return false;
 
     /* find the corresponding runway */
-    types::Runway inboundRunway;
+    const types::Runway* inboundRunway = nullptr;
     for (const auto& runway : std::as_const(this->m_runways)) {
         if (runway.name() == flight.flightPlan().arrivalRunway()) {
-            inboundRunway = runway;
+            inboundRunway = &runway;
             break;
         }
     }
-    if (0 == inboundRunway.name().length())
-        return;
+    if (nullptr == inboundRunway)
+        return false;
 
     /* validate that the flight is close enough and on the correct heading */
-    if (20_nm <= inboundRunway.start().distanceTo(flight.currentPosition().coordinate()))
-        return;
-    auto delta = flight.currentPosition().heading() - inboundRunway.heading();
+    if (20_nm <= this->m_localPlane.distance(inboundRunway->start(), flight.currentPosition().coordinate()))
+        return false;
+    auto delta = flight.currentPosition().heading() - inboundRunway->heading();
     __normalizeAngle(delta);
-    if (15_deg <= delta.abs())
-        return;
+    return 15_deg > delta.abs();
+}
 
+void STCDControl::analyzeInbound(const types::Flight& flight) {
     /* flight violated NTZ -> has to go around */
-    if (true == violatesNtz) {
-        this->m_ntzViolations.push_back(flight.callsign());
+    auto ntzViolationIt = std::find(this->m_ntzViolations.begin(), this->m_ntzViolations.end(), flight.id());
+    bool violatesNtz = this->m_ntzViolations.end() != ntzViolationIt;
+    if (true == violatesNtz)
+        this->m_ntzViolations.erase(ntzViolationIt);
+    this->m_conflicts.erase(flight.id());
+
+    if (false == this->approachesRunway(flight)) {
+        this->removeInbound(flight.id());
         return;
     }
 
     /* test if a flight is in the NTZ */
-    for (const auto& ntz : std::as_const(this->m_noTransgressionZones)) {
-        /* flight is inside the NTZ -> mark it and return */
-        if (true == ntz.isInsideBorder(flight.currentPosition().coordinate())) {
-            if (this->m_ntzViolations.cend() == ntzViolationIt)
-                this->m_ntzViolations.push_back(flight.callsign());
-            return;
-        }
+    for (auto it = this->m_noTransgressionZones.cbegin(); false == violatesNtz && this->m_noTransgressionZones.cend() != it; ++it)
+        violatesNtz = it->isInsideBorder(flight.currentPosition().coordinate());
+
+    /* flight violated NTZ -> mark it until it goes around */
+    if (true == violatesNtz) {
+        this->m_ntzViolations.push_back(flight.id());
+        this->removeInbound(flight.id());
+        return;
     }
 
-    /* find nearest flight */
+    /* find the nearest flight in front of this flight with one sweep over the table */
     const auto& config = system::ConfigurationRegistry::instance().runtimeConfiguration();
+    const auto& arrivalRunway = flight.flightPlan().arrivalRunway();
+    const auto ids = this->m_inbounds.ids();
     types::Length minDistance = 50_nm;
-    types::Aircraft::WTC neighborWtc;
-    types::Position neighborPosition;
-    std::string neighborCallsign;
-    std::string neighborRunway;
-    for (auto& inbound : std::as_const(this->m_inbounds)) {
-        /* ignore neighboring flights */
-        if (true == config.ipaActive && inbound.flightPlan().arrivalRunway() != flight.flightPlan().arrivalRunway())
+    types::Aircraft::WTC neighborWtc = types::Aircraft::WTC::Unknown;
+    types::RunwayCode neighborRunway;
+
+    this->calculateInboundDistances(flight);
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        /* ignore the flight itself, farther flights and the neighboring flights */
+        if (flight.id() == ids[i] || this->m_inboundDistances[i] > minDistance)
+            continue;
+        if (true == config.ipaActive && this->m_inboundRunways[i] != arrivalRunway)
             continue;
 
         /* validate that the candidate is in front of this flight */
-        delta = flight.currentPosition().coordinate().bearingTo(inbound.currentPosition().coordinate());
+        auto delta = this->m_localPlane.bearing(flight.currentPosition().coordinate(), this->m_inbounds.position(i).coordinate());
         delta -= flight.currentPosition().heading();
         __normalizeAngle(delta);
         if (90_deg < delta.abs())
             continue;
 
-        /* find the closest flight */
-        auto distance = inbound.currentPosition().coordinate().distanceTo(flight.currentPosition().coordinate());
-        if (distance <= minDistance) {
-            neighborWtc = inbound.flightPlan().aircraft().wtc();
-            neighborPosition = inbound.currentPosition();
-            neighborCallsign = inbound.callsign();
-            neighborRunway = inbound.flightPlan().arrivalRunway();
-            minDistance = distance;
-        }
+        neighborWtc = this->m_inboundWtcs[i];
+        neighborRunway = this->m_inboundRunways[i];
+        minDistance = this->m_inboundDistances[i];
     }
 
     /* find the minimum required distance */
     types::Length minRequiredDistance;
-    if (neighborRunway != flight.flightPlan().arrivalRunway()) {
+    if (neighborRunway != arrivalRunway) {
         minRequiredDistance = 3_nm;
     }
     else {
@@ -270,54 +315,60 @@ void STCDControl::analyzeInbound(const types::Flight& flight) {
 
     /* check the distance with the minDistance with minRequiredDistance */
     if (minDistance < minRequiredDistance)
-        this->m_conflicts[flight.callsign()] = minRequiredDistance;
+        this->m_conflicts[flight.id()] = minRequiredDistance;
 
-    this->m_inbounds.push_back(flight);
+    this->updateInbound(flight);
 }
 
 void STCDControl::analyzeOutbound(const types::Flight& flight) {
-    auto closestFlightIt = this->m_inbounds.cend();
+    types::Aircraft::WTC closestWtc = types::Aircraft::WTC::Unknown;
+    bool closestFound = false;
     types::Length minDistance = 999_nm;
 
     /* check if the flight reached the holding point */
     if (false == this->m_departureControl->readyForDeparture(flight))
         return;
 
+    /* the inbounds on independent runways are ignored */
+    const auto& config = system::ConfigurationRegistry::instance().airportConfiguration(this->m_airportIcao);
+    auto depIt = config.ipdRunways.find(flight.flightPlan().departureRunway());
+    const std::list<types::RunwayCode>* independentRunways = nullptr;
+    if (config.ipdRunways.cend() != depIt)
+        independentRunways = &depIt->second;
+
     /* find the closest inbound to check if the spacing is too small */
-    for (auto it = this->m_inbounds.cbegin(); this->m_inbounds.cend() != it; ++it) {
-        const auto& config = system::ConfigurationRegistry::instance().airportConfiguration(this->m_airportIcao);
-
-        /* check if the runways are independent */
-        auto depIt = config.ipdRunways.find(flight.flightPlan().departureRunway());
-        if (config.ipdRunways.cend() != depIt) {
-            auto ipdIt = std::find(depIt->second.cbegin(), depIt->second.cend(), it->flightPlan().arrivalRunway());
-            if (depIt->second.cend() != ipdIt)
+    this->calculateInboundDistances(flight);
+    for (std::size_t i = 0; i < this->m_inbounds.size(); ++i) {
+        if (minDistance <= this->m_inboundDistances[i])
+            continue;
+
+        if (nullptr != independentRunways) {
+            auto ipdIt = std::find(independentRunways->cbegin(), independentRunways->cend(), this->m_inboundRunways[i]);
+            if (independentRunways->cend() != ipdIt)
                 continue;
         }
 
-        auto distance = it->currentPosition().coordinate().distanceTo(flight.currentPosition().coordinate());
-
-        /* found a closer flight */
-        if (minDistance > distance) {
-            minDistance = distance;
-            closestFlightIt = it;
-        }
+        minDistance = this->m_inboundDistances[i];
+        closestWtc = this->m_inboundWtcs[i];
+        closestFound = true;
     }
 
     /* check if it is a conflict */
-    if (this->m_inbounds.cend() != closestFlightIt) {
-        auto id = std::make_pair(flight.flightPlan().aircraft().wtc(), closestFlightIt->flightPlan().aircraft().wtc());
+    if (true == closestFound) {
+        auto id = std::make_pair(flight.flightPlan().aircraft().wtc(), closestWtc);
         auto minRequiredDistance = system::Separation::EuclideanDistance.find(id)->second;
         if (minRequiredDistance >= minDistance) {
-            this->m_conflicts[flight.callsign()] = minRequiredDistance;
+            this->m_conflicts[flight.id()] = minRequiredDistance;
             return;
         }
     }
 
-    this->removeFlight(flight.callsign());
+    this->removeFlight(flight.id());
 }
 
 void STCDControl::updateFlight(const types::Flight& flight, types::Flight::Type type) {
+    system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::STCDControl);
+
     if (false == system::ConfigurationRegistry::instance().runtimeConfiguration().stcdActive ||
         false == system::ConfigurationRegistry::instance().systemConfiguration().stcdActive)
     {
@@ -334,42 +385,34 @@ void STCDControl::updateFlight(const types::Flight& flight, types::Flight::Type
         this->analyzeOutbound(flight);
 }
 
-void STCDControl::removeFlight(const std::string& callsign) {
+void STCDControl::removeFlight(types::FlightId id) {
     /* cleanup the NTZ violations */
-    auto ntzViolationIt = std::find(this->m_ntzViolations.begin(), this->m_ntzViolations.end(), callsign);
+    auto ntzViolationIt = std::find(this->m_ntzViolations.begin(), this->m_ntzViolations.end(), id);
     if (this->m_ntzViolations.end() != ntzViolationIt)
         this->m_ntzViolations.erase(ntzViolationIt);
 
     /* cleanup the inbounds */
-    for (auto it = this->m_inbounds.begin(); this->m_inbounds.end() != it; ++it) {
-        if (it->callsign() == callsign) {
-            this->m_inbounds.erase(it);
-            break;
-        }
-    }
+    this->removeInbound(id);
 
     /* cleanup the conflicts */
-    auto it = this->m_conflicts.find(callsign);
-    if (this->m_conflicts.end() != it)
-        this->m_conflicts.erase(it);
+    this->m_conflicts.erase(id);
 }
 
 bool STCDControl::ntzViolation(const types::Flight& flight) const {
-    auto it = std::find(this->m_ntzViolations.cbegin(), this->m_ntzViolations.cend(), flight.callsign());
+    auto it = std::find(this->m_ntzViolations.cbegin(), this->m_ntzViolations.cend(), flight.id());
     return this->m_ntzViolations.cend() != it;
 }
 
 bool STCDControl::separationLoss(const types::Flight& flight) const {
-    auto it = this->m_conflicts.find(flight.callsign());
-    return this->m_conflicts.cend() != it;
+    return this->m_conflicts.contains(flight.id());
 }
 
 const types::Length& STCDControl::minSeparation(const types::Flight& flight) {
     static types::Length __fallback;
 
-    auto it = this->m_conflicts.find(flight.callsign());
-    if (this->m_conflicts.cend() != it)
-        return it->second;
+    auto separation = this->m_conflicts.find(flight.id());
+    if (nullptr != separation)
+        return *separation;
     else
         return __fallback;
 }
@@ -12,6 +12,7 @@
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <string_view>
 
 #include <formats/SettingsFileFormat.h>
 #include <system/ConfigurationRegistry.h>
@@ -21,8 +22,11 @@ namespace fs = std::filesystem;
 using namespace topskytower;
 using namespace topskytower::system;
 
+static const std::string_view __airportPrefix("TopSkyTowerAirport");
+
 ConfigurationRegistry::ConfigurationRegistry() :
         m_errorMessages(),
+        m_warningMessages(),
         m_configurationLock(),
         m_systemConfig(),
         m_runtimeConfig(),
@@ -47,13 +51,14 @@ bool ConfigurationRegistry::configure(const std::string& path, UpdateType type)
     bool retval = true;
 
     this->m_errorMessages.clear();
+    this->m_warningMessages.clear();
 
     this->m_configurationLock.lock();
     this->cleanup(type);
 
     if (UpdateType::All == type || UpdateType::System == type) {
         /* parse the global configuration */
-        formats::SettingsFileFormat settings(path + "\\TopSkyTowerSettings.txt");
+        formats::SettingsFileFormat settings((fs::path(path) / "TopSkyTowerSettings.txt").string());
         if (false == settings.parse(this->m_systemConfig)) {
             this->m_errorMessages.push_back("TopSkyTowerSettings.txt:" + std::to_string(settings.errorLine()) +
                                             ": " + settings.errorMessage());
@@ -61,7 +66,7 @@ bool ConfigurationRegistry::configure(const std::string& path, UpdateType type)
         }
 
         /* parse the Hoppies code */
-        std::ifstream stream(path + "\\TopSkyTowerHoppies.txt");
+        std::ifstream stream((fs::path(path) / "TopSkyTowerHoppies.txt").string());
         for (std::string line; std::getline(stream, line);) {
             if (0 != line.size()) {
                 this->m_systemConfig.hoppiesCode = line;
@@ -70,8 +75,8 @@ bool ConfigurationRegistry::configure(const std::string& path, UpdateType type)
         }
 
         /* parse the local settings */
-        if (true == std::filesystem::exists(path + "\\TopSkyTowerSettingsLocal.txt")) {
-            formats::SettingsFileFormat localSettings(path + "\\TopSkyTowerSettingsLocal.txt");
+        if (true == std::filesystem::exists(fs::path(path) / "TopSkyTowerSettingsLocal.txt")) {
+            formats::SettingsFileFormat localSettings((fs::path(path) / "TopSkyTowerSettingsLocal.txt").string());
             if (false == localSettings.parse(this->m_systemConfig) && 0 != localSettings.errorLine()) {
                 this->m_errorMessages.push_back("TopSkyTowerSettingsLocal.txt:" + std::to_string(localSettings.errorLine()) +
                                                 ": " + localSettings.errorMessage());
@@ -82,30 +87,35 @@ bool ConfigurationRegistry::configure(const std::string& path, UpdateType type)
 
     if (UpdateType::All == type || UpdateType::Airports == type) {
         for (auto& entry : fs::recursive_directory_iterator(path)) {
-            if (true == fs::is_regular_file(entry) && 0 == entry.path().filename().string().find("TopSkyTowerAirport")) {
-                /* extract the ICAO code of the airport */
-                auto filename = entry.path().filename().stem().string();
-                auto icao = filename.substr(filename.length() - 4, 4);
+            auto filename = entry.path().filename().string();
+            if (false == fs::is_regular_file(entry) || ".txt" != entry.path().extension() || 0 != filename.find(__airportPrefix))
+                continue;
+
+            /* extract the ICAO code of the airport and ignore files like backups */
+            auto icao = entry.path().stem().string().substr(__airportPrefix.length());
+            if (4 != icao.length()) {
+                this->m_warningMessages.push_back(filename + ":0:Ignored due to an invalid ICAO code in the filename: " + icao);
+                continue;
+            }
 
 #pragma warning(disable: 4244)
-                std::transform(icao.begin(), icao.end(), icao.begin(), ::toupper);
+            std::transform(icao.begin(), icao.end(), icao.begin(), ::toupper);
 #pragma warning(default: 4244)
 
-                /* read the configuration */
-                formats::AirportFileFormat airport(entry.path().string());
-                types::AirportConfiguration airportConfig;
-                if (false == airport.parse(airportConfig)) {
-                    this->m_errorMessages.push_back(filename + ".txt:" + std::to_string(airport.errorLine()) +
-                                                    ":" + airport.errorMessage());
-                    retval = false;
-                }
-                this->m_airportConfigurations[icao] = std::move(airportConfig);
+            /* read the configuration */
+            formats::AirportFileFormat airport(entry.path().string());
+            types::AirportConfiguration airportConfig;
+            if (false == airport.parse(airportConfig)) {
+                this->m_errorMessages.push_back(filename + ":" + std::to_string(airport.errorLine()) +
+                                                ":" + airport.errorMessage());
+                retval = false;
             }
+            this->m_airportConfigurations[types::IcaoCode(icao)] = std::move(airportConfig);
         }
     }
 
     if (UpdateType::All == type || UpdateType::Aircrafts == type) {
-        this->m_aircraftConfiguration = formats::AircraftFileFormat(path + "\\TopSkyTowerAircrafts.txt");
+        this->m_aircraftConfiguration = formats::AircraftFileFormat((fs::path(path) / "TopSkyTowerAircrafts.txt").string());
         if (true == this->m_aircraftConfiguration.errorFound()) {
             this->m_errorMessages.push_back("TopSkyTowerAircrafts.txt:" + std::to_string(this->m_aircraftConfiguration.errorLine()) +
                                             ": " + this->m_aircraftConfiguration.errorMessage());
@@ -116,7 +126,7 @@ bool ConfigurationRegistry::configure(const std::string& path, UpdateType type)
     if (UpdateType::All == type || UpdateType::Events == type) {
         this->m_eventsConfig.events.clear();
 
-        formats::EventRoutesFileFormat events(path + "\\TopSkyTowerEventRoutes.txt");
+        formats::EventRoutesFileFormat events((fs::path(path) / "TopSkyTowerEventRoutes.txt").string());
         if (false == events.parse(this->m_eventsConfig)) {
             if (0 != events.errorLine()) {
                 this->m_errorMessages.push_back("TopSkyTowerSettingsLocal.txt:" + std::to_string(events.errorLine()) +
@@ -144,6 +154,10 @@ const std::list<std::string>& ConfigurationRegistry::errorMessages() const {
     return this->m_errorMessages;
 }
 
+const std::list<std::string>& ConfigurationRegistry::warningMessages() const {
+    return this->m_warningMessages;
+}
+
 const types::SystemConfiguration& ConfigurationRegistry::systemConfiguration() {
     std::lock_guard guard(this->m_configurationLock);
     return this->m_systemConfig;
@@ -173,6 +187,10 @@ const types::RuntimeConfiguration& ConfigurationRegistry::runtimeConfiguration()
 }
 
 const types::AirportConfiguration& ConfigurationRegistry::airportConfiguration(const std::string& icao) {
+    return this->airportConfiguration(types::IcaoCode(icao));
+}
+
+const types::AirportConfiguration& ConfigurationRegistry::airportConfiguration(const types::IcaoCode& icao) {
     static types::AirportConfiguration __fallback;
 
     std::lock_guard guard(this->m_configurationLock);
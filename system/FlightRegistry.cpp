@@ -10,27 +10,79 @@
  */
 
 #include <system/FlightRegistry.h>
+#include <system/PerformanceRegistry.h>
 
 using namespace topskytower;
 using namespace topskytower::system;
 
-FlightRegistry::FlightRegistry() : m_flights() { }
+static __inline void __setFlags(types::Flight& flight, types::FlightPlan::AtcCommand departure, types::FlightPlan::AtcCommand arrival) {
+    const auto& plan = flight.flightPlan();
+    if (plan.departureFlag() == departure && plan.arrivalFlag() == arrival)
+        return;
+
+    /* the flight plan is shared -> assign a changed copy */
+    types::FlightPlan changed(plan);
+    changed.resetFlag(true);
+    changed.resetFlag(false);
+    changed.setFlag(departure);
+    changed.setFlag(arrival);
+    flight.setFlightPlan(changed);
+}
+
+FlightRegistry::Snapshot::Snapshot() :
+        m_epoch(0),
+        m_flights() { }
+
+std::uint64_t FlightRegistry::Snapshot::epoch() const {
+    return this->m_epoch;
+}
+
+bool FlightRegistry::Snapshot::flightExists(const std::string& callsign) const {
+    return this->m_flights.contains(types::CallsignTable::instance().find(callsign));
+}
+
+const types::Flight& FlightRegistry::Snapshot::flight(const std::string& callsign) const {
+    static types::Flight fallback;
+
+    auto entry = this->m_flights.find(types::CallsignTable::instance().find(callsign));
+    if (nullptr != entry)
+        return **entry;
+    else
+        return fallback;
+}
+
+const types::FlightMap<std::shared_ptr<const types::Flight>>& FlightRegistry::Snapshot::flights() const {
+    return this->m_flights;
+}
+
+FlightRegistry::FlightRegistry() :
+        m_flights(),
+        m_changedFlights(),
+        m_removedFlights(false),
+        m_snapshotLock(),
+        m_snapshot(std::make_shared<const Snapshot>()) { }
 
 void FlightRegistry::updateFlight(const types::Flight& flight) {
-    std::string callsign(flight.callsign());
-    auto it = this->m_flights.find(callsign);
+    PerformanceRegistry::Measurement measurement(PerformanceRegistry::Component::FlightRegistry);
+
+    auto entry = this->m_flights.find(flight.id());
+    this->m_changedFlights[flight.id()] = true;
 
-    if (this->m_flights.end() != it) {
+    if (nullptr != entry) {
         /* track the flags of the last update */
-        auto depFlags = it->second.first.flightPlan().departureFlag();
-        auto arrFlags = it->second.first.flightPlan().arrivalFlag();
-        bool airborne = it->second.first.airborne();
+        auto depFlags = entry->first.flightPlan().departureFlag();
+        auto arrFlags = entry->first.flightPlan().arrivalFlag();
+        bool airborne = entry->first.airborne();
 
         /* update the flight information */
-        it->second.first = flight;
+        entry->first = flight;
 
         /* update the internal flags, if needed */
-        it->second.first.setAirborne(true == airborne ? true : it->second.first.airborne());
+        entry->first.setAirborne(true == airborne ? true : entry->first.airborne());
+
+        /* merge the flags first to change the shared flight plan only if needed */
+        auto departure = flight.flightPlan().departureFlag();
+        auto arrival = flight.flightPlan().arrivalFlag();
 
         /* an update of the departure flag is possible */
         if (types::FlightPlan::AtcCommand::Unknown != flight.flightPlan().departureFlag()) {
@@ -39,8 +91,8 @@ void FlightRegistry::updateFlight(const types::Flight& flight) {
             /* one of the ES standard flags is set */
             if (types::FlightPlan::AtcCommand::Deicing != newFlag && types::FlightPlan::AtcCommand::LineUp != newFlag) {
                 /* the standard flag changed -> use the new flag and store it */
-                if (it->second.second != newFlag) {
-                    it->second.second = newFlag;
+                if (entry->second != newFlag) {
+                    entry->second = newFlag;
                     depFlags = newFlag;
                 }
             }
@@ -50,40 +102,55 @@ void FlightRegistry::updateFlight(const types::Flight& flight) {
             }
 
             if (types::FlightPlan::AtcCommand::StartUp == newFlag && types::FlightPlan::AtcCommand::Unknown == depFlags)
-                it->second.first.flightPlan().resetFlag(true);
-            else
-                it->second.first.flightPlan().setFlag(depFlags);
+                departure = types::FlightPlan::AtcCommand::Unknown;
+            else if (types::FlightPlan::AtcCommand::Unknown != depFlags)
+                departure = depFlags;
         }
         /* restore the old entry */
         else if (types::FlightPlan::AtcCommand::Unknown != depFlags) {
-            it->second.first.flightPlan().setFlag(depFlags);
+            departure = depFlags;
         }
 
         /* no update of the arrival flag is possible -> restore the old status */
         if (types::FlightPlan::AtcCommand::Unknown == flight.flightPlan().arrivalFlag())
-            it->second.first.flightPlan().setFlag(arrFlags);
+            arrival = arrFlags;
+
+        __setFlags(entry->first, departure, arrival);
     }
     else {
-        this->m_flights[callsign] = std::make_pair(flight, flight.flightPlan().departureFlag());
+        this->m_flights[flight.id()] = std::make_pair(flight, flight.flightPlan().departureFlag());
     }
 }
 
 void FlightRegistry::removeFlight(const std::string& callsign) {
-    auto it = this->m_flights.find(callsign);
-    if (this->m_flights.end() != it)
-        this->m_flights.erase(it);
+    this->removeFlight(types::CallsignTable::instance().find(callsign));
+}
+
+void FlightRegistry::removeFlight(types::FlightId id) {
+    if (true == this->m_flights.erase(id)) {
+        this->m_changedFlights.erase(id);
+        this->m_removedFlights = true;
+    }
 }
 
 bool FlightRegistry::flightExists(const std::string& callsign) const {
-    return this->m_flights.cend() != this->m_flights.find(callsign);
+    return this->m_flights.contains(types::CallsignTable::instance().find(callsign));
+}
+
+bool FlightRegistry::flightExists(types::FlightId id) const {
+    return this->m_flights.contains(id);
 }
 
 const types::Flight& FlightRegistry::flight(const std::string& callsign) const {
+    return this->flight(types::CallsignTable::instance().find(callsign));
+}
+
+const types::Flight& FlightRegistry::flight(types::FlightId id) const {
     static types::Flight fallback;
 
-    auto it = this->m_flights.find(callsign);
-    if (this->m_flights.cend() != it)
-        return it->second.first;
+    auto entry = this->m_flights.find(id);
+    if (nullptr != entry)
+        return entry->first;
     else
         return fallback;
 }
@@ -91,45 +158,70 @@ const types::Flight& FlightRegistry::flight(const std::string& callsign) const {
 void FlightRegistry::setAtcClearanceFlag(const types::Flight& flight, std::uint16_t flag) {
     types::FlightPlan::AtcCommand departure = static_cast<types::FlightPlan::AtcCommand>(flag & 0x0ff);
     types::FlightPlan::AtcCommand arrival = static_cast<types::FlightPlan::AtcCommand>(flag & 0xf00);
-    auto it = this->m_flights.find(flight.callsign());
+    auto entry = this->m_flights.find(flight.id());
 
-    if (this->m_flights.end() == it)
+    if (nullptr == entry)
         return;
+    this->m_changedFlights[flight.id()] = true;
 
     switch (departure) {
     case types::FlightPlan::AtcCommand::Unknown:
-        if (types::FlightPlan::AtcCommand::Unknown != it->second.second)
-            it->second.second = types::FlightPlan::AtcCommand::StartUp;
+        if (types::FlightPlan::AtcCommand::Unknown != entry->second)
+            entry->second = types::FlightPlan::AtcCommand::StartUp;
         break;
     case types::FlightPlan::AtcCommand::StartUp:
-        it->second.second = types::FlightPlan::AtcCommand::StartUp;
+        entry->second = types::FlightPlan::AtcCommand::StartUp;
         break;
     case types::FlightPlan::AtcCommand::Pushback:
-        it->second.second = types::FlightPlan::AtcCommand::Pushback;
+        entry->second = types::FlightPlan::AtcCommand::Pushback;
         break;
     case types::FlightPlan::AtcCommand::TaxiOut:
     case types::FlightPlan::AtcCommand::LineUp:
-        it->second.second = types::FlightPlan::AtcCommand::TaxiOut;
+        entry->second = types::FlightPlan::AtcCommand::TaxiOut;
         break;
     case types::FlightPlan::AtcCommand::Departure:
-        it->second.second = types::FlightPlan::AtcCommand::Departure;
+        entry->second = types::FlightPlan::AtcCommand::Departure;
         break;
     case types::FlightPlan::AtcCommand::Deicing:
     default:
         break;
     }
 
-    /* update the departure status */
-    if (types::FlightPlan::AtcCommand::Unknown == departure)
-        it->second.first.flightPlan().resetFlag(true);
-    else
-        it->second.first.flightPlan().setFlag(departure);
+    /* update the departure and arrival status */
+    __setFlags(entry->first, departure, arrival);
+}
 
-    /* update the arrival status */
-    if (types::FlightPlan::AtcCommand::Unknown == arrival)
-        it->second.first.flightPlan().resetFlag(false);
-    else
-        it->second.first.flightPlan().setFlag(arrival);
+void FlightRegistry::publish() {
+    PerformanceRegistry::Measurement measurement(PerformanceRegistry::Component::FlightRegistry);
+
+    if (0 == this->m_changedFlights.size() && false == this->m_removedFlights)
+        return;
+
+    /* only the writer replaces the snapshot -> the last snapshot can be read without the lock */
+    const auto& last = *this->m_snapshot;
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->m_epoch = last.m_epoch + 1;
+
+    /* share the unchanged flights with the last snapshot */
+    this->m_flights.forEach([&](types::FlightId id, const std::pair<types::Flight, types::FlightPlan::AtcCommand>& entry) {
+        auto shared = last.m_flights.find(id);
+
+        if (nullptr != shared && false == this->m_changedFlights.contains(id))
+            snapshot->m_flights[id] = *shared;
+        else
+            snapshot->m_flights[id] = std::make_shared<const types::Flight>(entry.first);
+    });
+
+    this->m_changedFlights.clear();
+    this->m_removedFlights = false;
+
+    std::lock_guard guard(this->m_snapshotLock);
+    this->m_snapshot = std::move(snapshot);
+}
+
+std::shared_ptr<const FlightRegistry::Snapshot> FlightRegistry::snapshot() const {
+    std::lock_guard guard(this->m_snapshotLock);
+    return this->m_snapshot;
 }
 
 FlightRegistry& FlightRegistry::instance() {
@@ -0,0 +1,191 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the performance registry
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <algorithm>
+
+#include <helper/PerformanceCounter.h>
+#include <system/PerformanceRegistry.h>
+
+using namespace topskytower;
+using namespace topskytower::system;
+
+PerformanceRegistry::Measurement::Measurement(Component component) :
+        m_component(component),
+        m_start(std::chrono::steady_clock::now()),
+        m_geodesicSolves(helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve)),
+        m_polygonTests(helper::PerformanceCounter::value(helper::PerformanceCounter::Type::PolygonTest)),
+        m_allocations(helper::PerformanceCounter::value(helper::PerformanceCounter::Type::Allocation)),
+        m_allocatedBytes(helper::PerformanceCounter::value(helper::PerformanceCounter::Type::AllocatedBytes)) { }
+
+PerformanceRegistry::Measurement::~Measurement() {
+    Sample sample;
+
+    sample.component = this->m_component;
+    sample.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->m_start);
+    sample.geodesicSolves = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve) - this->m_geodesicSolves;
+    sample.polygonTests = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::PolygonTest) - this->m_polygonTests;
+    sample.allocations = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::Allocation) - this->m_allocations;
+    sample.allocatedBytes = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::AllocatedBytes) - this->m_allocatedBytes;
+
+    PerformanceRegistry::instance().record(sample);
+}
+
+PerformanceRegistry::RingBuffer::RingBuffer() :
+        entries(),
+        head(0),
+        counters() {
+    for (auto& entry : this->entries) {
+        entry.component.store(0, std::memory_order_relaxed);
+        entry.duration.store(0, std::memory_order_relaxed);
+        entry.geodesicSolves.store(0, std::memory_order_relaxed);
+        entry.polygonTests.store(0, std::memory_order_relaxed);
+        entry.allocations.store(0, std::memory_order_relaxed);
+        entry.allocatedBytes.store(0, std::memory_order_relaxed);
+    }
+    for (auto& counter : this->counters) {
+        counter.calls.store(0, std::memory_order_relaxed);
+        counter.duration.store(0, std::memory_order_relaxed);
+        counter.maxDuration.store(0, std::memory_order_relaxed);
+        counter.geodesicSolves.store(0, std::memory_order_relaxed);
+        counter.polygonTests.store(0, std::memory_order_relaxed);
+        counter.allocations.store(0, std::memory_order_relaxed);
+        counter.allocatedBytes.store(0, std::memory_order_relaxed);
+    }
+}
+
+PerformanceRegistry::PerformanceRegistry() :
+        m_buffersLock(),
+        m_buffers() { }
+
+PerformanceRegistry::RingBuffer& PerformanceRegistry::threadBuffer() {
+    static thread_local RingBuffer* __buffer = nullptr;
+
+    /* the buffers are owned by the registry to keep the samples of terminated threads */
+    if (nullptr == __buffer) {
+        std::lock_guard guard(this->m_buffersLock);
+        this->m_buffers.push_back(std::make_unique<RingBuffer>());
+        __buffer = this->m_buffers.back().get();
+    }
+
+    return *__buffer;
+}
+
+void PerformanceRegistry::record(const Sample& sample) {
+    auto& buffer = this->threadBuffer();
+    auto duration = static_cast<std::int64_t>(sample.duration.count());
+
+    /* only the owning thread writes into the buffer -> no read-modify-write operations are needed */
+    auto head = buffer.head.load(std::memory_order_relaxed);
+    auto& entry = buffer.entries[head % PerformanceRegistry::BufferSize];
+    entry.component.store(static_cast<std::uint64_t>(sample.component), std::memory_order_relaxed);
+    entry.duration.store(duration, std::memory_order_relaxed);
+    entry.geodesicSolves.store(sample.geodesicSolves, std::memory_order_relaxed);
+    entry.polygonTests.store(sample.polygonTests, std::memory_order_relaxed);
+    entry.allocations.store(sample.allocations, std::memory_order_relaxed);
+    entry.allocatedBytes.store(sample.allocatedBytes, std::memory_order_relaxed);
+    buffer.head.store(head + 1, std::memory_order_release);
+
+    auto& counter = buffer.counters[static_cast<std::size_t>(sample.component)];
+    counter.calls.store(counter.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    counter.duration.store(counter.duration.load(std::memory_order_relaxed) + duration, std::memory_order_relaxed);
+    if (counter.maxDuration.load(std::memory_order_relaxed) < duration)
+        counter.maxDuration.store(duration, std::memory_order_relaxed);
+    counter.geodesicSolves.store(counter.geodesicSolves.load(std::memory_order_relaxed) + sample.geodesicSolves,
+                                 std::memory_order_relaxed);
+    counter.polygonTests.store(counter.polygonTests.load(std::memory_order_relaxed) + sample.polygonTests,
+                               std::memory_order_relaxed);
+    counter.allocations.store(counter.allocations.load(std::memory_order_relaxed) + sample.allocations,
+                              std::memory_order_relaxed);
+    counter.allocatedBytes.store(counter.allocatedBytes.load(std::memory_order_relaxed) + sample.allocatedBytes,
+                                 std::memory_order_relaxed);
+}
+
+PerformanceRegistry::Snapshot PerformanceRegistry::snapshot() const {
+    Snapshot retval;
+
+    for (auto& statistics : retval.statistics)
+        statistics = { 0, std::chrono::nanoseconds(0), std::chrono::nanoseconds(0), 0, 0, 0, 0 };
+    retval.allocationAccounting = helper::PerformanceCounter::allocationAccounting();
+
+    std::lock_guard guard(this->m_buffersLock);
+
+    for (const auto& buffer : std::as_const(this->m_buffers)) {
+        for (std::size_t i = 0; i < static_cast<std::size_t>(Component::Count); ++i) {
+            const auto& counter = buffer->counters[i];
+            auto& statistics = retval.statistics[i];
+
+            statistics.calls += counter.calls.load(std::memory_order_relaxed);
+            statistics.duration += std::chrono::nanoseconds(counter.duration.load(std::memory_order_relaxed));
+            statistics.maxDuration = std::max(statistics.maxDuration,
+                                              std::chrono::nanoseconds(counter.maxDuration.load(std::memory_order_relaxed)));
+            statistics.geodesicSolves += counter.geodesicSolves.load(std::memory_order_relaxed);
+            statistics.polygonTests += counter.polygonTests.load(std::memory_order_relaxed);
+            statistics.allocations += counter.allocations.load(std::memory_order_relaxed);
+            statistics.allocatedBytes += counter.allocatedBytes.load(std::memory_order_relaxed);
+        }
+
+        auto end = buffer->head.load(std::memory_order_acquire);
+        auto start = end > PerformanceRegistry::BufferSize ? end - PerformanceRegistry::BufferSize : 0;
+
+        std::vector<Sample> samples;
+        samples.reserve(static_cast<std::size_t>(end - start));
+        for (auto idx = start; idx < end; ++idx) {
+            const auto& entry = buffer->entries[idx % PerformanceRegistry::BufferSize];
+            Sample sample;
+
+            sample.component = static_cast<Component>(entry.component.load(std::memory_order_relaxed));
+            sample.duration = std::chrono::nanoseconds(entry.duration.load(std::memory_order_relaxed));
+            sample.geodesicSolves = entry.geodesicSolves.load(std::memory_order_relaxed);
+            sample.polygonTests = entry.polygonTests.load(std::memory_order_relaxed);
+            sample.allocations = entry.allocations.load(std::memory_order_relaxed);
+            sample.allocatedBytes = entry.allocatedBytes.load(std::memory_order_relaxed);
+            samples.push_back(sample);
+        }
+
+        /* the owning thread may have overwritten the oldest entries while they were copied */
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto written = buffer->head.load(std::memory_order_relaxed);
+        auto valid = written >= PerformanceRegistry::BufferSize ? written - PerformanceRegistry::BufferSize + 1 : 0;
+        auto skip = valid > start ? std::min(static_cast<std::size_t>(valid - start), samples.size()) : 0;
+
+        retval.samples.insert(retval.samples.end(), samples.cbegin() + skip, samples.cend());
+    }
+
+    return retval;
+}
+
+const char* PerformanceRegistry::componentName(Component component) {
+    switch (component) {
+    case Component::SectorControl:
+        return "SectorControl";
+    case Component::StandControl:
+        return "StandControl";
+    case Component::DepartureSequenceControl:
+        return "DepartureSequenceControl";
+    case Component::MTCDControl:
+        return "MTCDControl";
+    case Component::STCDControl:
+        return "STCDControl";
+    case Component::ARIWSControl:
+        return "ARIWSControl";
+    case Component::CMACControl:
+        return "CMACControl";
+    case Component::FlightRegistry:
+        return "FlightRegistry";
+    default:
+        return "Unknown";
+    }
+}
+
+PerformanceRegistry& PerformanceRegistry::instance() {
+    static PerformanceRegistry __instance;
+    return __instance;
+}
@@ -0,0 +1,57 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the benchmark runner
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <iomanip>
+
+#include "Benchmark.h"
+
+using namespace topskytower;
+using namespace topskytower::benchmark;
+
+static __inline double __nanosecondsPerOperation(const Benchmark::Result& result) {
+    if (0 == result.iterations)
+        return 0.0;
+    return static_cast<double>(result.duration.count()) / static_cast<double>(result.iterations);
+}
+
+Benchmark::Benchmark(std::size_t iterations, const std::string& filter) :
+        m_iterations(iterations),
+        m_filter(filter),
+        m_results() { }
+
+const std::list<Benchmark::Result>& Benchmark::results() const {
+    return this->m_results;
+}
+
+void Benchmark::writeJson(std::ostream& stream) const {
+    stream << "{" << std::endl << "  \"benchmarks\": [" << std::endl;
+
+    std::size_t idx = 0;
+    for (const auto& result : std::as_const(this->m_results)) {
+        stream << "    { \"name\": \"" << result.name << "\", \"distribution\": \"" << result.distribution
+               << "\", \"iterations\": " << result.iterations
+               << ", \"nsPerOperation\": " << std::fixed << std::setprecision(3) << __nanosecondsPerOperation(result)
+               << ", \"checksum\": " << std::scientific << std::setprecision(9) << result.checksum << " }";
+        stream << (++idx != this->m_results.size() ? "," : "") << std::endl;
+    }
+
+    stream << "  ]" << std::endl << "}" << std::endl;
+}
+
+void Benchmark::writeCsv(std::ostream& stream) const {
+    stream << "name,distribution,iterations,nsPerOperation,checksum" << std::endl;
+
+    for (const auto& result : std::as_const(this->m_results)) {
+        stream << result.name << "," << result.distribution << "," << result.iterations << ","
+               << std::fixed << std::setprecision(3) << __nanosecondsPerOperation(result) << ","
+               << std::scientific << std::setprecision(9) << result.checksum << std::endl;
+    }
+}
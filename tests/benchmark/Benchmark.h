@@ -0,0 +1,100 @@
+/*
+ * @brief Defines a minimal benchmark runner with machine-readable results
+ * @file benchmark/Benchmark.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <ostream>
+#include <string>
+
+namespace topskytower {
+    namespace benchmark {
+        /**
+         * @brief Runs benchmark cases and collects the timings
+         * @ingroup benchmark
+         *
+         * Every case is executed for a warm-up phase and afterwards for the configured number of iterations.
+         * The case function receives the iteration index and returns a value that is accumulated into a checksum.
+         * The checksum avoids that the compiler removes the measured code and allows a comparison of the results
+         * between two builds.
+         */
+        class Benchmark {
+        public:
+            /**
+             * @brief Defines the result of a single benchmark case
+             */
+            struct Result {
+                std::string              name;         /**< The measured function */
+                std::string              distribution; /**< The input distribution */
+                std::size_t              iterations;   /**< The number of measured iterations */
+                std::chrono::nanoseconds duration;     /**< The complete duration of all iterations */
+                double                   checksum;     /**< The accumulated results of the function */
+            };
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            std::size_t       m_iterations;
+            std::string       m_filter;
+            std::list<Result> m_results;
+
+        public:
+            /**
+             * @brief Creates a benchmark runner
+             * @param[in] iterations The number of measured iterations per case
+             * @param[in] filter Only cases that contain the filter in the name are executed
+             */
+            Benchmark(std::size_t iterations, const std::string& filter);
+
+            /**
+             * @brief Runs a benchmark case
+             * @tparam F The case function type
+             * @param[in] name The measured function
+             * @param[in] distribution The input distribution
+             * @param[in] function The case function
+             */
+            template <typename F>
+            void run(const std::string& name, const std::string& distribution, F&& function) {
+                if (0 != this->m_filter.length() && std::string::npos == name.find(this->m_filter))
+                    return;
+
+                double checksum = 0.0;
+
+                /* warm up the caches and the branch predictors */
+                for (std::size_t i = 0; i < this->m_iterations / 10; ++i)
+                    checksum += static_cast<double>(function(i));
+
+                checksum = 0.0;
+                auto start = std::chrono::steady_clock::now();
+                for (std::size_t i = 0; i < this->m_iterations; ++i)
+                    checksum += static_cast<double>(function(i));
+                auto duration = std::chrono::steady_clock::now() - start;
+
+                this->m_results.push_back({ name, distribution, this->m_iterations,
+                                            std::chrono::duration_cast<std::chrono::nanoseconds>(duration), checksum });
+            }
+            /**
+             * @brief Returns all collected results
+             * @return The results
+             */
+            const std::list<Result>& results() const;
+            /**
+             * @brief Writes the results as a JSON document
+             * @param[in] stream The output stream
+             */
+            void writeJson(std::ostream& stream) const;
+            /**
+             * @brief Writes the results as a CSV table
+             * @param[in] stream The output stream
+             */
+            void writeCsv(std::ostream& stream) const;
+#endif
+        };
+    }
+}
@@ -0,0 +1,194 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Benchmarks the geodesic and geometric primitives of the types
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <types/Flight.h>
+#include <types/LocalTangentPlane.h>
+#include <types/SectorBorder.h>
+
+#include "Benchmark.h"
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+/* defines the area where the input samples are drawn from */
+struct Distribution {
+    std::string       name;
+    types::Coordinate center;
+    types::Length     radius;
+};
+
+/* contains the precomputed inputs of one distribution */
+struct Samples {
+    std::vector<types::Coordinate> from;
+    std::vector<types::Coordinate> to;
+    std::vector<types::Angle>      headings;
+    std::vector<types::Length>     distances;
+    std::vector<types::Flight>     flights;
+    types::SectorBorder            border;
+};
+
+static const std::size_t SampleCount = 4096;
+static const std::size_t BatchSize = 16;
+
+static __inline types::Coordinate __randomCoordinate(const Distribution& distribution, std::mt19937& generator) {
+    std::uniform_real_distribution<float> heading(0.0f, 360.0f);
+    std::uniform_real_distribution<float> distance(0.0f, 1.0f);
+
+    /* sqrt-scaling distributes the samples uniformly over the area */
+    return distribution.center.projection(heading(generator) * types::degree,
+                                          std::sqrt(distance(generator)) * distribution.radius);
+}
+
+static __inline Samples __createSamples(const Distribution& distribution, std::mt19937& generator) {
+    std::uniform_real_distribution<float> heading(0.0f, 360.0f);
+    std::uniform_real_distribution<float> distance(0.0f, 1.0f);
+    std::uniform_real_distribution<float> groundSpeed(0.0f, 450.0f);
+    std::uniform_real_distribution<float> altitude(0.0f, 30000.0f);
+    Samples retval;
+
+    retval.from.reserve(SampleCount);
+    retval.to.reserve(SampleCount);
+    retval.headings.reserve(SampleCount);
+    retval.distances.reserve(SampleCount);
+    retval.flights.reserve(SampleCount);
+
+    for (std::size_t i = 0; i < SampleCount; ++i) {
+        retval.from.push_back(__randomCoordinate(distribution, generator));
+        retval.to.push_back(__randomCoordinate(distribution, generator));
+        retval.headings.push_back(heading(generator) * types::degree);
+        retval.distances.push_back(distance(generator) * distribution.radius);
+
+        types::Flight flight("BENCH" + std::to_string(i));
+        flight.setCurrentPosition(types::Position(retval.from.back(), altitude(generator) * types::feet,
+                                                  heading(generator) * types::degree));
+        flight.setGroundSpeed(groundSpeed(generator) * types::knot);
+        retval.flights.push_back(std::move(flight));
+    }
+
+    /* the border is a circle with a realistic number of vertices around the center */
+    std::list<types::Coordinate> edges;
+    const std::size_t vertexCount = 256;
+    for (std::size_t i = 0; i < vertexCount; ++i) {
+        auto angle = static_cast<float>(i) * (360.0f / static_cast<float>(vertexCount)) * types::degree;
+        edges.push_back(distribution.center.projection(angle, 0.75f * distribution.radius));
+    }
+    retval.border = types::SectorBorder("BENCH", {}, 0_ft, 66000_ft);
+    retval.border.setEdges(edges);
+
+    return retval;
+}
+
+int main(int argc, char** argv) {
+    std::size_t iterations = 200000;
+    std::string filter, output;
+    bool csv = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument(argv[i]);
+
+        if ("--iterations" == argument && i + 1 < argc) {
+            iterations = static_cast<std::size_t>(std::atoll(argv[++i]));
+        }
+        else if ("--filter" == argument && i + 1 < argc) {
+            filter = argv[++i];
+        }
+        else if ("--output" == argument && i + 1 < argc) {
+            output = argv[++i];
+        }
+        else if ("--csv" == argument) {
+            csv = true;
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--iterations N] [--filter NAME] [--output FILE] [--csv]" << std::endl;
+            return -1;
+        }
+    }
+
+    const std::vector<Distribution> distributions = {
+        { "airport",      types::Coordinate(8.5706f * types::degree, 50.0333f * types::degree), 20_nm },
+        { "fir",          types::Coordinate(10.0f * types::degree, 50.0f * types::degree),      250_nm },
+        { "antimeridian", types::Coordinate(179.9f * types::degree, -17.0f * types::degree),    100_nm },
+    };
+
+    /* a fixed seed keeps the inputs identical between two builds */
+    std::mt19937 generator(42);
+    benchmark::Benchmark runner(iterations, filter);
+
+    for (const auto& distribution : std::as_const(distributions)) {
+        const auto samples = __createSamples(distribution, generator);
+        const types::LocalTangentPlane plane(distribution.center, 10_nm);
+        std::vector<types::Length> batch(BatchSize);
+
+        runner.run("Coordinate::distanceTo", distribution.name, [&samples](std::size_t i) {
+            i %= SampleCount;
+            return samples.from[i].distanceTo(samples.to[i]).convert(types::metre);
+        });
+        runner.run("Coordinate::bearingTo", distribution.name, [&samples](std::size_t i) {
+            i %= SampleCount;
+            return samples.from[i].bearingTo(samples.to[i]).convert(types::degree);
+        });
+        runner.run("Coordinate::distancesTo[16]", distribution.name, [&samples, &batch](std::size_t i) {
+            std::span<const types::Coordinate> targets(samples.to.data() + (i * BatchSize) % SampleCount, BatchSize);
+            samples.from[i % SampleCount].distancesTo(targets, batch);
+            return batch.front().convert(types::metre) + batch.back().convert(types::metre);
+        });
+        runner.run("LocalTangentPlane::distance", distribution.name, [&samples, &plane](std::size_t i) {
+            i %= SampleCount;
+            return plane.distance(samples.from[i], samples.to[i]).convert(types::metre);
+        });
+        runner.run("LocalTangentPlane::bearing", distribution.name, [&samples, &plane](std::size_t i) {
+            i %= SampleCount;
+            return plane.bearing(samples.from[i], samples.to[i]).convert(types::degree);
+        });
+        runner.run("LocalTangentPlane::distances[16]", distribution.name, [&samples, &plane, &batch](std::size_t i) {
+            std::span<const types::Coordinate> targets(samples.to.data() + (i * BatchSize) % SampleCount, BatchSize);
+            plane.distances(samples.from[i % SampleCount], targets, batch);
+            return batch.front().convert(types::metre) + batch.back().convert(types::metre);
+        });
+        runner.run("Coordinate::projection", distribution.name, [&samples](std::size_t i) {
+            i %= SampleCount;
+            return samples.from[i].projection(samples.headings[i], samples.distances[i]).latitude().convert(types::degree);
+        });
+        runner.run("SectorBorder::isInsideBorder", distribution.name, [&samples](std::size_t i) {
+            i %= SampleCount;
+            return true == samples.border.isInsideBorder(samples.from[i]) ? 1.0f : 0.0f;
+        });
+        runner.run("Flight::predict", distribution.name, [&samples](std::size_t i) {
+            i %= SampleCount;
+            return samples.flights[i].predict(20_s, 20_kn).coordinate().latitude().convert(types::degree);
+        });
+    }
+
+    if (0 != output.length()) {
+        std::ofstream stream(output);
+        if (true == csv)
+            runner.writeCsv(stream);
+        else
+            runner.writeJson(stream);
+    }
+    else if (true == csv) {
+        runner.writeCsv(std::cout);
+    }
+    else {
+        runner.writeJson(std::cout);
+    }
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the binary sector cache
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <formats/SectorCacheFileFormat.h>
+
+using namespace topskytower;
+using namespace topskytower::formats;
+
+static void __writeFile(const std::string& filename, const std::string& content) {
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    stream << content;
+}
+
+TEST(SectorCacheFileFormat, StoreAndLoad) {
+    auto directory = std::filesystem::temp_directory_path();
+    auto source = (directory / "TopSkyTowerCacheTest.ese").string();
+    auto filename = (directory / "TopSkyTowerCacheTest.bin").string();
+    std::vector<std::uint8_t> payload = { 1, 2, 3, 4, 5 };
+
+    __writeFile(source, "[POSITIONS]");
+    ASSERT_TRUE(SectorCacheFileFormat::store(filename, "TEST", "EDDF", { source }, payload));
+
+    SectorCacheFileFormat cache;
+    ASSERT_TRUE(cache.load(filename, "TEST", "EDDF"));
+    EXPECT_EQ(payload.size(), cache.payload().size());
+    EXPECT_TRUE(std::equal(payload.cbegin(), payload.cend(), cache.payload().begin()));
+
+    /* the cache belongs to one airport and one sector file */
+    EXPECT_FALSE(cache.load(filename, "TEST", "EDDM"));
+    EXPECT_FALSE(cache.load(filename, "OTHER", "EDDF"));
+
+    /* a modified source invalidates the cache */
+    __writeFile(source, "[POSITIONS]\n");
+    EXPECT_FALSE(cache.load(filename, "TEST", "EDDF"));
+    EXPECT_TRUE(cache.payload().empty());
+
+    std::filesystem::remove(source);
+    std::filesystem::remove(filename);
+}
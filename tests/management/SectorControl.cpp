@@ -0,0 +1,310 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the sector control
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <list>
+
+#include <gtest/gtest.h>
+
+#include <helper/PerformanceCounter.h>
+#include <management/SectorControl.h>
+
+using namespace topskytower;
+using namespace topskytower::management;
+using namespace topskytower::types;
+
+static SectorBorder __createBorder(const std::string& owner, std::vector<std::string>&& deputies, const Length& upperAltitude,
+                                   const std::list<Coordinate>& edges) {
+    SectorBorder border(std::string(owner), std::move(deputies), 0_ft, upperAltitude);
+    border.setEdges(edges);
+    return border;
+}
+
+static std::list<Coordinate> __createRectangle(const Coordinate& southWest, const Coordinate& northEast) {
+    return {
+        southWest,
+        Coordinate(northEast.longitude(), southWest.latitude()),
+        northEast,
+        Coordinate(southWest.longitude(), northEast.latitude())
+    };
+}
+
+static std::list<Sector> __createSectors(const Coordinate& airport) {
+    std::list<Coordinate> circle;
+    for (int i = 0; i < 64; ++i)
+        circle.push_back(airport.projection(static_cast<float>(i) * 5.625_deg, 5_nm));
+
+    /* the tower is inside the approach A and the approaches A, B and C are aligned from the west to the east */
+    Sector tower("FT", "EDDF", "", "TWR", "119.900");
+    tower.setBorders({ __createBorder("FT", { "FA", "FB", "FC" }, 3000_ft, circle) });
+
+    std::list<Sector> retval = { tower };
+    const std::pair<std::string, std::string> approaches[] = { { "A", "120.800" }, { "B", "118.500" }, { "C", "136.125" } };
+    for (int i = 0; i < 3; ++i) {
+        Sector approach("F" + approaches[i].first, "EDDF", std::string(approaches[i].first), "APP", std::string(approaches[i].second));
+
+        Coordinate southWest(airport.longitude() + (static_cast<float>(i) - 0.5f) * 1.0_deg, airport.latitude() - 0.5_deg);
+        Coordinate northEast(airport.longitude() + (static_cast<float>(i) + 0.5f) * 1.0_deg, airport.latitude() + 0.5_deg);
+        approach.setBorders({ __createBorder("F" + approaches[i].first, { "CTR" }, 10000_ft, __createRectangle(southWest, northEast)) });
+        retval.push_back(approach);
+    }
+
+    /* the center does not have any border and is only the deputy of the approaches */
+    retval.push_back(Sector("CTR", "EDGG", "", "CTR", "127.500"));
+
+    return retval;
+}
+
+static Flight __createFlight(const std::string& callsign, const Coordinate& coordinate, const Length& altitude) {
+    Flight flight(callsign);
+
+    flight.setAirborne(true);
+    flight.setTrackedState(true);
+    flight.setCurrentPosition(Position(coordinate, altitude, 90.0_deg));
+    flight.setGroundSpeed(250_kn);
+
+    return flight;
+}
+
+static const Coordinate __airport(8.5_deg, 50.0_deg);
+
+static void __controlApproachA(SectorControl& control) {
+    control.setOwnSector(ControllerInfo("FA", "EDDF_APP", "120.800", ""));
+    control.controllerUpdate(ControllerInfo("FB", "EDDF_B_APP", "118.500", ""));
+    control.controllerUpdate(ControllerInfo("FC", "EDDF_C_APP", "136.125", ""));
+}
+
+TEST(SectorControl, MissingHintSearchesIndex) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    __controlApproachA(control);
+
+    /* the positions 27 NM north of the airport are outside the raster */
+    auto flight = __createFlight("DLH1", Coordinate(9.5_deg, 50.45_deg), 5000_ft);
+    auto queries = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ(queries + 1, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery));
+    EXPECT_TRUE(control.isInSector(flight));
+    EXPECT_TRUE(control.handoffRequired(flight));
+    EXPECT_EQ("FB", control.handoffSector(flight).identifier());
+}
+
+TEST(SectorControl, HintSectorAvoidsIndex) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    __controlApproachA(control);
+
+    auto flight = __createFlight("DLH2", Coordinate(9.5_deg, 50.45_deg), 5000_ft);
+    control.updateFlight(flight, Flight::Type::Arrival);
+
+    /* the flight remains in the same sector */
+    flight.setCurrentPosition(Position(Coordinate(9.6_deg, 50.45_deg), 5000_ft, 90.0_deg));
+    auto queries = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ(queries, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery));
+    EXPECT_TRUE(control.handoffRequired(flight));
+    EXPECT_EQ("FB", control.handoffSector(flight).identifier());
+}
+
+TEST(SectorControl, NeighborSectorAvoidsIndex) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    __controlApproachA(control);
+
+    auto flight = __createFlight("DLH3", Coordinate(8.9_deg, 50.45_deg), 5000_ft);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_FALSE(control.handoffRequired(flight));
+
+    /* the flight moved into the adjacent sector */
+    flight.setCurrentPosition(Position(Coordinate(9.1_deg, 50.45_deg), 5000_ft, 90.0_deg));
+    auto queries = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ(queries, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery));
+    EXPECT_TRUE(control.handoffRequired(flight));
+    EXPECT_EQ("FB", control.handoffSector(flight).identifier());
+}
+
+TEST(SectorControl, DistantSectorSearchesIndex) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    __controlApproachA(control);
+
+    auto flight = __createFlight("DLH4", Coordinate(8.9_deg, 50.45_deg), 5000_ft);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_FALSE(control.handoffRequired(flight));
+
+    /* the flight jumped into a sector that is not adjacent to the last one */
+    flight.setCurrentPosition(Position(Coordinate(10.5_deg, 50.45_deg), 5000_ft, 90.0_deg));
+    auto queries = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ(queries + 1, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery));
+    EXPECT_TRUE(control.handoffRequired(flight));
+    EXPECT_EQ("FC", control.handoffSector(flight).identifier());
+
+    /* the flight left all sectors */
+    flight.setCurrentPosition(Position(Coordinate(12.5_deg, 50.45_deg), 5000_ft, 90.0_deg));
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_FALSE(control.isInSector(flight));
+}
+
+TEST(SectorControl, RasterClassifiesCells) {
+    auto graph = std::make_shared<const SectorGraph>("EDDF", __createSectors(__airport));
+    std::span<const SectorGraph::RasterEntry> entries;
+
+    /* the cell is completely inside the approach and far away from the tower */
+    EXPECT_TRUE(graph->queryRaster(Coordinate(8.2_deg, 49.8_deg), entries));
+    ASSERT_EQ(1, entries.size());
+    EXPECT_EQ("FA", entries[0].border.first->sector.controllerInfo().identifier());
+    EXPECT_TRUE(entries[0].inside);
+
+    /* the cell contains the border of the tower */
+    EXPECT_TRUE(graph->queryRaster(__airport.projection(90.0_deg, 5_nm), entries));
+    ASSERT_EQ(2, entries.size());
+    for (const auto& entry : entries) {
+        if ("FT" == entry.border.first->sector.controllerInfo().identifier())
+            EXPECT_FALSE(entry.inside);
+        else
+            EXPECT_TRUE(entry.inside);
+    }
+
+    /* the raster ends 20 NM around the airport */
+    EXPECT_FALSE(graph->queryRaster(Coordinate(8.5_deg, 50.45_deg), entries));
+}
+
+TEST(SectorControl, RasterReplacesIndex) {
+    auto graph = std::make_shared<const SectorGraph>("EDDF", __createSectors(__airport));
+    SectorControl control(graph);
+    __controlApproachA(control);
+    control.controllerUpdate(ControllerInfo("FT", "EDDF_TWR", "119.900", ""));
+
+    /* the tower is only responsible below its upper altitude */
+    auto queries = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery);
+    auto tower = __createFlight("DLH5", __airport, 2000_ft);
+    control.updateFlight(tower, Flight::Type::Arrival);
+    EXPECT_TRUE(control.handoffRequired(tower));
+    EXPECT_EQ("FT", control.handoffSector(tower).identifier());
+
+    auto approach = __createFlight("DLH6", __airport, 5000_ft);
+    control.updateFlight(approach, Flight::Type::Arrival);
+    EXPECT_TRUE(control.isInSector(approach));
+    EXPECT_FALSE(control.handoffRequired(approach));
+
+    /* the flights close to the border of the tower use the partially covered cells */
+    auto border = __createFlight("DLH7", __airport.projection(270.0_deg, 4.8_nm), 2000_ft);
+    std::span<const SectorGraph::RasterEntry> entries;
+    EXPECT_TRUE(graph->queryRaster(border.currentPosition().coordinate(), entries));
+    EXPECT_EQ(2, entries.size());
+    control.updateFlight(border, Flight::Type::Arrival);
+    EXPECT_EQ("FT", control.handoffSector(border).identifier());
+    EXPECT_EQ(queries, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery));
+
+    /* the flights outside the raster need the index */
+    auto outside = __createFlight("DLH8", Coordinate(9.5_deg, 50.45_deg), 5000_ft);
+    control.updateFlight(outside, Flight::Type::Arrival);
+    EXPECT_EQ(queries + 1, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery));
+    EXPECT_EQ("FB", control.handoffSector(outside).identifier());
+}
+
+TEST(SectorControl, NoRasterCloseToPoles) {
+    const Coordinate airport(8.5_deg, 81.0_deg);
+    auto graph = std::make_shared<const SectorGraph>("EDDF", __createSectors(airport));
+    std::span<const SectorGraph::RasterEntry> entries;
+    EXPECT_FALSE(graph->queryRaster(airport, entries));
+
+    SectorControl control(graph);
+    __controlApproachA(control);
+    control.controllerUpdate(ControllerInfo("FT", "EDDF_TWR", "119.900", ""));
+
+    auto flight = __createFlight("DLH9", airport, 2000_ft);
+    auto queries = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ(queries + 1, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery));
+    EXPECT_EQ("FT", control.handoffSector(flight).identifier());
+}
+
+TEST(SectorControl, ClearanceKeepsBorderCrossings) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    __controlApproachA(control);
+
+    /* the flight approaches the border to the east and the prediction covers 1.4 NM */
+    auto flight = __createFlight("DLH10", Coordinate(8.8_deg, 50.42_deg), 5000_ft);
+    for (int i = 0; i <= 16; ++i) {
+        flight.setCurrentPosition(Position(Coordinate(8.8_deg + static_cast<float>(i) * 0.01_deg, 50.42_deg), 5000_ft, 90.0_deg));
+        control.updateFlight(flight, Flight::Type::Arrival);
+        EXPECT_FALSE(control.handoffRequired(flight));
+    }
+
+    /* the prediction crosses the border inside the radius of the last clearance */
+    flight.setCurrentPosition(Position(Coordinate(8.97_deg, 50.42_deg), 5000_ft, 90.0_deg));
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_TRUE(control.handoffRequired(flight));
+    EXPECT_EQ("FB", control.handoffSector(flight).identifier());
+}
+
+TEST(SectorControl, ClearanceSkipsPrediction) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    __controlApproachA(control);
+
+    auto flight = __createFlight("DLH11", Coordinate(9.5_deg, 50.0_deg), 5000_ft);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ("FB", control.handoffSector(flight).identifier());
+
+    /* the flight is far away from all borders and the prediction does not need a query */
+    flight.setCurrentPosition(Position(Coordinate(9.51_deg, 50.0_deg), 5000_ft, 90.0_deg));
+    auto solves = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve);
+    auto tests = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::PolygonTest);
+    auto queries = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ(solves, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve));
+    EXPECT_EQ(tests, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::PolygonTest));
+    EXPECT_EQ(queries, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::BorderQuery));
+    EXPECT_EQ("FB", control.handoffSector(flight).identifier());
+}
+
+TEST(SectorControl, OnlineStationAfterPrimaryOffline) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    __controlApproachA(control);
+    control.controllerUpdate(ControllerInfo("CTR", "EDGG_CTR", "127.500", ""));
+
+    auto flight = __createFlight("DLH12", Coordinate(9.5_deg, 50.0_deg), 5000_ft);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ("FB", control.handoffSector(flight).identifier());
+
+    /* the deputy takes over the sector */
+    control.controllerOffline(ControllerInfo("FB", "EDDF_B_APP", "118.500", ""));
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_TRUE(control.handoffRequired(flight));
+    EXPECT_EQ("CTR", control.handoffSector(flight).identifier());
+}
+
+TEST(SectorControl, OnlineStationAfterDeputyOnline) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    control.setOwnSector(ControllerInfo("FA", "EDDF_APP", "120.800", ""));
+
+    auto flight = __createFlight("DLH13", Coordinate(9.5_deg, 50.0_deg), 5000_ft);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_EQ("UNICOM", control.handoffSector(flight).identifier());
+
+    control.controllerUpdate(ControllerInfo("CTR", "EDGG_CTR", "127.500", ""));
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_TRUE(control.handoffRequired(flight));
+    EXPECT_EQ("CTR", control.handoffSector(flight).identifier());
+}
+
+TEST(SectorControl, OnlineStationAfterOwnSectorChange) {
+    SectorControl control("EDDF", __createSectors(__airport));
+    control.setOwnSector(ControllerInfo("FA", "EDDF_APP", "120.800", ""));
+
+    auto flight = __createFlight("DLH14", Coordinate(9.5_deg, 50.0_deg), 5000_ft);
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_TRUE(control.handoffRequired(flight));
+    EXPECT_EQ("UNICOM", control.handoffSector(flight).identifier());
+
+    /* the controller took over the sector of the flight */
+    control.setOwnSector(ControllerInfo("FB", "EDDF_APP", "118.500", ""));
+    control.updateFlight(flight, Flight::Type::Arrival);
+    EXPECT_FALSE(control.handoffRequired(flight));
+}
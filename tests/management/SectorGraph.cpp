@@ -0,0 +1,42 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the shared sector graph
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <gtest/gtest.h>
+
+#include <management/SectorGraph.h>
+
+using namespace topskytower;
+using namespace topskytower::management;
+
+TEST(SectorGraph, SharedPerKey) {
+    int created = 0;
+    auto create = [&created]() {
+        created += 1;
+        return std::make_shared<const SectorGraph>();
+    };
+
+    auto graph0 = SectorGraph::shared("TEST:EDDF", create);
+    auto graph1 = SectorGraph::shared("TEST:EDDF", create);
+    auto graph2 = SectorGraph::shared("TEST:EDDM", create);
+    EXPECT_EQ(graph0, graph1);
+    EXPECT_NE(graph0, graph2);
+    EXPECT_EQ(2, created);
+    EXPECT_EQ(graph0, SectorGraph::find("TEST:EDDF"));
+    EXPECT_EQ(nullptr, SectorGraph::find("TEST:EDDK"));
+
+    /* the graph is created again after all users released it */
+    graph0.reset();
+    graph1.reset();
+    EXPECT_EQ(nullptr, SectorGraph::find("TEST:EDDF"));
+    auto graph3 = SectorGraph::shared("TEST:EDDF", create);
+    EXPECT_EQ(3, created);
+    EXPECT_EQ(nullptr, graph3->root());
+}
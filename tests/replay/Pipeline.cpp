@@ -0,0 +1,262 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the headless radar target update pipeline
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <filesystem>
+
+#include <formats/EseFileFormat.h>
+#include <helper/Exception.h>
+#include <system/ConfigurationRegistry.h>
+#include <system/FlightRegistry.h>
+
+#include "Pipeline.h"
+
+using namespace topskytower;
+using namespace topskytower::replay;
+using namespace topskytower::types;
+
+Pipeline::Pipeline(const Recording& recording) :
+        m_airport(recording.airport()),
+        m_clock(std::chrono::system_clock::now()),
+        m_start(m_clock.now()),
+        m_projection(nullptr),
+        m_sectorControl(nullptr),
+        m_standControl(nullptr),
+        m_departureControl(nullptr),
+        m_ariwsControl(nullptr),
+        m_cmacControl(nullptr),
+        m_mtcdControl(nullptr),
+        m_stcdControl(nullptr),
+        m_statistics(),
+        m_flightPlans() {
+    if (false == system::ConfigurationRegistry::instance().configure(recording.configurationDirectory(),
+                                                                     system::ConfigurationRegistry::UpdateType::All)) {
+        std::string message;
+        for (const auto& error : std::as_const(system::ConfigurationRegistry::instance().errorMessages()))
+            message += error + "\n";
+        throw helper::Exception("Pipeline", "Unable to load the configuration:\n" + message);
+    }
+
+    auto configuration = system::ConfigurationRegistry::instance().runtimeConfiguration();
+    if (configuration.windInformation.cend() == configuration.windInformation.find(this->m_airport)) {
+        configuration.windInformation[this->m_airport] = types::WindData();
+        system::ConfigurationRegistry::instance().setRuntimeConfiguration(configuration);
+    }
+
+    /* the sector file parser searches in the working directory */
+    std::filesystem::current_path(recording.sectorDirectory());
+
+    formats::EseFileFormat file;
+    if (false == file.parse(recording.sectorName()))
+        throw helper::Exception("Pipeline", "Unable to find the sector file " + recording.sectorName());
+
+    /* find the center of the airport */
+    types::Coordinate center;
+    bool foundCenter = false;
+    for (const auto& sector : std::as_const(file.sectors())) {
+        if (sector.controllerInfo().prefix() == this->m_airport) {
+            center = sector.controllerInfo().centerPoint();
+            foundCenter = true;
+            break;
+        }
+    }
+    if (false == foundCenter)
+        throw helper::Exception("Pipeline", "Unable to find the center of " + this->m_airport);
+
+    /* the controls use the recorded time instead of the system time */
+    helper::Clock::setInstance(&this->m_clock);
+
+    this->m_projection = new types::ProjectionContext(center);
+    this->m_sectorControl = new management::SectorControl(this->m_airport, file.sectors());
+    this->m_standControl = new management::StandControl(this->m_airport, this->m_projection);
+    this->m_ariwsControl = new surveillance::ARIWSControl(this->m_airport, this->m_projection);
+    this->m_cmacControl = new surveillance::CMACControl(this->m_airport, this->m_projection);
+    this->m_departureControl = new management::DepartureSequenceControl(this->m_airport, this->m_projection);
+    this->m_mtcdControl = new surveillance::MTCDControl(this->m_projection, this->m_departureControl);
+    this->m_mtcdControl->registerSidExtraction(this, &Pipeline::extractPredictedSID);
+    this->m_stcdControl = new surveillance::STCDControl(this->m_airport, recording.elevation(), center,
+                                                        file.runways(this->m_airport), this->m_departureControl);
+}
+
+Pipeline::~Pipeline() {
+    if (nullptr != this->m_ariwsControl)
+        delete this->m_ariwsControl;
+    if (nullptr != this->m_cmacControl)
+        delete this->m_cmacControl;
+    if (nullptr != this->m_mtcdControl)
+        delete this->m_mtcdControl;
+    if (nullptr != this->m_stcdControl)
+        delete this->m_stcdControl;
+    if (nullptr != this->m_departureControl)
+        delete this->m_departureControl;
+    if (nullptr != this->m_sectorControl)
+        delete this->m_sectorControl;
+    if (nullptr != this->m_standControl)
+        delete this->m_standControl;
+    if (nullptr != this->m_projection)
+        delete this->m_projection;
+
+    helper::Clock::setInstance(nullptr);
+}
+
+types::Aircraft Pipeline::translateAircraft(const types::Aircraft& aircraft) {
+    const auto& aircrafts = system::ConfigurationRegistry::instance().aircrafts();
+    types::Aircraft retval;
+
+    /* use the same fallbacks as the EuroScope converter */
+    auto it = aircrafts.find(aircraft.icaoCode());
+    if (aircrafts.cend() == it) {
+        switch (aircraft.wtc()) {
+        case types::Aircraft::WTC::Light:
+            it = aircrafts.find("C172");
+            break;
+        case types::Aircraft::WTC::Heavy:
+            it = aircrafts.find("B744");
+            break;
+        case types::Aircraft::WTC::Super:
+            it = aircrafts.find("A388");
+            break;
+        case types::Aircraft::WTC::Medium:
+        default:
+            it = aircrafts.find("A320");
+            break;
+        }
+    }
+
+    if (aircrafts.cend() != it)
+        retval = it->second;
+    retval.setIcaoCode(aircraft.icaoCode());
+    if (types::Aircraft::WTC::Unknown != aircraft.wtc())
+        retval.setWTC(aircraft.wtc());
+
+    return retval;
+}
+
+types::Flight::Type Pipeline::identifyType(const types::Flight& flight) const {
+    types::IcaoCode airport(this->m_airport);
+
+    if (airport == flight.flightPlan().origin() && airport == flight.flightPlan().destination()) {
+        if (true == flight.airborne())
+            return types::Flight::Type::Arrival;
+        else
+            return types::Flight::Type::Departure;
+    }
+    else if (airport == flight.flightPlan().origin()) {
+        return types::Flight::Type::Departure;
+    }
+    else if (airport == flight.flightPlan().destination()) {
+        return types::Flight::Type::Arrival;
+    }
+    else {
+        return types::Flight::Type::Unknown;
+    }
+}
+
+std::vector<types::Coordinate> Pipeline::extractPredictedSID(const std::string& callsign) {
+    std::vector<types::Coordinate> retval;
+
+    if (false == system::FlightRegistry::instance().flightExists(callsign))
+        return retval;
+
+    /* the recording does not contain the EuroScope predictions -> use the route until the SID exit point */
+    const auto& flight = system::FlightRegistry::instance().flight(callsign);
+    const auto& waypoints = flight.flightPlan().route().waypoints();
+    retval.reserve(waypoints.size());
+
+    for (const auto& waypoint : std::as_const(waypoints)) {
+        retval.push_back(waypoint.position());
+        if (std::string::npos != flight.flightPlan().departureRoute().find(waypoint.name()))
+            return retval;
+    }
+
+    /* fallback to allow a maximum distance to filter the route */
+    retval.clear();
+    for (const auto& waypoint : std::as_const(waypoints)) {
+        if (50_nm < flight.currentPosition().coordinate().distanceTo(waypoint.position()))
+            break;
+        retval.push_back(waypoint.position());
+    }
+
+    return retval;
+}
+
+void Pipeline::updateFlight(const types::Flight& flight) {
+    types::Flight update(flight);
+
+    /* translate the aircraft only if the recorded flight plan changed */
+    auto& translated = this->m_flightPlans[flight.id()];
+    if (translated.first != flight.sharedFlightPlan()) {
+        types::FlightPlan plan(flight.flightPlan());
+        plan.setAircraft(Pipeline::translateAircraft(plan.aircraft()));
+        update.setFlightPlan(plan);
+        translated = std::make_pair(flight.sharedFlightPlan(), update.sharedFlightPlan());
+    }
+    else {
+        update.setFlightPlan(translated.second);
+    }
+
+    system::FlightRegistry::instance().updateFlight(update);
+
+    /* cache the flight plan with the merged flags to avoid a copy per update */
+    const auto& registered = system::FlightRegistry::instance().flight(flight.id());
+    translated.second = registered.sharedFlightPlan();
+    auto type = this->identifyType(registered);
+
+    auto start = std::chrono::steady_clock::now();
+    this->measure(Statistics::Stage::SectorControl, [&]() { this->m_sectorControl->updateFlight(registered, type); });
+    this->measure(Statistics::Stage::StandControl, [&]() { this->m_standControl->updateFlight(registered, type); });
+    this->measure(Statistics::Stage::DepartureSequenceControl, [&]() { this->m_departureControl->updateFlight(registered, type); });
+    this->measure(Statistics::Stage::MTCDControl, [&]() { this->m_mtcdControl->updateFlight(registered, type); });
+    this->measure(Statistics::Stage::STCDControl, [&]() { this->m_stcdControl->updateFlight(registered, type); });
+    this->measure(Statistics::Stage::ARIWSControl, [&]() { this->m_ariwsControl->updateFlight(registered, type); });
+    this->measure(Statistics::Stage::CMACControl, [&]() { this->m_cmacControl->updateFlight(registered, type); });
+    this->m_statistics.add(Statistics::Stage::Pipeline, std::chrono::steady_clock::now() - start);
+}
+
+void Pipeline::removeFlight(types::FlightId id) {
+    this->m_standControl->removeFlight(id);
+    this->m_sectorControl->removeFlight(id);
+    this->m_departureControl->removeFlight(id);
+    this->m_ariwsControl->removeFlight(id);
+    this->m_cmacControl->removeFlight(id);
+    this->m_mtcdControl->removeFlight(id);
+    this->m_stcdControl->removeFlight(id);
+
+    this->m_flightPlans.erase(id);
+    system::FlightRegistry::instance().removeFlight(id);
+}
+
+void Pipeline::process(const Recording::Event& event) {
+    this->m_clock.set(this->m_start + event.timestamp);
+
+    switch (event.type) {
+    case Recording::EventType::ControllerOnline:
+        this->m_sectorControl->controllerUpdate(event.controller);
+        break;
+    case Recording::EventType::ControllerOffline:
+        this->m_sectorControl->controllerOffline(event.controller);
+        break;
+    case Recording::EventType::OwnSector:
+        this->m_sectorControl->setOwnSector(event.controller);
+        break;
+    case Recording::EventType::FlightUpdate:
+        this->updateFlight(event.flight);
+        break;
+    case Recording::EventType::FlightDisconnect:
+        this->removeFlight(event.flight.id());
+        break;
+    default:
+        break;
+    }
+}
+
+Statistics& Pipeline::statistics() {
+    return this->m_statistics;
+}
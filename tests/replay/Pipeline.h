@@ -0,0 +1,104 @@
+/*
+ * @brief Defines the headless radar target update pipeline
+ * @file replay/Pipeline.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <helper/Clock.h>
+#include <management/DepartureSequenceControl.h>
+#include <management/SectorControl.h>
+#include <management/StandControl.h>
+#include <surveillance/ARIWSControl.h>
+#include <surveillance/CMACControl.h>
+#include <surveillance/MTCDControl.h>
+#include <surveillance/STCDControl.h>
+#include <types/FlightId.h>
+
+#include "Recording.h"
+#include "Statistics.h"
+
+namespace topskytower {
+    namespace replay {
+        /**
+         * @brief Replays recorded events through the same controls as the RADAR screen
+         * @ingroup replay
+         *
+         * The pipeline creates the controls in the same way as the RADAR screen does it during the initialization
+         * and forwards the radar target updates in the same order to the controls.
+         * Every control call is measured and stored in the statistics.
+         *
+         * The pipeline installs a simulated clock that follows the timestamps of the events.
+         * Therefore the time dependent controls behave as in the recorded session, independent of the replay speed.
+         */
+        class Pipeline {
+#ifndef DOXYGEN_IGNORE
+        private:
+            typedef std::pair<std::shared_ptr<const types::FlightPlan>, std::shared_ptr<const types::FlightPlan>> TranslatedFlightPlan;
+
+            std::string                            m_airport;
+            helper::SimulatedClock                 m_clock;
+            std::chrono::system_clock::time_point  m_start;
+            types::ProjectionContext*              m_projection;
+            management::SectorControl*             m_sectorControl;
+            management::StandControl*              m_standControl;
+            management::DepartureSequenceControl*  m_departureControl;
+            surveillance::ARIWSControl*            m_ariwsControl;
+            surveillance::CMACControl*             m_cmacControl;
+            surveillance::MTCDControl*             m_mtcdControl;
+            surveillance::STCDControl*             m_stcdControl;
+            Statistics                             m_statistics;
+            types::FlightMap<TranslatedFlightPlan> m_flightPlans;
+
+            template <typename F>
+            void measure(Statistics::Stage stage, F&& function) {
+                auto start = std::chrono::steady_clock::now();
+                function();
+                this->m_statistics.add(stage, std::chrono::steady_clock::now() - start);
+            }
+            static types::Aircraft translateAircraft(const types::Aircraft& aircraft);
+            types::Flight::Type identifyType(const types::Flight& flight) const;
+            std::vector<types::Coordinate> extractPredictedSID(const std::string& callsign);
+            void updateFlight(const types::Flight& flight);
+            void removeFlight(types::FlightId id);
+
+        public:
+            /**
+             * @brief Creates the pipeline for the recorded scenario
+             * The constructor throws an exception if the configuration or the sector file cannot be loaded.
+             * @param[in] recording The parsed recording
+             */
+            Pipeline(const Recording& recording);
+            /**
+             * @brief Destroys all controls
+             */
+            ~Pipeline();
+
+            Pipeline(const Pipeline& other) = delete;
+            Pipeline(Pipeline&& other) = delete;
+            Pipeline& operator=(const Pipeline& other) = delete;
+            Pipeline& operator=(Pipeline&& other) = delete;
+
+            /**
+             * @brief Forwards a recorded event to the controls
+             * @param[in] event The recorded event
+             */
+            void process(const Recording::Event& event);
+            /**
+             * @brief Returns the collected statistics
+             * @return The statistics
+             */
+            Statistics& statistics();
+#endif
+        };
+    }
+}
@@ -0,0 +1,261 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the recording parser
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+
+#include <helper/String.h>
+
+#include "Recording.h"
+
+using namespace topskytower;
+using namespace topskytower::replay;
+using namespace topskytower::types;
+
+static __inline types::Coordinate __parseCoordinate(const std::string& latitude, const std::string& longitude) {
+    return types::Coordinate(static_cast<float>(std::atof(longitude.c_str())) * types::degree,
+                             static_cast<float>(std::atof(latitude.c_str())) * types::degree);
+}
+
+static __inline types::Aircraft::WTC __parseWtc(const std::string& wtc) {
+    if (0 == wtc.length())
+        return types::Aircraft::WTC::Unknown;
+
+    switch (wtc[0]) {
+    case 'L':
+        return types::Aircraft::WTC::Light;
+    case 'M':
+        return types::Aircraft::WTC::Medium;
+    case 'H':
+        return types::Aircraft::WTC::Heavy;
+    case 'J':
+        return types::Aircraft::WTC::Super;
+    default:
+        return types::Aircraft::WTC::Unknown;
+    }
+}
+
+Recording::Recording(const std::string& filename) :
+        FileFormat(),
+        m_filename(filename),
+        m_airport(),
+        m_elevation(),
+        m_sectorDirectory(),
+        m_sectorName(),
+        m_configurationDirectory(),
+        m_events() { }
+
+std::string Recording::resolvePath(const std::string& path) const {
+    std::filesystem::path retval(path);
+
+    if (true == retval.is_relative())
+        retval = std::filesystem::absolute(std::filesystem::path(this->m_filename).parent_path() / retval);
+
+    return retval.lexically_normal().string();
+}
+
+types::ControllerInfo Recording::parseController(const std::vector<std::string>& elements) {
+    return types::ControllerInfo(elements[2], elements[3], elements[4], elements[5]);
+}
+
+types::Flight Recording::parseFlight(const std::vector<std::string>& elements) {
+    types::Flight retval(elements[2]);
+
+    types::Position position(__parseCoordinate(elements[3], elements[4]),
+                             static_cast<float>(std::atof(elements[5].c_str())) * types::feet,
+                             static_cast<float>(std::atof(elements[6].c_str())) * types::degree);
+    retval.setCurrentPosition(position);
+    retval.setGroundSpeed(static_cast<float>(std::atof(elements[7].c_str())) * types::knot);
+    retval.setAirborne(40_kn < retval.groundSpeed());
+    retval.setVerticalSpeed(static_cast<float>(std::atof(elements[8].c_str())) * (types::feet / types::minute));
+
+    types::FlightPlan plan;
+    if ("V" == elements[9])
+        plan.setType(types::FlightPlan::Type::VFR);
+    else if ("I" == elements[9])
+        plan.setType(types::FlightPlan::Type::IFR);
+
+    types::Aircraft aircraft;
+    aircraft.setIcaoCode(elements[10]);
+    aircraft.setWTC(__parseWtc(elements[11]));
+    plan.setAircraft(aircraft);
+
+    plan.setOrigin(elements[12]);
+    plan.setDestination(elements[13]);
+    plan.setDepartureRoute(elements[14]);
+    plan.setDepartureRunway(elements[15]);
+    plan.setArrivalRoute(elements[16]);
+    plan.setArrivalRunway(elements[17]);
+    plan.setClearanceFlag("1" == elements[18]);
+    plan.setRnavCapable(true);
+    plan.setTransponderExistence(true);
+
+    /* the departure and arrival flags cannot be set in one call */
+    auto flags = static_cast<std::uint16_t>(std::atoi(elements[19].c_str()));
+    if (0 != (flags & 0x0ff))
+        plan.setFlag(static_cast<types::FlightPlan::AtcCommand>(flags & 0x0ff));
+    if (0 != (flags & 0xf00))
+        plan.setFlag(static_cast<types::FlightPlan::AtcCommand>(flags & 0xf00));
+
+    std::vector<types::Waypoint> waypoints;
+    auto route = helper::String::splitString(elements[20], " ");
+    for (const auto& entry : std::as_const(route)) {
+        auto waypoint = helper::String::splitString(entry, "/");
+        if (3 == waypoint.size())
+            waypoints.push_back(types::Waypoint(waypoint[0], __parseCoordinate(waypoint[1], waypoint[2])));
+    }
+    plan.setRoute(types::Route(std::move(waypoints)));
+
+    retval.setFlightPlan(plan);
+
+    return retval;
+}
+
+bool Recording::parse() {
+    this->reset();
+    this->m_events.clear();
+
+    std::ifstream stream(this->m_filename);
+    if (false == stream.is_open()) {
+        this->m_errorLine = 0;
+        this->m_errorMessage = "Unable to open the recording";
+        return false;
+    }
+
+    /* the recorded flight plan columns and the shared flight plan of every callsign */
+    std::unordered_map<std::string, std::pair<std::string, std::shared_ptr<const types::FlightPlan>>> flightPlans;
+
+    std::string line;
+    std::uint32_t lineOffset = 0;
+    while (std::getline(stream, line)) {
+        lineOffset += 1;
+
+        /* skip empty lines and comments */
+        if (0 != line.length() && '\r' == line.back())
+            line.pop_back();
+        if (0 == line.length() || ';' == line[0])
+            continue;
+
+        auto elements = helper::String::splitString(line, ":");
+        bool valid = true;
+
+        if ("AIRPORT" == elements[0]) {
+            if (3 == elements.size()) {
+                this->m_airport = elements[1];
+                this->m_elevation = static_cast<float>(std::atof(elements[2].c_str())) * types::feet;
+            }
+            else {
+                valid = false;
+            }
+        }
+        else if ("SECTORFILE" == elements[0]) {
+            if (3 == elements.size()) {
+                this->m_sectorDirectory = this->resolvePath(elements[1]);
+                this->m_sectorName = elements[2];
+            }
+            else {
+                valid = false;
+            }
+        }
+        else if ("CONFIGURATION" == elements[0]) {
+            if (2 == elements.size())
+                this->m_configurationDirectory = this->resolvePath(elements[1]);
+            else
+                valid = false;
+        }
+        else {
+            Event event;
+
+            if (("CONTROLLER" == elements[0] || "OFFLINE" == elements[0] || "OWNSECTOR" == elements[0]) && 6 == elements.size()) {
+                if ("CONTROLLER" == elements[0])
+                    event.type = EventType::ControllerOnline;
+                else if ("OFFLINE" == elements[0])
+                    event.type = EventType::ControllerOffline;
+                else
+                    event.type = EventType::OwnSector;
+                event.controller = Recording::parseController(elements);
+            }
+            else if ("FLIGHT" == elements[0] && 21 == elements.size()) {
+                event.type = EventType::FlightUpdate;
+                event.flight = Recording::parseFlight(elements);
+
+                /* share the flight plan as long as it does not change, as EuroScope does it between the flight plan updates */
+                std::string columns;
+                for (std::size_t i = 9; i < elements.size(); ++i)
+                    columns += elements[i] + ":";
+
+                auto& flightPlan = flightPlans[elements[2]];
+                if (columns == flightPlan.first)
+                    event.flight.setFlightPlan(flightPlan.second);
+                else
+                    flightPlan = std::make_pair(columns, event.flight.sharedFlightPlan());
+            }
+            else if ("DISCONNECT" == elements[0] && 3 == elements.size()) {
+                event.type = EventType::FlightDisconnect;
+                event.flight = types::Flight(elements[2]);
+            }
+            else {
+                valid = false;
+            }
+
+            if (true == valid) {
+                event.timestamp = std::chrono::milliseconds(std::atoll(elements[1].c_str()));
+                this->m_events.push_back(std::move(event));
+            }
+        }
+
+        if (false == valid) {
+            this->m_errorLine = lineOffset;
+            this->m_errorMessage = "Invalid recording entry";
+            return false;
+        }
+    }
+
+    if (0 == this->m_airport.length() || 0 == this->m_sectorName.length() || 0 == this->m_configurationDirectory.length()) {
+        this->m_errorLine = lineOffset;
+        this->m_errorMessage = "Incomplete recording header";
+        return false;
+    }
+
+    /* keep the recorded order for events with the same timestamp */
+    this->m_events.sort([](const Event& event0, const Event& event1) {
+        return event0.timestamp < event1.timestamp;
+    });
+
+    return true;
+}
+
+const std::string& Recording::airport() const {
+    return this->m_airport;
+}
+
+const types::Length& Recording::elevation() const {
+    return this->m_elevation;
+}
+
+const std::string& Recording::sectorDirectory() const {
+    return this->m_sectorDirectory;
+}
+
+const std::string& Recording::sectorName() const {
+    return this->m_sectorName;
+}
+
+const std::string& Recording::configurationDirectory() const {
+    return this->m_configurationDirectory;
+}
+
+const std::list<Recording::Event>& Recording::events() const {
+    return this->m_events;
+}
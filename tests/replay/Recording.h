@@ -0,0 +1,141 @@
+/*
+ * @brief Defines a recorded session that can be replayed without EuroScope
+ * @file replay/Recording.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <chrono>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <formats/FileFormat.h>
+#include <types/ControllerInfo.h>
+#include <types/Flight.h>
+#include <types/Quantity.hpp>
+
+namespace topskytower {
+    namespace replay {
+        /**
+         * @brief Defines a recorded session of radar target updates and controller events
+         * @ingroup replay
+         *
+         * A recording is a plain text file and every line defines one entry.
+         * All elements of an entry are separated by colons and coordinates are given in decimal degrees.
+         * Empty lines and lines that start with a ';' are ignored.
+         *
+         * The header entries define the scenario and relative paths are resolved against the recording's directory:
+         * @code{.xml}
+         * AIRPORT:ICAO:ELEVATION_FT
+         * SECTORFILE:DIRECTORY:SECTOR_NAME
+         * CONFIGURATION:DIRECTORY
+         * @endcode
+         *
+         * The events are sorted by the timestamp which is given in milliseconds since the start of the recording:
+         * @code{.xml}
+         * CONTROLLER:TIME:IDENTIFIER:CALLSIGN:FREQUENCY:NAME
+         * OFFLINE:TIME:IDENTIFIER:CALLSIGN:FREQUENCY:NAME
+         * OWNSECTOR:TIME:IDENTIFIER:CALLSIGN:FREQUENCY:NAME
+         * FLIGHT:TIME:CALLSIGN:LAT:LON:ALT_FT:HDG_DEG:GS_KN:VS_FTMIN:RULES:AIRCRAFT:WTC:ORIGIN:DESTINATION:SID:DEP_RWY:STAR:ARR_RWY:CLEARED:ATC_FLAGS:ROUTE
+         * DISCONNECT:TIME:CALLSIGN
+         * @endcode
+         *
+         * RULES is 'I' or 'V', CLEARED is '0' or '1' and ATC_FLAGS contains the numeric value of the
+         * types::FlightPlan::AtcCommand flags. The route is a space separated list of NAME/LAT/LON waypoints.
+         */
+        class Recording : public formats::FileFormat {
+        public:
+            /**
+             * @brief Defines the different recorded events
+             */
+            enum class EventType {
+                ControllerOnline  = 0, /**< A controller station is updated */
+                ControllerOffline = 1, /**< A controller station disconnected */
+                OwnSector         = 2, /**< The own sector is defined */
+                FlightUpdate      = 3, /**< A radar target is updated */
+                FlightDisconnect  = 4  /**< A flight plan disconnected */
+            };
+
+            /**
+             * @brief Defines a single recorded event
+             */
+            struct Event {
+                EventType                 type;       /**< The event's type */
+                std::chrono::milliseconds timestamp;  /**< The relative time since the start of the recording */
+                types::ControllerInfo     controller; /**< The controller information of controller events */
+                types::Flight             flight;     /**< The flight information of flight events */
+
+                /**
+                 * @brief Creates an empty event
+                 */
+                Event() :
+                        type(EventType::FlightUpdate),
+                        timestamp(),
+                        controller(),
+                        flight() { }
+            };
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            std::string      m_filename;
+            std::string      m_airport;
+            types::Length    m_elevation;
+            std::string      m_sectorDirectory;
+            std::string      m_sectorName;
+            std::string      m_configurationDirectory;
+            std::list<Event> m_events;
+
+            std::string resolvePath(const std::string& path) const;
+            static types::ControllerInfo parseController(const std::vector<std::string>& elements);
+            static types::Flight parseFlight(const std::vector<std::string>& elements);
+
+        public:
+            /**
+             * @brief Creates a recording
+             * @param[in] filename The recording's filename
+             */
+            Recording(const std::string& filename);
+
+            /**
+             * @brief Parses the recording
+             * @return True if the recording is parsed, else false
+             */
+            bool parse();
+            /**
+             * @brief Returns the airport's ICAO code
+             * @return The ICAO code
+             */
+            const std::string& airport() const;
+            /**
+             * @brief Returns the airport's elevation
+             * @return The elevation
+             */
+            const types::Length& elevation() const;
+            /**
+             * @brief Returns the directory that contains the SCT and ESE files
+             * @return The sector directory
+             */
+            const std::string& sectorDirectory() const;
+            /**
+             * @brief Returns the sector name that is used to identify the SCT file
+             * @return The sector name
+             */
+            const std::string& sectorName() const;
+            /**
+             * @brief Returns the directory that contains the TopSky-Tower configuration
+             * @return The configuration directory
+             */
+            const std::string& configurationDirectory() const;
+            /**
+             * @brief Returns all recorded events
+             * @return The events sorted by the timestamp
+             */
+            const std::list<Event>& events() const;
+#endif
+        };
+    }
+}
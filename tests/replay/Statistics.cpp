@@ -0,0 +1,121 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the latency statistics
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "Statistics.h"
+
+using namespace topskytower;
+using namespace topskytower::replay;
+
+static __inline double __microseconds(const std::chrono::nanoseconds& duration) {
+    return static_cast<double>(duration.count()) / 1000.0;
+}
+
+Statistics::Statistics() :
+        m_samples(),
+        m_replayDuration() { }
+
+const char* Statistics::stageName(Stage stage) {
+    switch (stage) {
+    case Stage::SectorControl:
+        return "SectorControl";
+    case Stage::StandControl:
+        return "StandControl";
+    case Stage::DepartureSequenceControl:
+        return "DepartureSequenceControl";
+    case Stage::MTCDControl:
+        return "MTCDControl";
+    case Stage::STCDControl:
+        return "STCDControl";
+    case Stage::ARIWSControl:
+        return "ARIWSControl";
+    case Stage::CMACControl:
+        return "CMACControl";
+    case Stage::Pipeline:
+        return "Pipeline";
+    default:
+        return "Unknown";
+    }
+}
+
+void Statistics::add(Stage stage, const std::chrono::nanoseconds& duration) {
+    this->m_samples[static_cast<std::size_t>(stage)].push_back(duration);
+}
+
+void Statistics::setReplayDuration(const std::chrono::nanoseconds& duration) {
+    this->m_replayDuration = duration;
+}
+
+std::size_t Statistics::samples(Stage stage) const {
+    return this->m_samples[static_cast<std::size_t>(stage)].size();
+}
+
+std::chrono::nanoseconds Statistics::percentile(Stage stage, float percentile) const {
+    auto samples = this->m_samples[static_cast<std::size_t>(stage)];
+    if (0 == samples.size())
+        return std::chrono::nanoseconds();
+
+    /* nearest-rank percentile */
+    percentile = std::clamp(percentile, 0.0f, 100.0f);
+    auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0f * static_cast<float>(samples.size())));
+    auto idx = std::min(samples.size() - 1, 0 != rank ? rank - 1 : 0);
+
+    std::nth_element(samples.begin(), samples.begin() + idx, samples.end());
+    return samples[idx];
+}
+
+void Statistics::write(std::ostream& stream) const {
+    stream << std::left << std::setw(26) << "stage" << std::right
+           << std::setw(10) << "calls"
+           << std::setw(12) << "mean[us]"
+           << std::setw(12) << "p50[us]"
+           << std::setw(12) << "p90[us]"
+           << std::setw(12) << "p99[us]"
+           << std::setw(12) << "max[us]"
+           << std::setw(14) << "total[ms]" << std::endl;
+
+    stream << std::fixed << std::setprecision(2);
+    for (std::size_t i = 0; i < static_cast<std::size_t>(Stage::Count); ++i) {
+        const auto& samples = this->m_samples[i];
+        auto stage = static_cast<Stage>(i);
+
+        std::chrono::nanoseconds total(0), mean(0);
+        for (const auto& sample : std::as_const(samples))
+            total += sample;
+        if (0 != samples.size())
+            mean = total / static_cast<std::chrono::nanoseconds::rep>(samples.size());
+
+        stream << std::left << std::setw(26) << Statistics::stageName(stage) << std::right
+               << std::setw(10) << samples.size()
+               << std::setw(12) << __microseconds(mean)
+               << std::setw(12) << __microseconds(this->percentile(stage, 50.0f))
+               << std::setw(12) << __microseconds(this->percentile(stage, 90.0f))
+               << std::setw(12) << __microseconds(this->percentile(stage, 99.0f))
+               << std::setw(12) << __microseconds(this->percentile(stage, 100.0f))
+               << std::setw(14) << __microseconds(total) / 1000.0 << std::endl;
+    }
+
+    /* the throughput is based on the pure pipeline time and on the wall time of the replay */
+    std::chrono::nanoseconds pipelineTime(0);
+    for (const auto& sample : std::as_const(this->m_samples[static_cast<std::size_t>(Stage::Pipeline)]))
+        pipelineTime += sample;
+
+    auto updates = static_cast<double>(this->samples(Stage::Pipeline));
+    stream << std::endl;
+    stream << "radar target updates:    " << this->samples(Stage::Pipeline) << std::endl;
+    if (0 != pipelineTime.count())
+        stream << "pipeline throughput:     " << updates / (__microseconds(pipelineTime) / 1.0e6) << " updates/s" << std::endl;
+    if (0 != this->m_replayDuration.count())
+        stream << "replay throughput:       " << updates / (__microseconds(this->m_replayDuration) / 1.0e6) << " updates/s" << std::endl;
+}
@@ -0,0 +1,86 @@
+/*
+ * @brief Defines the latency statistics of a replay
+ * @file replay/Statistics.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace topskytower {
+    namespace replay {
+        /**
+         * @brief Collects the latencies of the different pipeline stages
+         * @ingroup replay
+         */
+        class Statistics {
+        public:
+            /**
+             * @brief Defines the stages of the radar target update pipeline
+             * The order follows the update order of the RADAR screen.
+             */
+            enum class Stage {
+                SectorControl            = 0, /**< The sector and handoff control */
+                StandControl             = 1, /**< The stand assignment */
+                DepartureSequenceControl = 2, /**< The departure sequence */
+                MTCDControl              = 3, /**< The medium term conflict detection */
+                STCDControl              = 4, /**< The short term conflict detection */
+                ARIWSControl             = 5, /**< The runway incursion warning system */
+                CMACControl              = 6, /**< The conformance monitoring */
+                Pipeline                 = 7, /**< The complete pipeline of one radar target update */
+                Count                    = 8  /**< The number of stages */
+            };
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            std::array<std::vector<std::chrono::nanoseconds>, static_cast<std::size_t>(Stage::Count)> m_samples;
+            std::chrono::nanoseconds                                                                   m_replayDuration;
+
+            static const char* stageName(Stage stage);
+
+        public:
+            /**
+             * @brief Creates an empty statistics
+             */
+            Statistics();
+
+            /**
+             * @brief Adds a latency sample to a stage
+             * @param[in] stage The measured stage
+             * @param[in] duration The measured latency
+             */
+            void add(Stage stage, const std::chrono::nanoseconds& duration);
+            /**
+             * @brief Sets the wall time of the complete replay including the event handling overhead
+             * @param[in] duration The wall time of the replay
+             */
+            void setReplayDuration(const std::chrono::nanoseconds& duration);
+            /**
+             * @brief Returns the number of samples of a stage
+             * @param[in] stage The requested stage
+             * @return The number of samples
+             */
+            std::size_t samples(Stage stage) const;
+            /**
+             * @brief Calculates a percentile of a stage
+             * @param[in] stage The requested stage
+             * @param[in] percentile The requested percentile in [0, 100]
+             * @return The latency of the percentile
+             */
+            std::chrono::nanoseconds percentile(Stage stage, float percentile) const;
+            /**
+             * @brief Writes the latency percentiles and the throughput into a stream
+             * @param[in] stream The output stream
+             */
+            void write(std::ostream& stream) const;
+#endif
+        };
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Replays a recorded session through the radar target update pipeline
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <iomanip>
+#include <iostream>
+
+#include <helper/Exception.h>
+#include <system/PerformanceRegistry.h>
+
+#include "Pipeline.h"
+#include "Recording.h"
+
+using namespace topskytower;
+
+static __inline void __writeWork(std::ostream& stream, const system::PerformanceRegistry::Snapshot& snapshot) {
+    stream << std::left << std::setw(26) << "component" << std::right
+           << std::setw(10) << "calls"
+           << std::setw(14) << "geodesic"
+           << std::setw(14) << "polygon"
+           << std::setw(14) << "geodesic/call"
+           << std::setw(14) << "polygon/call";
+    if (true == snapshot.allocationAccounting)
+        stream << std::setw(14) << "allocs/call" << std::setw(14) << "bytes/call";
+    stream << std::endl;
+
+    stream << std::fixed << std::setprecision(2);
+    for (std::size_t i = 0; i < static_cast<std::size_t>(system::PerformanceRegistry::Component::Count); ++i) {
+        const auto& statistics = snapshot.statistics[i];
+        auto calls = static_cast<double>(0 != statistics.calls ? statistics.calls : 1);
+
+        stream << std::left << std::setw(26)
+               << system::PerformanceRegistry::componentName(static_cast<system::PerformanceRegistry::Component>(i))
+               << std::right
+               << std::setw(10) << statistics.calls
+               << std::setw(14) << statistics.geodesicSolves
+               << std::setw(14) << statistics.polygonTests
+               << std::setw(14) << static_cast<double>(statistics.geodesicSolves) / calls
+               << std::setw(14) << static_cast<double>(statistics.polygonTests) / calls;
+        if (true == snapshot.allocationAccounting) {
+            stream << std::setw(14) << static_cast<double>(statistics.allocations) / calls
+                   << std::setw(14) << static_cast<double>(statistics.allocatedBytes) / calls;
+        }
+        stream << std::endl;
+    }
+
+    if (false == snapshot.allocationAccounting)
+        stream << std::endl << "allocation accounting is disabled (ALLOCATION_ACCOUNTING)" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    if (2 != argc) {
+        std::cerr << "Usage: " << argv[0] << " <recording>" << std::endl;
+        return -1;
+    }
+
+    replay::Recording recording(argv[1]);
+    if (false == recording.parse()) {
+        std::cerr << argv[1] << ":" << recording.errorLine() << ": " << recording.errorMessage() << std::endl;
+        return -1;
+    }
+
+    try {
+        replay::Pipeline pipeline(recording);
+
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& event : std::as_const(recording.events()))
+            pipeline.process(event);
+        pipeline.statistics().setReplayDuration(std::chrono::steady_clock::now() - start);
+
+        std::cout << "replayed " << recording.events().size() << " events of " << recording.airport() << std::endl << std::endl;
+        pipeline.statistics().write(std::cout);
+        std::cout << std::endl;
+        __writeWork(std::cout, system::PerformanceRegistry::instance().snapshot());
+    }
+    catch (const helper::Exception& ex) {
+        std::cerr << ex.sender() << ": " << ex.message() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the configuration registry
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <system/ConfigurationRegistry.h>
+
+using namespace topskytower;
+
+TEST(ConfigurationRegistry, IgnoresInvalidAirportFiles) {
+    auto path = std::filesystem::temp_directory_path() / "TopSkyTowerConfigurationRegistry";
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+
+    /* backups of the airport configurations are no airport configurations */
+    std::ofstream(path / "TopSkyTowerAirportEDDF_old.txt") << "";
+    std::ofstream(path / "TopSkyTowerAirportEDDF.bak") << "";
+
+    auto& registry = system::ConfigurationRegistry::instance();
+    EXPECT_TRUE(registry.configure(path.string(), system::ConfigurationRegistry::UpdateType::Airports));
+    EXPECT_FALSE(registry.errorFound());
+    ASSERT_EQ(1, registry.warningMessages().size());
+    EXPECT_EQ(0, registry.warningMessages().front().find("TopSkyTowerAirportEDDF_old.txt:"));
+
+    std::filesystem::remove_all(path);
+}
@@ -23,3 +23,109 @@ TEST(FlightRegistry, FlightExists) {
 
     EXPECT_TRUE(system::FlightRegistry::instance().flightExists("TEST"));
 }
+
+TEST(FlightRegistry, SnapshotIsIsolated) {
+    auto& registry = system::FlightRegistry::instance();
+
+    types::Flight flight("SNAP");
+    flight.setGroundSpeed(120_kn);
+    registry.updateFlight(flight);
+    registry.publish();
+
+    auto snapshot = registry.snapshot();
+    ASSERT_TRUE(snapshot->flightExists("SNAP"));
+    EXPECT_EQ(120_kn, snapshot->flight("SNAP").groundSpeed());
+
+    /* the writer's updates are invisible until the next publication */
+    flight.setGroundSpeed(140_kn);
+    registry.updateFlight(flight);
+    registry.removeFlight("TEST");
+    EXPECT_EQ(snapshot, registry.snapshot());
+
+    registry.publish();
+    auto next = registry.snapshot();
+    EXPECT_EQ(snapshot->epoch() + 1, next->epoch());
+    EXPECT_EQ(140_kn, next->flight("SNAP").groundSpeed());
+    EXPECT_FALSE(next->flightExists("TEST"));
+    EXPECT_EQ(120_kn, snapshot->flight("SNAP").groundSpeed());
+
+    /* nothing changed -> the snapshot stays valid */
+    registry.publish();
+    EXPECT_EQ(next, registry.snapshot());
+}
+
+TEST(FlightRegistry, FlightPlanIsShared) {
+    auto& registry = system::FlightRegistry::instance();
+
+    types::FlightPlan plan;
+    plan.setDestination("EDDF");
+    plan.setFlag(types::FlightPlan::AtcCommand::StartUp);
+
+    types::Flight flight("SHARED");
+    flight.setFlightPlan(plan);
+    registry.updateFlight(flight);
+
+    /* the registry shares the flight plan as long as the flags do not change */
+    EXPECT_EQ(flight.sharedFlightPlan(), registry.flight("SHARED").sharedFlightPlan());
+
+    auto version = registry.flight("SHARED").flightPlan().version();
+    registry.setAtcClearanceFlag(flight, static_cast<std::uint16_t>(types::FlightPlan::AtcCommand::Pushback));
+    EXPECT_NE(version, registry.flight("SHARED").flightPlan().version());
+    EXPECT_EQ(types::FlightPlan::AtcCommand::Pushback, registry.flight("SHARED").flightPlan().departureFlag());
+    EXPECT_EQ(types::FlightPlan::AtcCommand::StartUp, flight.flightPlan().departureFlag());
+}
+
+TEST(FlightRegistry, MergedFlightPlanIsShared) {
+    auto& registry = system::FlightRegistry::instance();
+
+    types::FlightPlan plan;
+    plan.setFlag(types::FlightPlan::AtcCommand::TaxiOut);
+
+    types::Flight flight("MERGED");
+    flight.setFlightPlan(plan);
+    registry.updateFlight(flight);
+
+    /* the TopSky-flag is read once out of the scratchpad */
+    plan.setFlag(types::FlightPlan::AtcCommand::Deicing);
+    flight.setFlightPlan(plan);
+    registry.updateFlight(flight);
+    EXPECT_EQ(types::FlightPlan::AtcCommand::Deicing, registry.flight("MERGED").flightPlan().departureFlag());
+
+    /* the updates with the merged flight plan do not copy it */
+    auto merged = registry.flight("MERGED").sharedFlightPlan();
+    flight.setFlightPlan(merged);
+    registry.updateFlight(flight);
+    registry.updateFlight(flight);
+    EXPECT_EQ(merged, registry.flight("MERGED").sharedFlightPlan());
+    EXPECT_EQ(types::FlightPlan::AtcCommand::Deicing, registry.flight("MERGED").flightPlan().departureFlag());
+}
+
+TEST(FlightRegistry, ClearedFlagSurvivesCachedFlightPlan) {
+    auto& registry = system::FlightRegistry::instance();
+
+    types::FlightPlan plan;
+    plan.setFlag(types::FlightPlan::AtcCommand::Land);
+
+    types::Flight flight("CLEARED");
+    flight.setFlightPlan(plan);
+    registry.updateFlight(flight);
+
+    /* the plug-in caches the merged flight plan between the position updates */
+    auto cached = registry.flight("CLEARED").sharedFlightPlan();
+    EXPECT_EQ(types::FlightPlan::AtcCommand::Land, cached->arrivalFlag());
+
+    /* clear the arrival flag and refresh the cache as the plug-in does it */
+    registry.setAtcClearanceFlag(flight, 0);
+    EXPECT_EQ(types::FlightPlan::AtcCommand::Unknown, registry.flight("CLEARED").flightPlan().arrivalFlag());
+    cached = registry.flight("CLEARED").sharedFlightPlan();
+
+    /* the next position update with the cached flight plan keeps the cleared flag */
+    flight.setFlightPlan(cached);
+    registry.updateFlight(flight);
+    EXPECT_EQ(types::FlightPlan::AtcCommand::Unknown, registry.flight("CLEARED").flightPlan().arrivalFlag());
+
+    /* the stale flight plan restores the old flag */
+    flight.setFlightPlan(plan);
+    registry.updateFlight(flight);
+    EXPECT_EQ(types::FlightPlan::AtcCommand::Land, registry.flight("CLEARED").flightPlan().arrivalFlag());
+}
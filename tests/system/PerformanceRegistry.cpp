@@ -0,0 +1,67 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the performance registry
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <system/PerformanceRegistry.h>
+#include <types/Coordinate.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+TEST(PerformanceRegistry, CountsWork) {
+    auto before = system::PerformanceRegistry::instance().snapshot();
+
+    {
+        system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::MTCDControl);
+        types::Coordinate coordinate(8.0_deg, 50.0_deg);
+        coordinate.distanceTo(types::Coordinate(8.5_deg, 50.5_deg));
+        coordinate.bearingTo(types::Coordinate(8.5_deg, 50.5_deg));
+    }
+
+    auto after = system::PerformanceRegistry::instance().snapshot();
+    const auto& statsBefore = before.statistics[static_cast<std::size_t>(system::PerformanceRegistry::Component::MTCDControl)];
+    const auto& statsAfter = after.statistics[static_cast<std::size_t>(system::PerformanceRegistry::Component::MTCDControl)];
+
+    EXPECT_EQ(statsBefore.calls + 1, statsAfter.calls);
+    EXPECT_EQ(statsBefore.geodesicSolves + 2, statsAfter.geodesicSolves);
+    EXPECT_EQ(statsBefore.polygonTests, statsAfter.polygonTests);
+    ASSERT_LT(before.samples.size(), after.samples.size());
+    EXPECT_EQ(system::PerformanceRegistry::Component::MTCDControl, after.samples.back().component);
+    EXPECT_EQ(2, after.samples.back().geodesicSolves);
+}
+
+TEST(PerformanceRegistry, CollectsThreads) {
+    auto before = system::PerformanceRegistry::instance().snapshot();
+
+    std::thread worker([]() {
+        for (int i = 0; i < 2000; ++i)
+            system::PerformanceRegistry::Measurement measurement(system::PerformanceRegistry::Component::CMACControl);
+    });
+    worker.join();
+
+    auto after = system::PerformanceRegistry::instance().snapshot();
+    const auto& statsBefore = before.statistics[static_cast<std::size_t>(system::PerformanceRegistry::Component::CMACControl)];
+    const auto& statsAfter = after.statistics[static_cast<std::size_t>(system::PerformanceRegistry::Component::CMACControl)];
+
+    EXPECT_EQ(statsBefore.calls + 2000, statsAfter.calls);
+
+    /* the ring buffer keeps only the most recent calls of the worker */
+    std::size_t workerSamples = 0;
+    for (const auto& sample : std::as_const(after.samples)) {
+        if (system::PerformanceRegistry::Component::CMACControl == sample.component)
+            workerSamples += 1;
+    }
+    EXPECT_GT(2000U, workerSamples);
+    EXPECT_LT(0U, workerSamples);
+}
@@ -0,0 +1,349 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the synthetic traffic generator
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <formats/AirportFileFormat.h>
+#include <formats/EseFileFormat.h>
+#include <helper/Exception.h>
+#include <types/FlightPlan.h>
+
+#include "Generator.h"
+
+using namespace topskytower;
+using namespace topskytower::traffic;
+using namespace topskytower::types;
+
+/* the glide path of the arrivals */
+static const float GlidePathFeetPerNauticalMile = 318.0f;
+
+static __inline std::uint16_t __flag(types::FlightPlan::AtcCommand command) {
+    return static_cast<std::uint16_t>(command);
+}
+
+static __inline std::string __relativePath(const std::string& path, const std::string& directory) {
+    /* the recording format separates the entries by colons -> avoid drive letters */
+    return std::filesystem::relative(path, std::filesystem::absolute(directory)).generic_string();
+}
+
+static __inline std::string __formatWaypoint(const std::string& name, const types::Coordinate& coordinate) {
+    std::stringstream stream;
+    stream << name << "/" << std::fixed << std::setprecision(6) << coordinate.latitude().convert(types::degree)
+           << "/" << coordinate.longitude().convert(types::degree);
+    return stream.str();
+}
+
+Generator::Generator(const Settings& settings) :
+        m_settings(settings),
+        m_configuration(),
+        m_sectors(),
+        m_runway(),
+        m_generator(settings.seed) {
+    /* the working directory changes during the parsing -> use absolute paths */
+    this->m_settings.sectorDirectory = std::filesystem::absolute(settings.sectorDirectory).string();
+    this->m_settings.configurationDirectory = std::filesystem::absolute(settings.configurationDirectory).string();
+
+    auto airportFile = std::filesystem::path(this->m_settings.configurationDirectory) / ("TopSkyTowerAirport" + settings.airport + ".txt");
+    formats::AirportFileFormat airport(airportFile.string());
+    if (false == airport.parse(this->m_configuration)) {
+        throw helper::Exception("Generator", airportFile.string() + ":" + std::to_string(airport.errorLine()) + ": " +
+                                airport.errorMessage());
+    }
+    if (0 == this->m_configuration.aircraftStands.size())
+        throw helper::Exception("Generator", "No stands defined for " + settings.airport);
+
+    /* the sector file parser searches in the working directory */
+    auto workingDirectory = std::filesystem::current_path();
+    std::filesystem::current_path(this->m_settings.sectorDirectory);
+    formats::EseFileFormat sectorFile;
+    bool parsed = sectorFile.parse(settings.sectorName);
+    std::filesystem::current_path(workingDirectory);
+
+    if (false == parsed)
+        throw helper::Exception("Generator", "Unable to find the sector file " + settings.sectorName);
+
+    for (const auto& sector : std::as_const(sectorFile.sectors())) {
+        if (sector.controllerInfo().prefix() == settings.airport)
+            this->m_sectors.push_back(sector);
+    }
+
+    const auto& runways = sectorFile.runways(settings.airport);
+    if (0 == runways.size())
+        throw helper::Exception("Generator", "No runways defined for " + settings.airport);
+
+    this->m_runway = runways.front();
+    if (0 != settings.runway.length()) {
+        auto it = std::find_if(runways.cbegin(), runways.cend(), [&settings](const types::Runway& runway) {
+            return runway.name() == settings.runway;
+        });
+        if (runways.cend() == it)
+            throw helper::Exception("Generator", "Unknown runway " + settings.runway);
+        this->m_runway = *it;
+    }
+}
+
+std::string Generator::callsign(const std::string& prefix, std::size_t index) {
+    std::stringstream stream;
+    stream << prefix << std::setw(3) << std::setfill('0') << index;
+    return stream.str();
+}
+
+std::string Generator::controllerCallsign(const types::ControllerInfo& info) {
+    if (0 != info.midfix().length())
+        return info.prefix() + "_" + info.midfix() + "_" + info.suffix();
+    return info.prefix() + "_" + info.suffix();
+}
+
+std::string Generator::formatFlight(const Flight& flight, const Trajectory::State& state) {
+    std::stringstream stream;
+
+    stream << "FLIGHT:" << state.time.count() << ":" << flight.callsign << ":"
+           << std::fixed << std::setprecision(6)
+           << state.coordinate.latitude().convert(types::degree) << ":"
+           << state.coordinate.longitude().convert(types::degree) << ":"
+           << std::setprecision(0)
+           << state.altitude.convert(types::feet) << ":"
+           << std::fmod(state.heading.convert(types::degree) + 360.0f, 360.0f) << ":"
+           << state.groundSpeed.convert(types::knot) << ":"
+           << state.verticalSpeed.convert(types::feet / types::minute) << ":"
+           << (true == flight.vfr ? "V" : "I") << ":"
+           << flight.aircraft << ":" << flight.wtc << ":"
+           << flight.origin << ":" << flight.destination << ":"
+           << flight.sid << ":" << flight.departureRunway << ":"
+           << ":" << flight.arrivalRunway << ":"
+           << (0 != state.atcFlags ? "1" : "0") << ":"
+           << state.atcFlags << ":" << flight.route;
+
+    return stream.str();
+}
+
+void Generator::selectAircraft(Flight& flight, bool heavyAllowed) {
+    static const std::vector<std::pair<std::string, std::string>> __mediums = {
+        { "A320", "M" }, { "A321", "M" }, { "B738", "M" }, { "E190", "M" }, { "CRJ9", "M" }
+    };
+    static const std::vector<std::pair<std::string, std::string>> __heavies = {
+        { "B77W", "H" }, { "A359", "H" }, { "B744", "H" }, { "A388", "J" }
+    };
+
+    /* every fifth IFR flight is a heavy */
+    std::uniform_int_distribution<std::size_t> category(0, 4);
+    if (true == heavyAllowed && 0 == category(this->m_generator)) {
+        std::uniform_int_distribution<std::size_t> type(0, __heavies.size() - 1);
+        const auto& entry = __heavies[type(this->m_generator)];
+        flight.aircraft = entry.first;
+        flight.wtc = entry.second;
+    }
+    else {
+        std::uniform_int_distribution<std::size_t> type(0, __mediums.size() - 1);
+        const auto& entry = __mediums[type(this->m_generator)];
+        flight.aircraft = entry.first;
+        flight.wtc = entry.second;
+    }
+}
+
+std::string Generator::selectAirport() {
+    static const std::vector<std::string> __airports = {
+        "EDDF", "EDDM", "EDDB", "EGLL", "LFPG", "EHAM", "LOWW", "LSZH", "EKCH", "ESSA", "LEMD", "LIRF"
+    };
+
+    std::uniform_int_distribution<std::size_t> airport(0, __airports.size() - 1);
+    std::string retval;
+    do {
+        retval = __airports[airport(this->m_generator)];
+    } while (retval == this->m_settings.airport);
+
+    return retval;
+}
+
+const types::Stand& Generator::selectStand(std::size_t index) const {
+    auto it = this->m_configuration.aircraftStands.cbegin();
+    std::advance(it, index % this->m_configuration.aircraftStands.size());
+    return *it;
+}
+
+types::Coordinate Generator::holdingPoint() const {
+    for (const auto& holdingPoint : std::as_const(this->m_configuration.holdingPoints)) {
+        if (holdingPoint.runway == this->m_runway.name() && false == holdingPoint.lowVisibility)
+            return holdingPoint.holdingPoint;
+    }
+
+    /* no holding point defined -> use a position next to the threshold */
+    return this->m_runway.start().projection(this->m_runway.heading() - 90.0_deg, 100.0_m);
+}
+
+Generator::Flight Generator::createDeparture(std::size_t index) {
+    std::uniform_int_distribution<int> startupDelay(60, 300);
+    std::uniform_int_distribution<int> lineupDelay(20, 90);
+
+    const auto& stand = this->selectStand(index);
+    auto holdingPoint = this->holdingPoint();
+    auto heading = stand.position.bearingTo(holdingPoint) + 180.0_deg;
+    auto elevation = this->m_settings.elevation;
+    auto spawn = std::chrono::duration_cast<std::chrono::milliseconds>(this->m_settings.spacing * static_cast<int>(index));
+
+    Flight flight = { Generator::callsign("TSD", index), false, "", "", this->m_settings.airport, this->selectAirport(),
+                      "", this->m_runway.name(), "", "", Trajectory(spawn, stand.position, elevation, heading, 0) };
+    this->selectAircraft(flight, true);
+
+    /* use a random SID of the configuration */
+    if (0 != this->m_configuration.sids.size()) {
+        std::uniform_int_distribution<std::size_t> sid(0, this->m_configuration.sids.size() - 1);
+        auto it = this->m_configuration.sids.cbegin();
+        std::advance(it, sid(this->m_generator));
+        flight.sid = it->first;
+    }
+
+    /* the route leads along the extended centerline and the SID ends in the first waypoint */
+    auto exitPoint = this->m_runway.start().projection(this->m_runway.heading(), 15_nm);
+    auto enroutePoint = this->m_runway.start().projection(this->m_runway.heading(), 40_nm);
+    auto exitName = 5 <= flight.sid.length() ? flight.sid.substr(0, 5) : std::string("EXIT");
+    flight.route = __formatWaypoint(exitName, exitPoint) + " " + __formatWaypoint("DCT", enroutePoint);
+
+    /* start-up, pushback and taxi */
+    auto& trajectory = flight.trajectory;
+    trajectory.hold(std::chrono::seconds(startupDelay(this->m_generator)), 0);
+    trajectory.hold(std::chrono::seconds(60), __flag(types::FlightPlan::AtcCommand::StartUp));
+    trajectory.moveTo(stand.position.projection(heading - 180.0_deg, 60.0_m), elevation, 3_kn,
+                      __flag(types::FlightPlan::AtcCommand::Pushback), true);
+    trajectory.hold(std::chrono::seconds(60), __flag(types::FlightPlan::AtcCommand::Pushback));
+    trajectory.moveTo(holdingPoint, elevation, 15_kn, __flag(types::FlightPlan::AtcCommand::TaxiOut));
+    trajectory.hold(std::chrono::seconds(lineupDelay(this->m_generator)), __flag(types::FlightPlan::AtcCommand::TaxiOut));
+
+    /* line-up and take-off */
+    trajectory.moveTo(this->m_runway.start(), elevation, 10_kn, __flag(types::FlightPlan::AtcCommand::LineUp));
+    trajectory.hold(std::chrono::seconds(30), __flag(types::FlightPlan::AtcCommand::LineUp));
+    trajectory.moveTo(this->m_runway.start().projection(this->m_runway.heading(), 800.0_m), elevation, 60_kn,
+                      __flag(types::FlightPlan::AtcCommand::Departure));
+    trajectory.moveTo(this->m_runway.start().projection(this->m_runway.heading(), 1800.0_m), elevation, 140_kn,
+                      __flag(types::FlightPlan::AtcCommand::Departure));
+    trajectory.moveTo(this->m_runway.start().projection(this->m_runway.heading(), 6_nm), elevation + 3000_ft, 180_kn,
+                      __flag(types::FlightPlan::AtcCommand::Departure));
+    trajectory.moveTo(exitPoint, elevation + 6000_ft, 250_kn, __flag(types::FlightPlan::AtcCommand::Departure));
+    trajectory.moveTo(enroutePoint, elevation + 10000_ft, 280_kn, __flag(types::FlightPlan::AtcCommand::Departure));
+
+    return flight;
+}
+
+Generator::Flight Generator::createArrival(std::size_t index) {
+    const auto& stand = this->selectStand(this->m_settings.departures + index);
+    auto elevation = this->m_settings.elevation;
+    auto finalHeading = this->m_runway.heading();
+
+    /* the arrivals reach the threshold in the configured spacing */
+    auto approachStart = this->m_runway.start().projection(finalHeading + 180.0_deg, 12_nm);
+    auto approachAltitude = elevation + 12.0f * GlidePathFeetPerNauticalMile * types::feet;
+    auto spawn = std::chrono::duration_cast<std::chrono::milliseconds>(this->m_settings.spacing * static_cast<int>(index));
+
+    Flight flight = { Generator::callsign("TSA", index), false, "", "", this->selectAirport(), this->m_settings.airport,
+                      "", "", this->m_runway.name(), "",
+                      Trajectory(spawn, approachStart, approachAltitude, finalHeading, __flag(types::FlightPlan::AtcCommand::Approach)) };
+    this->selectAircraft(flight, true);
+
+    auto& trajectory = flight.trajectory;
+    trajectory.moveTo(this->m_runway.start().projection(finalHeading + 180.0_deg, 4_nm),
+                      elevation + 4.0f * GlidePathFeetPerNauticalMile * types::feet, 160_kn,
+                      __flag(types::FlightPlan::AtcCommand::Approach));
+    trajectory.moveTo(this->m_runway.start(), elevation, 140_kn, __flag(types::FlightPlan::AtcCommand::Land));
+    trajectory.moveTo(this->m_runway.start().projection(finalHeading, 1500.0_m), elevation, 60_kn,
+                      __flag(types::FlightPlan::AtcCommand::Land));
+    trajectory.moveTo(this->m_runway.start().projection(finalHeading, 2000.0_m), elevation, 20_kn,
+                      __flag(types::FlightPlan::AtcCommand::Land));
+    trajectory.moveTo(stand.position, elevation, 15_kn, __flag(types::FlightPlan::AtcCommand::TaxiIn));
+    trajectory.hold(std::chrono::seconds(120), __flag(types::FlightPlan::AtcCommand::TaxiIn));
+
+    return flight;
+}
+
+Generator::Flight Generator::createVfrFlight(std::size_t index) {
+    std::uniform_int_distribution<int> spawnDelay(0, 600);
+    auto elevation = this->m_settings.elevation;
+    auto circuitAltitude = elevation + 1000_ft;
+    auto heading = this->m_runway.heading();
+
+    /* a left-hand traffic circuit around the runway */
+    std::vector<types::Coordinate> circuit = {
+        this->m_runway.end().projection(heading, 1_nm),
+        this->m_runway.end().projection(heading, 1_nm).projection(heading - 90.0_deg, 1_nm),
+        this->m_runway.start().projection(heading + 180.0_deg, 1_nm).projection(heading - 90.0_deg, 1_nm),
+        this->m_runway.start().projection(heading + 180.0_deg, 1_nm),
+    };
+
+    auto spawn = std::chrono::milliseconds(spawnDelay(this->m_generator) * 1000);
+    Flight flight = { Generator::callsign("TSV", index), true, "C172", "L", this->m_settings.airport, this->m_settings.airport,
+                      "", "", "", "", Trajectory(spawn, circuit[index % circuit.size()], circuitAltitude, heading, 0) };
+
+    /* fly two circuits */
+    auto& trajectory = flight.trajectory;
+    for (std::size_t i = 1; i <= 2 * circuit.size(); ++i)
+        trajectory.moveTo(circuit[(index + i) % circuit.size()], circuitAltitude, 90_kn, 0);
+
+    return flight;
+}
+
+std::size_t Generator::write(std::ostream& stream, const std::string& directory) {
+    std::list<Flight> flights;
+    for (std::size_t i = 0; i < this->m_settings.departures; ++i)
+        flights.push_back(this->createDeparture(i));
+    for (std::size_t i = 0; i < this->m_settings.arrivals; ++i)
+        flights.push_back(this->createArrival(i));
+    for (std::size_t i = 0; i < this->m_settings.vfrFlights; ++i)
+        flights.push_back(this->createVfrFlight(i));
+
+    std::vector<std::pair<std::chrono::milliseconds, std::string>> events;
+
+    /* the controllers of the airport are online from the beginning and the tower is the own station */
+    bool ownSectorDefined = false;
+    for (const auto& sector : std::as_const(this->m_sectors)) {
+        const auto& info = sector.controllerInfo();
+        std::string entry = info.identifier() + ":" + Generator::controllerCallsign(info) + ":" + info.primaryFrequency() + ":Generated";
+
+        events.push_back(std::make_pair(std::chrono::milliseconds(0), "CONTROLLER:0:" + entry));
+        if (false == ownSectorDefined && types::Sector::Type::Tower == sector.type()) {
+            events.push_back(std::make_pair(std::chrono::milliseconds(0), "OWNSECTOR:0:" + entry));
+            ownSectorDefined = true;
+        }
+    }
+
+    /* sample all trajectories on the global radar update grid */
+    const auto interval = this->m_settings.interval.count();
+    for (const auto& flight : std::as_const(flights)) {
+        auto first = ((flight.trajectory.start().count() + interval - 1) / interval) * interval;
+
+        for (auto time = first; time <= flight.trajectory.end().count(); time += interval) {
+            Trajectory::State state;
+            if (true == flight.trajectory.state(std::chrono::milliseconds(time), state))
+                events.push_back(std::make_pair(state.time, Generator::formatFlight(flight, state)));
+        }
+
+        auto disconnect = std::max(flight.trajectory.end(), std::chrono::milliseconds(first)) + this->m_settings.interval;
+        events.push_back(std::make_pair(disconnect, "DISCONNECT:" + std::to_string(disconnect.count()) + ":" + flight.callsign));
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const auto& event0, const auto& event1) {
+        return event0.first < event1.first;
+    });
+
+    stream << "; generated by tst-traffic with seed " << this->m_settings.seed << std::endl;
+    stream << "AIRPORT:" << this->m_settings.airport << ":" << std::fixed << std::setprecision(0)
+           << this->m_settings.elevation.convert(types::feet) << std::endl;
+    stream << "SECTORFILE:" << __relativePath(this->m_settings.sectorDirectory, directory) << ":" << this->m_settings.sectorName << std::endl;
+    stream << "CONFIGURATION:" << __relativePath(this->m_settings.configurationDirectory, directory) << std::endl;
+    for (const auto& event : std::as_const(events))
+        stream << event.second << std::endl;
+
+    return events.size();
+}
@@ -0,0 +1,107 @@
+/*
+ * @brief Defines the synthetic traffic generator
+ * @file traffic/Generator.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <ostream>
+#include <random>
+#include <string>
+
+#include <types/AirportConfiguration.h>
+#include <types/Runway.h>
+#include <types/Sector.h>
+
+#include "Trajectory.h"
+
+namespace topskytower {
+    namespace traffic {
+        /**
+         * @brief Generates deterministic traffic scenarios for an airport
+         * @ingroup traffic
+         *
+         * The generator uses the stands, holding points and SIDs of the airport configuration and the runways
+         * and controller stations of the sector file.
+         * It creates departures that push back and taxi to the holding point, arrivals on the final and VFR traffic
+         * in the traffic circuit. The scenario is written in the recording format of the replay tool.
+         * The same settings create the same scenario.
+         */
+        class Generator {
+        public:
+            /**
+             * @brief Defines the parameters of a scenario
+             */
+            struct Settings {
+                std::string               airport;                /**< The airport's ICAO code */
+                types::Length             elevation;              /**< The airport's elevation */
+                std::string               sectorDirectory;        /**< The directory that contains the SCT and ESE files */
+                std::string               sectorName;             /**< The sector name to identify the SCT file */
+                std::string               configurationDirectory; /**< The directory that contains the TopSky-Tower configuration */
+                std::string               runway;                 /**< The active runway or empty to use the first runway */
+                std::size_t               departures;             /**< The number of departures */
+                std::size_t               arrivals;               /**< The number of arrivals */
+                std::size_t               vfrFlights;             /**< The number of VFR flights in the traffic circuit */
+                std::chrono::seconds      spacing;                /**< The time between two departures or two arrivals */
+                std::chrono::milliseconds interval;               /**< The time between two radar target updates */
+                std::uint32_t             seed;                   /**< The seed of the random number generator */
+            };
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            struct Flight {
+                std::string callsign;
+                bool        vfr;
+                std::string aircraft;
+                std::string wtc;
+                std::string origin;
+                std::string destination;
+                std::string sid;
+                std::string departureRunway;
+                std::string arrivalRunway;
+                std::string route;
+                Trajectory  trajectory;
+            };
+
+            Settings                    m_settings;
+            types::AirportConfiguration m_configuration;
+            std::list<types::Sector>    m_sectors;
+            types::Runway               m_runway;
+            std::mt19937                m_generator;
+
+            static std::string callsign(const std::string& prefix, std::size_t index);
+            static std::string controllerCallsign(const types::ControllerInfo& info);
+            static std::string formatFlight(const Flight& flight, const Trajectory::State& state);
+            void selectAircraft(Flight& flight, bool heavyAllowed);
+            std::string selectAirport();
+            const types::Stand& selectStand(std::size_t index) const;
+            types::Coordinate holdingPoint() const;
+            Flight createDeparture(std::size_t index);
+            Flight createArrival(std::size_t index);
+            Flight createVfrFlight(std::size_t index);
+
+        public:
+            /**
+             * @brief Creates a generator and loads the airport configuration and the sector file
+             * If one of the files cannot be loaded, the constructor throws an exception.
+             * @param[in] settings The scenario's parameters
+             */
+            Generator(const Settings& settings);
+
+            /**
+             * @brief Generates the scenario and writes it as a recording
+             * @param[in] stream The output stream
+             * @param[in] directory The directory of the recording to define the relative paths
+             * @return The number of written events
+             */
+            std::size_t write(std::ostream& stream, const std::string& directory);
+#endif
+        };
+    }
+}
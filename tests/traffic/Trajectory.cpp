@@ -0,0 +1,94 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the piecewise linear trajectory
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include "Trajectory.h"
+
+using namespace topskytower;
+using namespace topskytower::traffic;
+using namespace topskytower::types;
+
+Trajectory::Trajectory(const std::chrono::milliseconds& start, const types::Coordinate& coordinate,
+                       const types::Length& altitude, const types::Angle& heading, std::uint16_t atcFlags) :
+        m_keyframes() {
+    this->m_keyframes.push_back({ start, coordinate, altitude, heading, types::Velocity(), types::Velocity(), atcFlags });
+}
+
+void Trajectory::hold(const std::chrono::milliseconds& duration, std::uint16_t atcFlags) {
+    State keyframe = this->m_keyframes.back();
+
+    keyframe.time += duration;
+    keyframe.groundSpeed = types::Velocity();
+    keyframe.verticalSpeed = types::Velocity();
+    keyframe.atcFlags = atcFlags;
+
+    this->m_keyframes.push_back(keyframe);
+}
+
+void Trajectory::moveTo(const types::Coordinate& coordinate, const types::Length& altitude,
+                        const types::Velocity& groundSpeed, std::uint16_t atcFlags, bool reverse) {
+    const auto& previous = this->m_keyframes.back();
+    auto distance = previous.coordinate.distanceTo(coordinate);
+    auto duration = distance / groundSpeed;
+    State keyframe;
+
+    keyframe.time = previous.time + std::chrono::milliseconds(static_cast<std::int64_t>(duration.convert(types::millisecond)));
+    keyframe.coordinate = coordinate;
+    keyframe.altitude = altitude;
+    keyframe.heading = true == reverse ? previous.heading : previous.coordinate.bearingTo(coordinate);
+    keyframe.groundSpeed = groundSpeed;
+    keyframe.verticalSpeed = types::Velocity();
+    if (0.0_s < duration)
+        keyframe.verticalSpeed = (altitude - previous.altitude) / duration;
+    keyframe.atcFlags = atcFlags;
+
+    this->m_keyframes.push_back(keyframe);
+}
+
+const std::chrono::milliseconds& Trajectory::start() const {
+    return this->m_keyframes.front().time;
+}
+
+const std::chrono::milliseconds& Trajectory::end() const {
+    return this->m_keyframes.back().time;
+}
+
+const Trajectory::State& Trajectory::last() const {
+    return this->m_keyframes.back();
+}
+
+bool Trajectory::state(const std::chrono::milliseconds& time, State& state) const {
+    if (this->start() > time || this->end() < time)
+        return false;
+
+    /* find the first keyframe that ends after the requested time */
+    std::size_t idx = 0;
+    while (this->m_keyframes[idx].time < time)
+        ++idx;
+
+    state = this->m_keyframes[idx];
+    if (0 == idx || this->m_keyframes[idx].time == time)
+        return true;
+
+    /* interpolate the position along the leg that ends in the keyframe */
+    const auto& previous = this->m_keyframes[idx - 1];
+    auto legDuration = (this->m_keyframes[idx].time - previous.time).count();
+    auto ratio = static_cast<float>((time - previous.time).count()) / static_cast<float>(legDuration);
+
+    auto distance = previous.coordinate.distanceTo(this->m_keyframes[idx].coordinate);
+    if (0.0_m < distance)
+        state.coordinate = previous.coordinate.projection(previous.coordinate.bearingTo(this->m_keyframes[idx].coordinate), ratio * distance);
+    else
+        state.coordinate = previous.coordinate;
+    state.altitude = previous.altitude + ratio * (this->m_keyframes[idx].altitude - previous.altitude);
+    state.time = time;
+
+    return true;
+}
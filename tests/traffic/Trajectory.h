@@ -0,0 +1,99 @@
+/*
+ * @brief Defines a piecewise linear trajectory of a synthetic flight
+ * @file traffic/Trajectory.h
+ * @author Sven Czarnian <devel@svcz.de>
+ * @copyright Copyright 2020-2021 Sven Czarnian
+ * @license This project is published under the GNU General Public License v3 (GPLv3)
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <types/Coordinate.h>
+#include <types/Quantity.hpp>
+
+namespace topskytower {
+    namespace traffic {
+        /**
+         * @brief Describes the movement of a flight as a sequence of constant speed legs
+         * @ingroup traffic
+         *
+         * The trajectory starts at a fixed time and position and every leg appends a new keyframe.
+         * The state between two keyframes is interpolated along the geodesic between both positions.
+         */
+        class Trajectory {
+        public:
+            /**
+             * @brief Defines the state of the flight at a specific time
+             */
+            struct State {
+                std::chrono::milliseconds time;          /**< The time since the start of the scenario */
+                types::Coordinate         coordinate;    /**< The flight's position */
+                types::Length             altitude;      /**< The flight's altitude */
+                types::Angle              heading;       /**< The flight's heading */
+                types::Velocity           groundSpeed;   /**< The flight's ground speed */
+                types::Velocity           verticalSpeed; /**< The flight's vertical speed */
+                std::uint16_t             atcFlags;      /**< The ATC flags of the flight plan */
+            };
+
+#ifndef DOXYGEN_IGNORE
+        private:
+            std::vector<State> m_keyframes;
+
+        public:
+            /**
+             * @brief Creates a trajectory
+             * @param[in] start The time of the first keyframe
+             * @param[in] coordinate The initial position
+             * @param[in] altitude The initial altitude
+             * @param[in] heading The initial heading
+             * @param[in] atcFlags The initial ATC flags
+             */
+            Trajectory(const std::chrono::milliseconds& start, const types::Coordinate& coordinate,
+                       const types::Length& altitude, const types::Angle& heading, std::uint16_t atcFlags);
+
+            /**
+             * @brief Keeps the flight at the last position
+             * @param[in] duration The time at the last position
+             * @param[in] atcFlags The ATC flags during the leg
+             */
+            void hold(const std::chrono::milliseconds& duration, std::uint16_t atcFlags);
+            /**
+             * @brief Moves the flight with a constant speed to a new position
+             * @param[in] coordinate The target position
+             * @param[in] altitude The altitude at the target position
+             * @param[in] groundSpeed The ground speed during the leg
+             * @param[in] atcFlags The ATC flags during the leg
+             * @param[in] reverse Marks that the flight moves backwards and keeps the heading
+             */
+            void moveTo(const types::Coordinate& coordinate, const types::Length& altitude,
+                        const types::Velocity& groundSpeed, std::uint16_t atcFlags, bool reverse = false);
+            /**
+             * @brief Returns the time of the first keyframe
+             * @return The start time
+             */
+            const std::chrono::milliseconds& start() const;
+            /**
+             * @brief Returns the time of the last keyframe
+             * @return The end time
+             */
+            const std::chrono::milliseconds& end() const;
+            /**
+             * @brief Returns the last keyframe
+             * @return The last keyframe
+             */
+            const State& last() const;
+            /**
+             * @brief Interpolates the state at a specific time
+             * @param[in] time The requested time
+             * @param[out] state The interpolated state
+             * @return True if the time is inside the trajectory, else false
+             */
+            bool state(const std::chrono::milliseconds& time, State& state) const;
+#endif
+        };
+    }
+}
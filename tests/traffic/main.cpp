@@ -0,0 +1,108 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Generates synthetic traffic scenarios for the replay tool
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include <helper/Exception.h>
+
+#include "Generator.h"
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+static __inline void __usage(const char* application) {
+    std::cerr << "Usage: " << application << " --airport ICAO --elevation FT --sector DIRECTORY NAME --config DIRECTORY" << std::endl
+              << "       [--runway NAME] [--departures N] [--arrivals N] [--vfr N] [--spacing SECONDS]" << std::endl
+              << "       [--interval MILLISECONDS] [--seed N] [--output FILE]" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    traffic::Generator::Settings settings = {
+        "", 0_ft, "", "", "", "", 10, 10, 2, std::chrono::seconds(90), std::chrono::milliseconds(5000), 42
+    };
+    std::string output;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument(argv[i]);
+
+        if ("--airport" == argument && i + 1 < argc) {
+            settings.airport = argv[++i];
+        }
+        else if ("--elevation" == argument && i + 1 < argc) {
+            settings.elevation = static_cast<float>(std::atof(argv[++i])) * types::feet;
+        }
+        else if ("--sector" == argument && i + 2 < argc) {
+            settings.sectorDirectory = argv[++i];
+            settings.sectorName = argv[++i];
+        }
+        else if ("--config" == argument && i + 1 < argc) {
+            settings.configurationDirectory = argv[++i];
+        }
+        else if ("--runway" == argument && i + 1 < argc) {
+            settings.runway = argv[++i];
+        }
+        else if ("--departures" == argument && i + 1 < argc) {
+            settings.departures = static_cast<std::size_t>(std::atoll(argv[++i]));
+        }
+        else if ("--arrivals" == argument && i + 1 < argc) {
+            settings.arrivals = static_cast<std::size_t>(std::atoll(argv[++i]));
+        }
+        else if ("--vfr" == argument && i + 1 < argc) {
+            settings.vfrFlights = static_cast<std::size_t>(std::atoll(argv[++i]));
+        }
+        else if ("--spacing" == argument && i + 1 < argc) {
+            settings.spacing = std::chrono::seconds(std::atoll(argv[++i]));
+        }
+        else if ("--interval" == argument && i + 1 < argc) {
+            settings.interval = std::chrono::milliseconds(std::atoll(argv[++i]));
+        }
+        else if ("--seed" == argument && i + 1 < argc) {
+            settings.seed = static_cast<std::uint32_t>(std::atoll(argv[++i]));
+        }
+        else if ("--output" == argument && i + 1 < argc) {
+            output = argv[++i];
+        }
+        else {
+            __usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if (0 == settings.airport.length() || 0 == settings.sectorName.length() || 0 == settings.configurationDirectory.length() ||
+        0 >= settings.interval.count())
+    {
+        __usage(argv[0]);
+        return -1;
+    }
+
+    try {
+        traffic::Generator generator(settings);
+
+        if (0 != output.length()) {
+            std::ofstream stream(output);
+            auto directory = std::filesystem::absolute(output).parent_path().string();
+            auto events = generator.write(stream, directory);
+            std::cout << "generated " << events << " events in " << output << std::endl;
+        }
+        else {
+            generator.write(std::cout, std::filesystem::current_path().string());
+        }
+    }
+    catch (const helper::Exception& ex) {
+        std::cerr << ex.sender() << ": " << ex.message() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the fixed-width codes
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <types/Code.h>
+
+using namespace topskytower::types;
+
+TEST(Code, PacksCharacters) {
+    IcaoCode icao("EDDF");
+    RunwayCode runway("07");
+
+    EXPECT_EQ(4, icao.length());
+    EXPECT_EQ(std::string("EDDF"), icao.str());
+    EXPECT_EQ(2, runway.length());
+    EXPECT_EQ(std::string("07"), runway.str());
+    EXPECT_EQ(0, IcaoCode().length());
+    EXPECT_EQ(std::string(""), IcaoCode().str());
+}
+
+TEST(Code, RejectsLongStrings) {
+    RunwayCode runway("25CC");
+
+    EXPECT_EQ(0, runway.value());
+    EXPECT_EQ(RunwayCode(), runway);
+    EXPECT_FALSE(RunwayCode("25C") == std::string("25CC"));
+
+    /* the parsers check the strings before they create a code */
+    EXPECT_TRUE(RunwayCode::fits("25C"));
+    EXPECT_TRUE(RunwayCode::fits(""));
+    EXPECT_FALSE(RunwayCode::fits("25CC"));
+    EXPECT_TRUE(IcaoCode::fits("EDDF"));
+    EXPECT_FALSE(IcaoCode::fits("EDDFX"));
+}
+
+TEST(Code, ComparesLikeStrings) {
+    EXPECT_EQ(IcaoCode("EDDF"), IcaoCode("EDDF"));
+    EXPECT_NE(IcaoCode("EDDF"), IcaoCode("EDDM"));
+    EXPECT_TRUE(IcaoCode("EDDF") == std::string("EDDF"));
+    EXPECT_TRUE(std::string("EDDF") == IcaoCode("EDDF"));
+    EXPECT_FALSE(IcaoCode("EDDF") == std::string("EDD"));
+
+    EXPECT_LT(RunwayCode("07"), RunwayCode("07C"));
+    EXPECT_LT(RunwayCode("07C"), RunwayCode("25"));
+    EXPECT_LT(IcaoCode("EDDF"), IcaoCode("EDDM"));
+}
+
+TEST(Code, HashesAsKey) {
+    std::unordered_map<IcaoCode, int> airports;
+    airports[IcaoCode("EDDF")] = 1;
+    airports[IcaoCode("EDDM")] = 2;
+
+    EXPECT_EQ(2, airports.size());
+    EXPECT_EQ(1, airports[IcaoCode("EDDF")]);
+    EXPECT_EQ(2, airports[IcaoCode("EDDM")]);
+}
@@ -0,0 +1,48 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the coordinate parser
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <types/Coordinate.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+TEST(Coordinate, ParseSectorFileFormat) {
+    Coordinate coordinate("E008.34.14.123", "N050.01.59.500");
+    EXPECT_NEAR(8.570590f, coordinate.longitude().convert(types::degree), 1e-5f);
+    EXPECT_NEAR(50.033194f, coordinate.latitude().convert(types::degree), 1e-5f);
+
+    coordinate = Coordinate("W122.22.30.000", "S033.30.00.000");
+    EXPECT_NEAR(-122.375f, coordinate.longitude().convert(types::degree), 1e-5f);
+    EXPECT_NEAR(-33.5f, coordinate.latitude().convert(types::degree), 1e-5f);
+
+    /* invalid components are mapped to zero */
+    coordinate = Coordinate("X008.34.14.123", "N050.01.59");
+    EXPECT_EQ(0.0_deg, coordinate.longitude());
+    EXPECT_EQ(0.0_deg, coordinate.latitude());
+    coordinate = Coordinate("", "N050.01.59.500.1");
+    EXPECT_EQ(0.0_deg, coordinate.longitude());
+    EXPECT_EQ(0.0_deg, coordinate.latitude());
+}
+
+TEST(Coordinate, BulkMatchesSingle) {
+    std::vector<std::string_view> longitudes = { "E008.34.14.123", "E008.31.00.000", "W000.27.10.500" };
+    std::vector<std::string_view> latitudes = { "N050.01.59.500", "N050.02.30.000", "N051.28.39.000" };
+    std::vector<Coordinate> coordinates(longitudes.size());
+
+    Coordinate::parse(longitudes, latitudes, coordinates);
+    for (std::size_t i = 0; i < coordinates.size(); ++i)
+        EXPECT_EQ(Coordinate(longitudes[i], latitudes[i]), coordinates[i]);
+}
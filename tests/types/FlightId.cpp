@@ -0,0 +1,102 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the interned callsigns
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <gtest/gtest.h>
+
+#include <types/Flight.h>
+#include <types/FlightId.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+TEST(FlightId, InternedCallsignsAreStable) {
+    auto id = CallsignTable::instance().intern("DLH123");
+
+    EXPECT_EQ(id, CallsignTable::instance().find("DLH123"));
+    EXPECT_EQ(id, Flight("DLH123").id());
+    EXPECT_EQ("DLH123", CallsignTable::instance().callsign(id));
+    EXPECT_NE(id, Flight("DLH124").id());
+    EXPECT_EQ(CallsignTable::Invalid, CallsignTable::instance().find("UNKNOWN"));
+
+    /* the default flight uses the empty callsign */
+    EXPECT_EQ(0, Flight().id());
+    EXPECT_EQ(0, CallsignTable::instance().find(""));
+}
+
+TEST(FlightId, FlightMapIsIndexedByIdentifier) {
+    FlightMap<int> map;
+    auto first = Flight("AUA1").id();
+    auto second = Flight("AUA2").id();
+
+    map[second] = 2;
+    EXPECT_EQ(1, map.size());
+    EXPECT_FALSE(map.contains(first));
+    EXPECT_EQ(nullptr, map.find(first));
+    EXPECT_EQ(nullptr, map.find(CallsignTable::Invalid));
+
+    /* the values keep their addresses while the map grows */
+    auto value = map.find(second);
+    for (int i = 0; i < 1000; ++i)
+        map[Flight("TST" + std::to_string(i)).id()] = i;
+    EXPECT_EQ(value, map.find(second));
+    EXPECT_EQ(2, *value);
+
+    map.eraseIf([](FlightId, int entry) { return 0 != entry % 2; });
+    EXPECT_EQ(501, map.size());
+
+    std::size_t visited = 0;
+    map.forEach([&visited](FlightId, int entry) {
+        EXPECT_EQ(0, entry % 2);
+        visited += 1;
+    });
+    EXPECT_EQ(map.size(), visited);
+
+    EXPECT_TRUE(map.erase(second));
+    EXPECT_FALSE(map.erase(second));
+    EXPECT_FALSE(map.erase(CallsignTable::Invalid));
+    EXPECT_EQ(500, map.size());
+}
+
+TEST(FlightId, FlightMapReusesErasedSlots) {
+    FlightMap<int> map;
+    auto first = Flight("BAW1").id();
+    auto second = Flight("BAW2").id();
+
+    map[first] = 1;
+    auto value = map.find(first);
+    EXPECT_TRUE(map.erase(first));
+
+    /* the next flight takes the slot of the erased one */
+    map[second] = 2;
+    EXPECT_EQ(value, map.find(second));
+    EXPECT_FALSE(map.contains(first));
+    EXPECT_EQ(1, map.size());
+
+    /* a value that is created again starts with the default value */
+    EXPECT_EQ(0, map[first]);
+    EXPECT_EQ(2, map.size());
+}
+
+TEST(FlightId, FlightMapRejectsUnknownIdentifier) {
+    FlightMap<int> map;
+
+    EXPECT_THROW(map[CallsignTable::Invalid] = 1, helper::Exception);
+    EXPECT_EQ(0, map.size());
+    EXPECT_FALSE(map.contains(CallsignTable::Invalid));
+}
+
+TEST(FlightId, FlightUsesInternedIdentifier) {
+    auto id = CallsignTable::instance().intern("EWG1");
+    Flight flight("EWG1", id);
+
+    EXPECT_EQ(id, flight.id());
+    EXPECT_EQ("EWG1", flight.callsign());
+}
@@ -0,0 +1,75 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the kinematic table
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <types/KinematicTable.h>
+#include <types/LocalTangentPlane.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+static Flight __createFlight(const std::string& callsign, const Coordinate& coordinate) {
+    Flight flight(callsign);
+    flight.setCurrentPosition(Position(coordinate, 3000_ft, 250_deg));
+    flight.setGroundSpeed(160_kn);
+    return flight;
+}
+
+TEST(KinematicTable, SlotsStayDense) {
+    KinematicTable table;
+    auto first = __createFlight("KIN1", Coordinate(8.5_deg, 50.0_deg));
+    auto second = __createFlight("KIN2", Coordinate(8.6_deg, 50.1_deg));
+    auto third = __createFlight("KIN3", Coordinate(8.7_deg, 50.2_deg));
+
+    EXPECT_EQ(0, table.update(first));
+    EXPECT_EQ(1, table.update(second));
+    EXPECT_EQ(2, table.update(third));
+    EXPECT_EQ(1, table.update(second));
+    EXPECT_EQ(3, table.size());
+    EXPECT_EQ(second.currentPosition().coordinate().latitude(), table.position(1).coordinate().latitude());
+    EXPECT_EQ(3000_ft, table.position(1).altitude());
+    EXPECT_EQ(160_kn, Velocity(table.groundSpeeds()[1]));
+
+    /* the last flight moves into the free slot */
+    EXPECT_TRUE(table.erase(first.id()));
+    EXPECT_FALSE(table.erase(first.id()));
+    EXPECT_EQ(2, table.size());
+    EXPECT_EQ(KinematicTable::InvalidSlot, table.slot(first.id()));
+    EXPECT_EQ(0, table.slot(third.id()));
+    EXPECT_EQ(third.id(), table.ids()[0]);
+    EXPECT_EQ(third.currentPosition().coordinate().longitude(), table.position(0).coordinate().longitude());
+}
+
+TEST(KinematicTable, DistancesMatchCoordinates) {
+    Coordinate anchor(8.57_deg, 50.03_deg);
+    LocalTangentPlane plane(anchor, 10_nm);
+    KinematicTable table;
+    std::vector<Coordinate> coordinates;
+
+    /* full blocks, the remainder and one coordinate outside the range */
+    for (std::size_t i = 0; i < 11; ++i) {
+        auto coordinate = anchor.projection(static_cast<float>(i) * 33.0_deg, static_cast<float>(i) * 1_km);
+        if (2 == i)
+            coordinate = Coordinate(9.5_deg, 50.5_deg);
+
+        table.update(__createFlight("KIN" + std::to_string(10 + i), coordinate));
+        coordinates.push_back(coordinate);
+    }
+
+    std::vector<Length> expected(coordinates.size()), distances(table.size());
+    plane.distances(anchor, coordinates, expected);
+    plane.distances(anchor, table.latitudes(), table.longitudes(), distances);
+    for (std::size_t i = 0; i < coordinates.size(); ++i)
+        EXPECT_EQ(expected[i], distances[i]);
+}
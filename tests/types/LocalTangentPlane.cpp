@@ -0,0 +1,113 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the local tangent plane
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <helper/Exception.h>
+#include <helper/PerformanceCounter.h>
+#include <types/LocalTangentPlane.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+static const Coordinate __anchor(8.5706_deg, 50.0333_deg);
+
+TEST(LocalTangentPlane, MatchesGeodesic) {
+    LocalTangentPlane plane(__anchor, 10_nm);
+    Coordinate from(8.52_deg, 50.04_deg), to(8.60_deg, 50.02_deg);
+
+    /* the references are the WGS84 geodesics between both coordinates */
+    EXPECT_NEAR(6148.64f, plane.distance(from, to).convert(types::metre), 1.0f);
+    EXPECT_NEAR(111.1808f, plane.bearing(from, to).convert(types::degree), 0.01f);
+    EXPECT_NEAR(6148.64f, plane.distance(to, from).convert(types::metre), 1.0f);
+
+    Coordinate stand(8.5712_deg, 50.0336_deg);
+    EXPECT_NEAR(54.56f, plane.distance(__anchor, stand).convert(types::metre), 0.1f);
+    EXPECT_NEAR(52.0915f, plane.bearing(__anchor, stand).convert(types::degree), 0.01f);
+}
+
+TEST(LocalTangentPlane, SkipsGeodesicInsideRange) {
+    LocalTangentPlane plane(__anchor, 10_nm);
+    Coordinate from(8.52_deg, 50.04_deg), to(8.60_deg, 50.02_deg);
+
+    EXPECT_TRUE(plane.covers(from));
+    EXPECT_TRUE(plane.covers(to));
+
+    auto solves = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve);
+    plane.distance(from, to);
+    plane.bearing(from, to);
+    EXPECT_EQ(solves, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve));
+}
+
+TEST(LocalTangentPlane, FallsBackOutsideRange) {
+    LocalTangentPlane plane(__anchor, 10_nm);
+    Coordinate inside(8.52_deg, 50.04_deg), outside(9.5_deg, 50.5_deg);
+
+    EXPECT_FALSE(plane.covers(outside));
+    EXPECT_EQ(inside.distanceTo(outside), plane.distance(inside, outside));
+    EXPECT_EQ(inside.bearingTo(outside), plane.bearing(inside, outside));
+
+    /* a plane without range uses the ellipsoid for all coordinates */
+    LocalTangentPlane disabled(__anchor, 0_nm);
+    EXPECT_FALSE(disabled.covers(__anchor));
+    EXPECT_EQ(inside.distanceTo(__anchor), disabled.distance(inside, __anchor));
+}
+
+TEST(LocalTangentPlane, BatchMatchesSingle) {
+    LocalTangentPlane plane(__anchor, 10_nm);
+    Coordinate from(8.52_deg, 50.04_deg);
+    std::vector<Coordinate> to;
+    std::vector<Length> distances;
+
+    /* eleven coordinates cover full blocks, the remainder and one coordinate outside the range */
+    for (std::size_t i = 0; i < 10; ++i)
+        to.push_back(__anchor.projection(static_cast<float>(i) * 36.0_deg, static_cast<float>(i) * 1_km));
+    to.insert(to.begin() + 2, Coordinate(9.5_deg, 50.5_deg));
+    distances.resize(to.size());
+
+    plane.distances(from, to, distances);
+    for (std::size_t i = 0; i < to.size(); ++i) {
+        if (2 == i)
+            EXPECT_EQ(from.distanceTo(to[i]), distances[i]);
+        else
+            EXPECT_NEAR(plane.distance(from, to[i]).convert(types::metre), distances[i].convert(types::metre), 0.05f);
+    }
+
+    /* the exact batch matches the single geodesics */
+    from.distancesTo(to, distances);
+    for (std::size_t i = 0; i < to.size(); ++i)
+        EXPECT_EQ(from.distanceTo(to[i]), distances[i]);
+
+    std::vector<Angle> bearings(to.size());
+    plane.bearings(from, to, bearings);
+    for (std::size_t i = 0; i < to.size(); ++i)
+        EXPECT_EQ(plane.bearing(from, to[i]), bearings[i]);
+    from.bearingsTo(to, bearings);
+    for (std::size_t i = 0; i < to.size(); ++i)
+        EXPECT_EQ(from.bearingTo(to[i]), bearings[i]);
+}
+
+TEST(LocalTangentPlane, BatchRejectsSmallOutputs) {
+    LocalTangentPlane plane(__anchor, 10_nm);
+    Coordinate from(8.52_deg, 50.04_deg);
+    std::vector<Coordinate> to(4, __anchor);
+    std::vector<float> latitudes(4, 50.0f), longitudes(3, 8.5f);
+    std::vector<Length> distances(3);
+    std::vector<Angle> bearings(3);
+
+    EXPECT_THROW(plane.distances(from, to, distances), helper::Exception);
+    EXPECT_THROW(plane.distances(from, latitudes, longitudes, distances), helper::Exception);
+    EXPECT_THROW(plane.bearings(from, to, bearings), helper::Exception);
+    EXPECT_THROW(from.distancesTo(to, distances), helper::Exception);
+    EXPECT_THROW(from.bearingsTo(to, bearings), helper::Exception);
+}
@@ -0,0 +1,49 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the shared projection context
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <gtest/gtest.h>
+
+#include <helper/PerformanceCounter.h>
+#include <types/ProjectionContext.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+static const Coordinate __center(8.5706_deg, 50.0333_deg);
+
+TEST(ProjectionContext, ProjectsOncePerPosition) {
+    ProjectionContext context(__center);
+    Coordinate position(8.52_deg, 50.04_deg);
+    float first[2], second[2];
+
+    auto solves = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve);
+    context.forward(position, first);
+    context.forward(position, second);
+    EXPECT_EQ(solves + 1, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve));
+    EXPECT_EQ(first[0], second[0]);
+    EXPECT_EQ(first[1], second[1]);
+
+    /* a moved flight replaces the cached position */
+    context.forward(Coordinate(8.53_deg, 50.04_deg), second);
+    EXPECT_EQ(solves + 2, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve));
+    EXPECT_LT(first[0], second[0]);
+}
+
+TEST(ProjectionContext, ReverseMatchesForward) {
+    ProjectionContext context(__center);
+    Coordinate position(8.60_deg, 50.02_deg);
+    float cartesian[2];
+
+    context.forward(position, cartesian);
+    auto coordinate = context.reverse(cartesian[0], cartesian[1]);
+    EXPECT_NEAR(position.longitude().convert(types::degree), coordinate.longitude().convert(types::degree), 1e-4f);
+    EXPECT_NEAR(position.latitude().convert(types::degree), coordinate.latitude().convert(types::degree), 1e-4f);
+}
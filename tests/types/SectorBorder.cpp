@@ -0,0 +1,132 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the tests for the sector border
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <list>
+
+#include <gtest/gtest.h>
+
+#include <helper/PerformanceCounter.h>
+#include <types/SectorBorder.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+static SectorBorder __createBorder() {
+    std::list<Coordinate> edges;
+
+    /* a U-shaped border with an open notch in the north */
+    edges.push_back(Coordinate(8.0_deg, 50.0_deg));
+    edges.push_back(Coordinate(9.0_deg, 50.0_deg));
+    edges.push_back(Coordinate(9.0_deg, 51.0_deg));
+    edges.push_back(Coordinate(8.7_deg, 51.0_deg));
+    edges.push_back(Coordinate(8.7_deg, 50.3_deg));
+    edges.push_back(Coordinate(8.3_deg, 50.3_deg));
+    edges.push_back(Coordinate(8.3_deg, 51.0_deg));
+    edges.push_back(Coordinate(8.0_deg, 51.0_deg));
+
+    SectorBorder border("TEST", {}, 0_ft, 10000_ft);
+    border.setEdges(edges);
+    return border;
+}
+
+static SectorBorder __createCircle(const Coordinate& center) {
+    std::list<Coordinate> edges;
+
+    /* a circle with a radius of 20 NM */
+    for (int i = 0; i < 64; ++i)
+        edges.push_back(center.projection(static_cast<float>(i) * 5.625_deg, 20_nm));
+
+    SectorBorder border("TEST", {}, 0_ft, 10000_ft);
+    border.setEdges(edges);
+    return border;
+}
+
+TEST(SectorBorder, InsideAndOutside) {
+    auto border = __createBorder();
+
+    EXPECT_TRUE(border.isInsideBorder(Coordinate(8.5_deg, 50.15_deg)));
+    EXPECT_TRUE(border.isInsideBorder(Coordinate(8.15_deg, 50.8_deg)));
+    EXPECT_TRUE(border.isInsideBorder(Coordinate(8.85_deg, 50.8_deg)));
+    EXPECT_FALSE(border.isInsideBorder(Coordinate(8.5_deg, 50.7_deg)));
+    EXPECT_FALSE(border.isInsideBorder(Coordinate(9.5_deg, 50.5_deg)));
+
+    /* positions close to the edges */
+    EXPECT_TRUE(border.isInsideBorder(Coordinate(8.299_deg, 50.7_deg)));
+    EXPECT_FALSE(border.isInsideBorder(Coordinate(8.301_deg, 50.7_deg)));
+
+    EXPECT_TRUE(border.isInsideBorder(Position(Coordinate(8.5_deg, 50.15_deg), 5000_ft, 0_deg)));
+    EXPECT_FALSE(border.isInsideBorder(Position(Coordinate(8.5_deg, 50.15_deg), 15000_ft, 0_deg)));
+}
+
+TEST(SectorBorder, SkipsPolygonTestAwayFromEdges) {
+    Coordinate center(8.5_deg, 50.5_deg);
+    auto border = __createCircle(center);
+
+    /* the center and the corner of the bounding box are far away from all edges */
+    auto tests = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::PolygonTest);
+    EXPECT_TRUE(border.isInsideBorder(center));
+    EXPECT_FALSE(border.isInsideBorder(center.projection(315.0_deg, 27_nm)));
+    EXPECT_EQ(tests, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::PolygonTest));
+
+    /* positions close to the edges need the exact test */
+    EXPECT_TRUE(border.isInsideBorder(center.projection(90.0_deg, 19.9_nm)));
+    EXPECT_EQ(tests + 1, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::PolygonTest));
+}
+
+TEST(SectorBorder, CoverageOfRectangles) {
+    Coordinate center(8.5_deg, 50.5_deg);
+    auto border = __createCircle(center);
+
+    EXPECT_EQ(SectorBorder::Coverage::Inside, border.coverage(Coordinate(8.49_deg, 50.49_deg), Coordinate(8.51_deg, 50.51_deg)));
+    EXPECT_EQ(SectorBorder::Coverage::Partial, border.coverage(Coordinate(8.9_deg, 50.45_deg), Coordinate(9.2_deg, 50.55_deg)));
+    EXPECT_EQ(SectorBorder::Coverage::Outside, border.coverage(Coordinate(9.5_deg, 50.45_deg), Coordinate(9.6_deg, 50.55_deg)));
+
+    /* the corners of the bounding box are outside the circle */
+    auto corner = center.projection(315.0_deg, 27_nm);
+    EXPECT_EQ(SectorBorder::Coverage::Outside, border.coverage(corner, Coordinate(corner.longitude() + 0.01_deg, corner.latitude() + 0.01_deg)));
+}
+
+TEST(SectorBorder, DistanceToEdgesIsLowerBound) {
+    Coordinate center(8.5_deg, 50.5_deg);
+    auto border = __createCircle(center);
+
+    /* the distance does not need a geodesic solve */
+    auto solves = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve);
+    auto distance = border.distanceToEdges(center);
+    EXPECT_EQ(solves, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve));
+    EXPECT_GE(20_nm, distance);
+    EXPECT_LE(19_nm, distance);
+
+    /* the positions outside the border are close to the edges as well */
+    distance = border.distanceToEdges(center.projection(90.0_deg, 21_nm));
+    EXPECT_GE(1_nm, distance);
+    EXPECT_LE(0.9_nm, distance);
+}
+
+TEST(SectorBorder, SerializationKeepsShape) {
+    auto border = __createBorder();
+    helper::BinaryWriter writer;
+    border.serialize(writer);
+
+    /* the restored border uses the stored projection */
+    auto solves = helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve);
+    helper::BinaryReader reader(writer.buffer());
+    SectorBorder restored(reader);
+    EXPECT_EQ(solves, helper::PerformanceCounter::value(helper::PerformanceCounter::Type::GeodesicSolve));
+    EXPECT_TRUE(reader.finished());
+
+    EXPECT_EQ(border.owner(), restored.owner());
+    EXPECT_EQ(border.edges().size(), restored.edges().size());
+    EXPECT_TRUE(restored.isInsideBorder(Coordinate(8.5_deg, 50.15_deg)));
+    EXPECT_TRUE(restored.isInsideBorder(Coordinate(8.299_deg, 50.7_deg)));
+    EXPECT_FALSE(restored.isInsideBorder(Coordinate(8.301_deg, 50.7_deg)));
+    EXPECT_FALSE(restored.isInsideBorder(Position(Coordinate(8.5_deg, 50.15_deg), 15000_ft, 0_deg)));
+}
@@ -58,6 +58,16 @@ ControllerInfo::ControllerInfo(const std::string& identifier, const std::string&
         m_controllerName(fullName),
         m_center(longitude, latitude) { }
 
+ControllerInfo::ControllerInfo(helper::BinaryReader& reader) :
+        m_identifier(reader.readString()),
+        m_prefix(reader.readString()),
+        m_midfix(reader.readString()),
+        m_suffix(reader.readString()),
+        m_callsign(reader.readString()),
+        m_primaryFrequency(reader.readString()),
+        m_controllerName(reader.readString()),
+        m_center(reader) { }
+
 bool ControllerInfo::operator==(const ControllerInfo& other) const {
     return this->m_prefix == other.m_prefix && this->m_midfix == other.m_midfix && this->m_suffix == other.m_suffix;
 }
@@ -97,3 +107,14 @@ const std::string& ControllerInfo::controllerName() const {
 const types::Coordinate& ControllerInfo::centerPoint() const {
     return this->m_center;
 }
+
+void ControllerInfo::serialize(helper::BinaryWriter& writer) const {
+    writer.write(this->m_identifier);
+    writer.write(this->m_prefix);
+    writer.write(this->m_midfix);
+    writer.write(this->m_suffix);
+    writer.write(this->m_callsign);
+    writer.write(this->m_primaryFrequency);
+    writer.write(this->m_controllerName);
+    this->m_center.serialize(writer);
+}
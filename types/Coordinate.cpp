@@ -10,16 +10,27 @@
  */
 
 #include <algorithm>
+#include <charconv>
 
 #include <GeographicLib/Geodesic.hpp>
 
+#include <helper/Exception.h>
 #include <helper/Math.h>
-#include <helper/String.h>
+#include <helper/PerformanceCounter.h>
 #include <types/Coordinate.h>
 
 using namespace topskytower;
 using namespace topskytower::types;
 
+static __inline Angle __normalizeAzimuth(float azimuth) {
+    while (0.0f > azimuth)
+        azimuth += 360.0f;
+    while (360.0f <= azimuth)
+        azimuth -= 360.0f;
+
+    return azimuth * types::degree;
+}
+
 Coordinate::Coordinate() :
         m_longitude(0.0f),
         m_latitude(0.0f) { }
@@ -28,10 +39,34 @@ Coordinate::Coordinate(const Angle& longitude, const Angle& latitude) :
         m_longitude(longitude),
         m_latitude(latitude) { }
 
-static __inline Angle __coordinateToDecimal(const std::string& coordinate) {
+static __inline int __parseField(std::string_view field) {
+    int value = 0;
+
+    /* behave like atoi and ignore leading whitespaces and trailing garbage */
+    while (0 != field.length() && (' ' == field.front() || '\t' == field.front()))
+        field.remove_prefix(1);
+    if (0 != field.length() && '+' == field.front())
+        field.remove_prefix(1);
+
+    std::from_chars(field.data(), field.data() + field.length(), value);
+    return value;
+}
+
+static __inline Angle __coordinateToDecimal(std::string_view coordinate) {
     /* split the coordinate and validate the number of elements */
-    auto split = helper::String::splitString(coordinate, ".");
-    if (4 != split.size())
+    std::string_view split[4];
+    std::size_t count = 0, pos = 0;
+    while (true) {
+        if (4 == count)
+            return 0.0_deg;
+
+        auto next = coordinate.find('.', pos);
+        split[count++] = coordinate.substr(pos, next - pos);
+        if (std::string_view::npos == next)
+            break;
+        pos = next + 1;
+    }
+    if (4 != count || 0 == split[0].length())
         return 0.0_deg;
 
     /* get the sign factor depending on the global direction flag */
@@ -49,10 +84,10 @@ static __inline Angle __coordinateToDecimal(const std::string& coordinate) {
     }
 
     /* convert the values */
-    float degrees = static_cast<float>(std::atoi(split[0].substr(1).c_str()));
-    float minutes = static_cast<float>(std::atoi(split[1].c_str()));
-    float seconds = static_cast<float>(std::atoi(split[2].c_str()));
-    float milliseconds = static_cast<float>(std::atoi(split[3].c_str()));
+    float degrees = static_cast<float>(__parseField(split[0].substr(1)));
+    float minutes = static_cast<float>(__parseField(split[1]));
+    float seconds = static_cast<float>(__parseField(split[2]));
+    float milliseconds = static_cast<float>(__parseField(split[3]));
 
     /* calculate the dd value */
     float dd = degrees + minutes / 60.0f + seconds / 3600.0f + milliseconds / 3600000.0f;
@@ -60,10 +95,22 @@ static __inline Angle __coordinateToDecimal(const std::string& coordinate) {
     return signFactor * dd * types::degree;
 }
 
-Coordinate::Coordinate(const std::string& longitude, const std::string& latitude) :
+Coordinate::Coordinate(std::string_view longitude, std::string_view latitude) :
         m_longitude(__coordinateToDecimal(longitude)),
         m_latitude(__coordinateToDecimal(latitude)) { }
 
+Coordinate::Coordinate(helper::BinaryReader& reader) :
+        m_longitude(reader.read<float>()),
+        m_latitude(reader.read<float>()) { }
+
+void Coordinate::parse(std::span<const std::string_view> longitudes, std::span<const std::string_view> latitudes,
+                       std::span<Coordinate> coordinates) {
+    for (std::size_t i = 0; i < longitudes.size(); ++i) {
+        coordinates[i].m_longitude = __coordinateToDecimal(longitudes[i]);
+        coordinates[i].m_latitude = __coordinateToDecimal(latitudes[i]);
+    }
+}
+
 bool Coordinate::operator==(const Coordinate& other) const {
     return this->m_longitude == other.m_longitude && this->m_latitude == other.m_latitude;
 }
@@ -90,6 +137,7 @@ Angle& Coordinate::latitude() {
 
 Coordinate Coordinate::projection(const Angle& heading, const Length& distance) const {
     float lat, lon;
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::GeodesicSolve);
     GeographicLib::Geodesic::WGS84().Direct(this->latitude().convert(types::degree), this->longitude().convert(types::degree),
                                             heading.convert(types::degree), distance.convert(types::metre), lat, lon);
     return Coordinate(lon * types::degree, lat * types::degree);
@@ -97,23 +145,59 @@ Coordinate Coordinate::projection(const Angle& heading, const Length& distance)
 
 Length Coordinate::distanceTo(const Coordinate& other) const {
     float distance;
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::GeodesicSolve);
     GeographicLib::Geodesic::WGS84().Inverse(this->latitude().convert(types::degree), this->longitude().convert(types::degree),
                                              other.latitude().convert(types::degree), other.longitude().convert(types::degree),
                                              distance);
     return distance * types::metre;
 }
 
+void Coordinate::distancesTo(std::span<const Coordinate> others, std::span<Length> distances) const {
+    if (distances.size() < others.size())
+        throw helper::Exception("Coordinate", "Too few distances for the other coordinates");
+
+    const auto& geodesic = GeographicLib::Geodesic::WGS84();
+    auto latitude = this->latitude().convert(types::degree);
+    auto longitude = this->longitude().convert(types::degree);
+
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::GeodesicSolve, others.size());
+    for (std::size_t i = 0; i < others.size(); ++i) {
+        float distance;
+        geodesic.Inverse(latitude, longitude, others[i].latitude().convert(types::degree),
+                         others[i].longitude().convert(types::degree), distance);
+        distances[i] = distance * types::metre;
+    }
+}
+
 Angle Coordinate::bearingTo(const Coordinate& other) const {
     float azimuth0, azimuth1;
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::GeodesicSolve);
     GeographicLib::Geodesic::WGS84().Inverse(this->latitude().convert(types::degree), this->longitude().convert(types::degree),
                                              other.latitude().convert(types::degree), other.longitude().convert(types::degree),
                                              azimuth0, azimuth1);
     (void)azimuth1;
 
-    while (0.0 > azimuth0)
-        azimuth0 += 360.0f;
-    while (360.0 < azimuth0)
-        azimuth0 += 360.0f;
+    return __normalizeAzimuth(azimuth0);
+}
+
+void Coordinate::bearingsTo(std::span<const Coordinate> others, std::span<Angle> bearings) const {
+    if (bearings.size() < others.size())
+        throw helper::Exception("Coordinate", "Too few bearings for the other coordinates");
+
+    const auto& geodesic = GeographicLib::Geodesic::WGS84();
+    auto latitude = this->latitude().convert(types::degree);
+    auto longitude = this->longitude().convert(types::degree);
+
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::GeodesicSolve, others.size());
+    for (std::size_t i = 0; i < others.size(); ++i) {
+        float azimuth0, azimuth1;
+        geodesic.Inverse(latitude, longitude, others[i].latitude().convert(types::degree),
+                         others[i].longitude().convert(types::degree), azimuth0, azimuth1);
+        bearings[i] = __normalizeAzimuth(azimuth0);
+    }
+}
 
-    return azimuth0 * types::degree;
+void Coordinate::serialize(helper::BinaryWriter& writer) const {
+    writer.write(this->m_longitude.value());
+    writer.write(this->m_latitude.value());
 }
@@ -9,13 +9,24 @@
  *   GNU General Public License v3 (GPLv3)
  */
 
+#include <atomic>
+
 #include <types/Flight.h>
 
 using namespace topskytower::types;
 
+static std::atomic<std::uint64_t> __flightPlanVersion(0);
+
+static __inline const std::shared_ptr<const FlightPlan>& __emptyFlightPlan() {
+    /* all flights without a flight plan share one instance */
+    static const std::shared_ptr<const FlightPlan> __plan = std::make_shared<const FlightPlan>();
+    return __plan;
+}
+
 Flight::Flight() :
-        m_flightPlan(),
+        m_flightPlan(__emptyFlightPlan()),
         m_callsign(),
+        m_id(0),
         m_airborne(false),
         m_currentPosition(),
         m_groundSpeed(),
@@ -30,8 +41,26 @@ Flight::Flight() :
         m_handoffReceivedBy() { }
 
 Flight::Flight(const std::string& callsign) :
-        m_flightPlan(),
+        m_flightPlan(__emptyFlightPlan()),
         m_callsign(callsign),
+        m_id(CallsignTable::instance().intern(callsign)),
+        m_airborne(false),
+        m_currentPosition(),
+        m_groundSpeed(),
+        m_verticalSpeed(),
+        m_markedByController(false),
+        m_onMissedApproach(false),
+        m_irregularFlight(false),
+        m_establishedOnILS(false),
+        m_departureReady(false),
+        m_isTrackedByController(false),
+        m_isTrackedByOtherController(false),
+        m_handoffReceivedBy() { }
+
+Flight::Flight(const std::string& callsign, FlightId id) :
+        m_flightPlan(__emptyFlightPlan()),
+        m_callsign(callsign),
+        m_id(id),
         m_airborne(false),
         m_currentPosition(),
         m_groundSpeed(),
@@ -49,6 +78,10 @@ const std::string& Flight::callsign() const {
     return this->m_callsign;
 }
 
+FlightId Flight::id() const {
+    return this->m_id;
+}
+
 bool Flight::airborne() const {
     return this->m_airborne;
 }
@@ -86,10 +119,10 @@ bool Flight::readyForDeparture() const {
 }
 
 const FlightPlan& Flight::flightPlan() const {
-    return this->m_flightPlan;
+    return *this->m_flightPlan;
 }
 
-FlightPlan& Flight::flightPlan() {
+const std::shared_ptr<const FlightPlan>& Flight::sharedFlightPlan() const {
     return this->m_flightPlan;
 }
 
@@ -130,7 +163,16 @@ void Flight::setEstablishedOnILS(bool value) {
 }
 
 void Flight::setFlightPlan(const FlightPlan& plan) {
-    this->m_flightPlan = plan;
+    auto copy = std::make_shared<FlightPlan>(plan);
+    copy->m_version = ++__flightPlanVersion;
+    this->m_flightPlan = std::move(copy);
+}
+
+void Flight::setFlightPlan(const std::shared_ptr<const FlightPlan>& plan) {
+    if (nullptr != plan)
+        this->m_flightPlan = plan;
+    else
+        this->m_flightPlan = __emptyFlightPlan();
 }
 
 bool Flight::isTracked() const {
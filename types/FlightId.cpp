@@ -0,0 +1,79 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the interned callsigns
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <mutex>
+
+#include <types/FlightId.h>
+
+using namespace topskytower::types;
+
+CallsignTable::CallsignTable() :
+        m_lock(),
+        m_ids(),
+        m_callsigns() {
+    /* the default flight uses the empty callsign without a lookup */
+    this->m_ids[""] = 0;
+    this->m_callsigns.push_back("");
+}
+
+FlightId CallsignTable::intern(const std::string& callsign) {
+    /* the callsigns are interned only once -> try the shared lookup first */
+    {
+        std::shared_lock guard(this->m_lock);
+
+        auto it = this->m_ids.find(callsign);
+        if (this->m_ids.cend() != it)
+            return it->second;
+    }
+
+    std::unique_lock guard(this->m_lock);
+
+    /* an other thread may have interned the callsign in between */
+    auto it = this->m_ids.find(callsign);
+    if (this->m_ids.cend() != it)
+        return it->second;
+
+    auto id = static_cast<FlightId>(this->m_callsigns.size());
+    this->m_callsigns.push_back(callsign);
+    this->m_ids[callsign] = id;
+
+    return id;
+}
+
+FlightId CallsignTable::find(const std::string& callsign) const {
+    std::shared_lock guard(this->m_lock);
+
+    auto it = this->m_ids.find(callsign);
+    if (this->m_ids.cend() != it)
+        return it->second;
+    else
+        return CallsignTable::Invalid;
+}
+
+const std::string& CallsignTable::callsign(FlightId id) const {
+    std::shared_lock guard(this->m_lock);
+
+    /* the deque keeps the addresses of the interned callsigns */
+    if (this->m_callsigns.size() > id)
+        return this->m_callsigns[id];
+    else
+        return this->m_callsigns.front();
+}
+
+std::size_t CallsignTable::size() const {
+    std::shared_lock guard(this->m_lock);
+    return this->m_callsigns.size();
+}
+
+CallsignTable& CallsignTable::instance() {
+    static CallsignTable __instance;
+    return __instance;
+}
@@ -31,7 +31,8 @@ FlightPlan::FlightPlan() :
         m_clearanceFlags(false),
         m_rnavCapable(false),
         m_transponderExists(false),
-        m_route() { }
+        m_route(),
+        m_version(0) { }
 
 void FlightPlan::setType(FlightPlan::Type type) {
     this->m_type = type;
@@ -50,18 +51,18 @@ const types::Aircraft& FlightPlan::aircraft() const {
 }
 
 void FlightPlan::setOrigin(const std::string& origin) {
-    this->m_origin = origin;
+    this->m_origin = IcaoCode(origin);
 }
 
-const std::string& FlightPlan::origin() const {
+const IcaoCode& FlightPlan::origin() const {
     return this->m_origin;
 }
 
 void FlightPlan::setDestination(const std::string& destination) {
-    this->m_destination = destination;
+    this->m_destination = IcaoCode(destination);
 }
 
-const std::string& FlightPlan::destination() const {
+const IcaoCode& FlightPlan::destination() const {
     return this->m_destination;
 }
 
@@ -146,18 +147,18 @@ const std::string& FlightPlan::textRoute() const {
 }
 
 void FlightPlan::setDepartureRunway(const std::string& runway) {
-    this->m_departureRunway = runway;
+    this->m_departureRunway = RunwayCode(runway);
 }
 
-const std::string& FlightPlan::departureRunway() const {
+const RunwayCode& FlightPlan::departureRunway() const {
     return this->m_departureRunway;
 }
 
 void FlightPlan::setArrivalRunway(const std::string& runway) {
-    this->m_arrivalRunway = runway;
+    this->m_arrivalRunway = RunwayCode(runway);
 }
 
-const std::string& FlightPlan::arrivalRunway() const {
+const RunwayCode& FlightPlan::arrivalRunway() const {
     return this->m_arrivalRunway;
 }
 
@@ -194,3 +195,7 @@ FlightPlan::AtcCommand FlightPlan::departureFlag() const {
 FlightPlan::AtcCommand FlightPlan::arrivalFlag() const {
     return static_cast<FlightPlan::AtcCommand>(this->m_atcCommand & 0xf00);
 }
+
+std::uint64_t FlightPlan::version() const {
+    return this->m_version;
+}
@@ -0,0 +1,141 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the structure-of-arrays storage of the flight kinematics
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <types/KinematicTable.h>
+
+using namespace topskytower::types;
+
+KinematicTable::KinematicTable() :
+        m_slots(),
+        m_ids(),
+        m_latitudes(),
+        m_longitudes(),
+        m_altitudes(),
+        m_headings(),
+        m_groundSpeeds(),
+        m_verticalSpeeds() { }
+
+std::size_t KinematicTable::update(const Flight& flight) {
+    auto slot = this->m_slots.find(flight.id());
+    std::size_t idx;
+
+    if (nullptr == slot) {
+        idx = this->m_ids.size();
+        this->m_slots[flight.id()] = static_cast<std::uint32_t>(idx);
+
+        this->m_ids.push_back(flight.id());
+        this->m_latitudes.push_back(0.0f);
+        this->m_longitudes.push_back(0.0f);
+        this->m_altitudes.push_back(0.0f);
+        this->m_headings.push_back(0.0f);
+        this->m_groundSpeeds.push_back(0.0f);
+        this->m_verticalSpeeds.push_back(0.0f);
+    }
+    else {
+        idx = *slot;
+    }
+
+    const auto& position = flight.currentPosition();
+    this->m_latitudes[idx] = position.coordinate().latitude().value();
+    this->m_longitudes[idx] = position.coordinate().longitude().value();
+    this->m_altitudes[idx] = position.altitude().value();
+    this->m_headings[idx] = position.heading().value();
+    this->m_groundSpeeds[idx] = flight.groundSpeed().value();
+    this->m_verticalSpeeds[idx] = flight.verticalSpeed().value();
+
+    return idx;
+}
+
+bool KinematicTable::erase(FlightId id) {
+    auto slot = this->m_slots.find(id);
+    if (nullptr == slot)
+        return false;
+
+    /* move the last flight into the free slot to keep the arrays dense */
+    std::size_t idx = *slot;
+    std::size_t last = this->m_ids.size() - 1;
+    if (idx != last) {
+        this->m_ids[idx] = this->m_ids[last];
+        this->m_latitudes[idx] = this->m_latitudes[last];
+        this->m_longitudes[idx] = this->m_longitudes[last];
+        this->m_altitudes[idx] = this->m_altitudes[last];
+        this->m_headings[idx] = this->m_headings[last];
+        this->m_groundSpeeds[idx] = this->m_groundSpeeds[last];
+        this->m_verticalSpeeds[idx] = this->m_verticalSpeeds[last];
+        this->m_slots[this->m_ids[idx]] = static_cast<std::uint32_t>(idx);
+    }
+
+    this->m_ids.pop_back();
+    this->m_latitudes.pop_back();
+    this->m_longitudes.pop_back();
+    this->m_altitudes.pop_back();
+    this->m_headings.pop_back();
+    this->m_groundSpeeds.pop_back();
+    this->m_verticalSpeeds.pop_back();
+    this->m_slots.erase(id);
+
+    return true;
+}
+
+void KinematicTable::clear() {
+    this->m_slots.clear();
+    this->m_ids.clear();
+    this->m_latitudes.clear();
+    this->m_longitudes.clear();
+    this->m_altitudes.clear();
+    this->m_headings.clear();
+    this->m_groundSpeeds.clear();
+    this->m_verticalSpeeds.clear();
+}
+
+std::size_t KinematicTable::slot(FlightId id) const {
+    auto slot = this->m_slots.find(id);
+    if (nullptr == slot)
+        return KinematicTable::InvalidSlot;
+    return *slot;
+}
+
+std::size_t KinematicTable::size() const {
+    return this->m_ids.size();
+}
+
+std::span<const FlightId> KinematicTable::ids() const {
+    return this->m_ids;
+}
+
+std::span<const float> KinematicTable::latitudes() const {
+    return this->m_latitudes;
+}
+
+std::span<const float> KinematicTable::longitudes() const {
+    return this->m_longitudes;
+}
+
+std::span<const float> KinematicTable::altitudes() const {
+    return this->m_altitudes;
+}
+
+std::span<const float> KinematicTable::headings() const {
+    return this->m_headings;
+}
+
+std::span<const float> KinematicTable::groundSpeeds() const {
+    return this->m_groundSpeeds;
+}
+
+std::span<const float> KinematicTable::verticalSpeeds() const {
+    return this->m_verticalSpeeds;
+}
+
+Position KinematicTable::position(std::size_t slot) const {
+    return Position(Coordinate(Angle(this->m_longitudes[slot]), Angle(this->m_latitudes[slot])),
+                    Length(this->m_altitudes[slot]), Angle(this->m_headings[slot]));
+}
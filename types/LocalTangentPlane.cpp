@@ -0,0 +1,282 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the airport-anchored local tangent plane
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && 2 <= _M_IX86_FP) || defined(__SSE2__)
+#define LOCAL_TANGENT_PLANE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <GeographicLib/Constants.hpp>
+#include <GeographicLib/Math.hpp>
+
+#include <helper/Exception.h>
+#include <types/LocalTangentPlane.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+static __inline double __radians(const Angle& angle) {
+    return static_cast<double>(angle.convert(types::degree)) * GeographicLib::Math::pi<double>() / 180.0;
+}
+
+static __inline double __longitudeDelta(double from, double to) {
+    return std::remainder(to - from, 2.0 * GeographicLib::Math::pi<double>());
+}
+
+static __inline void __radiiOfCurvature(double latitude, double& meridional, double& normal) {
+    const double a = GeographicLib::Constants::WGS84_a<double>();
+    const double f = GeographicLib::Constants::WGS84_f<double>();
+    const double e2 = f * (2.0 - f);
+
+    auto sinLatitude = std::sin(latitude);
+    auto w = 1.0 - e2 * sinLatitude * sinLatitude;
+    normal = a / std::sqrt(w);
+    meridional = a * (1.0 - e2) / (w * std::sqrt(w));
+}
+
+LocalTangentPlane::LocalTangentPlane() :
+        m_anchor(),
+        m_range(),
+        m_anchorLatitude(0.0),
+        m_anchorLongitude(0.0),
+        m_meridionalRadius(0.0),
+        m_parallelRadius(0.0),
+        m_squaredRange(-1.0) { }
+
+LocalTangentPlane::LocalTangentPlane(const Coordinate& anchor, const Length& range) :
+        m_anchor(anchor),
+        m_range(range),
+        m_anchorLatitude(__radians(anchor.latitude())),
+        m_anchorLongitude(__radians(anchor.longitude())),
+        m_meridionalRadius(0.0),
+        m_parallelRadius(0.0),
+        m_squaredRange(static_cast<double>(range.convert(types::metre))) {
+    double normalRadius;
+    __radiiOfCurvature(this->m_anchorLatitude, this->m_meridionalRadius, normalRadius);
+    this->m_parallelRadius = normalRadius * std::cos(this->m_anchorLatitude);
+
+    /* a non-positive range deactivates the plane */
+    if (0.0 >= this->m_squaredRange)
+        this->m_squaredRange = -1.0;
+    else
+        this->m_squaredRange *= this->m_squaredRange;
+}
+
+const Coordinate& LocalTangentPlane::anchor() const {
+    return this->m_anchor;
+}
+
+const Length& LocalTangentPlane::range() const {
+    return this->m_range;
+}
+
+bool LocalTangentPlane::covers(const Coordinate& coordinate) const {
+    auto north = this->m_meridionalRadius * (__radians(coordinate.latitude()) - this->m_anchorLatitude);
+    auto east = this->m_parallelRadius * __longitudeDelta(this->m_anchorLongitude, __radians(coordinate.longitude()));
+
+    return north * north + east * east <= this->m_squaredRange;
+}
+
+bool LocalTangentPlane::localOffset(const Coordinate& from, const Coordinate& to, double& east, double& north,
+                                    double& convergence) const {
+    if (false == this->covers(from) || false == this->covers(to))
+        return false;
+
+    auto fromLatitude = __radians(from.latitude());
+    auto toLatitude = __radians(to.latitude());
+    auto deltaLongitude = __longitudeDelta(__radians(from.longitude()), __radians(to.longitude()));
+
+    /* use the radii of the mid-latitude to keep the error symmetric */
+    auto midLatitude = 0.5 * (fromLatitude + toLatitude);
+    double meridionalRadius, normalRadius;
+    __radiiOfCurvature(midLatitude, meridionalRadius, normalRadius);
+
+    east = normalRadius * std::cos(midLatitude) * deltaLongitude;
+    north = meridionalRadius * (toLatitude - fromLatitude);
+    convergence = 0.5 * deltaLongitude * std::sin(midLatitude);
+
+    return true;
+}
+
+Length LocalTangentPlane::distance(const Coordinate& from, const Coordinate& to) const {
+    double east, north, convergence;
+
+    if (false == this->localOffset(from, to, east, north, convergence))
+        return from.distanceTo(to);
+
+    return static_cast<float>(std::sqrt(east * east + north * north)) * types::metre;
+}
+
+#ifdef LOCAL_TANGENT_PLANE_SSE2
+static __inline __m128 __wrapLongitude(__m128 delta) {
+    const auto full = _mm_set1_ps(360.0f);
+
+    delta = _mm_sub_ps(delta, _mm_and_ps(_mm_cmpgt_ps(delta, _mm_set1_ps(180.0f)), full));
+    return _mm_add_ps(delta, _mm_and_ps(_mm_cmplt_ps(delta, _mm_set1_ps(-180.0f)), full));
+}
+#endif
+
+template <typename Loader, typename Accessor>
+void LocalTangentPlane::batchDistances(const Coordinate& from, std::size_t count, Loader loader, Accessor coordinate,
+                                       std::span<Length> distances) const {
+    std::size_t i = 0;
+
+#ifdef LOCAL_TANGENT_PLANE_SSE2
+    const double a = GeographicLib::Constants::WGS84_a<double>();
+    const double f = GeographicLib::Constants::WGS84_f<double>();
+    const double e2 = f * (2.0 - f);
+    const double toRadians = GeographicLib::Math::pi<double>() / 180.0;
+    auto fromLatitude = __radians(from.latitude());
+
+    const auto radians = _mm_set1_ps(static_cast<float>(toRadians));
+    const auto one = _mm_set1_ps(1.0f);
+    const auto half = _mm_set1_ps(0.5f);
+    const auto sixth = _mm_set1_ps(1.0f / 6.0f);
+    const auto semiMajorAxis = _mm_set1_ps(static_cast<float>(a));
+    const auto eccentricity = _mm_set1_ps(static_cast<float>(e2));
+    const auto meridionalScale = _mm_set1_ps(static_cast<float>(a * (1.0 - e2)));
+    const auto fromLat = _mm_set1_ps(from.latitude().convert(types::degree));
+    const auto fromLon = _mm_set1_ps(from.longitude().convert(types::degree));
+    const auto fromSin = _mm_set1_ps(static_cast<float>(std::sin(fromLatitude)));
+    const auto fromCos = _mm_set1_ps(static_cast<float>(std::cos(fromLatitude)));
+    const auto anchorLat = _mm_set1_ps(this->m_anchor.latitude().convert(types::degree));
+    const auto anchorLon = _mm_set1_ps(this->m_anchor.longitude().convert(types::degree));
+    const auto anchorNorth = _mm_set1_ps(static_cast<float>(this->m_meridionalRadius * toRadians));
+    const auto anchorEast = _mm_set1_ps(static_cast<float>(this->m_parallelRadius * toRadians));
+    const auto squaredRange = _mm_set1_ps(static_cast<float>(this->m_squaredRange));
+
+    for (; i + 4 <= count; i += 4) {
+        float latitudes[4], longitudes[4];
+        loader(i, latitudes, longitudes);
+        const auto latitude = _mm_loadu_ps(latitudes);
+        const auto longitude = _mm_loadu_ps(longitudes);
+
+        /* check which coordinates are inside the range around the anchor */
+        auto north = _mm_mul_ps(anchorNorth, _mm_sub_ps(latitude, anchorLat));
+        auto east = _mm_mul_ps(anchorEast, __wrapLongitude(_mm_sub_ps(longitude, anchorLon)));
+        auto inside = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(north, north), _mm_mul_ps(east, east)), squaredRange);
+
+        /* expand the sine and cosine of the mid-latitude around the first coordinate */
+        const auto deltaLatitude = _mm_mul_ps(_mm_sub_ps(latitude, fromLat), radians);
+        const auto deltaLongitude = _mm_mul_ps(__wrapLongitude(_mm_sub_ps(longitude, fromLon)), radians);
+        const auto h = _mm_mul_ps(half, deltaLatitude);
+        const auto h2 = _mm_mul_ps(h, h);
+        const auto cosH = _mm_sub_ps(one, _mm_mul_ps(half, h2));
+        const auto sinH = _mm_mul_ps(h, _mm_sub_ps(one, _mm_mul_ps(sixth, h2)));
+        const auto sinMid = _mm_add_ps(_mm_mul_ps(fromSin, cosH), _mm_mul_ps(fromCos, sinH));
+        const auto cosMid = _mm_sub_ps(_mm_mul_ps(fromCos, cosH), _mm_mul_ps(fromSin, sinH));
+
+        /* radii of curvature of the mid-latitude */
+        const auto w = _mm_sub_ps(one, _mm_mul_ps(eccentricity, _mm_mul_ps(sinMid, sinMid)));
+        const auto sqrtW = _mm_sqrt_ps(w);
+        const auto normalRadius = _mm_div_ps(semiMajorAxis, sqrtW);
+        const auto meridionalRadius = _mm_div_ps(meridionalScale, _mm_mul_ps(w, sqrtW));
+
+        east = _mm_mul_ps(_mm_mul_ps(normalRadius, cosMid), deltaLongitude);
+        north = _mm_mul_ps(meridionalRadius, deltaLatitude);
+
+        float result[4];
+        _mm_storeu_ps(result, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(north, north), _mm_mul_ps(east, east))));
+        auto mask = _mm_movemask_ps(inside);
+
+        for (std::size_t k = 0; k < 4; ++k) {
+            if (0 != (mask & (1 << k)))
+                distances[i + k] = result[k] * types::metre;
+            else
+                distances[i + k] = from.distanceTo(coordinate(i + k));
+        }
+    }
+#else
+    (void)loader;
+#endif
+
+    /* the remaining coordinates or all coordinates without SSE2 */
+    for (; i < count; ++i)
+        distances[i] = this->distance(from, coordinate(i));
+}
+
+void LocalTangentPlane::distances(const Coordinate& from, std::span<const Coordinate> to, std::span<Length> distances) const {
+    if (distances.size() < to.size())
+        throw helper::Exception("LocalTangentPlane", "Too few distances for the other coordinates");
+
+    /* the first coordinate is outside the plane -> all distances need the ellipsoid */
+    if (false == this->covers(from)) {
+        from.distancesTo(to, distances);
+        return;
+    }
+
+    this->batchDistances(from, to.size(),
+        [&to](std::size_t i, float* latitudes, float* longitudes) {
+            for (std::size_t k = 0; k < 4; ++k) {
+                latitudes[k] = to[i + k].latitude().convert(types::degree);
+                longitudes[k] = to[i + k].longitude().convert(types::degree);
+            }
+        },
+        [&to](std::size_t i) -> const Coordinate& { return to[i]; },
+        distances);
+}
+
+void LocalTangentPlane::distances(const Coordinate& from, std::span<const float> latitudes, std::span<const float> longitudes,
+                                  std::span<Length> distances) const {
+    if (latitudes.size() != longitudes.size() || distances.size() < latitudes.size())
+        throw helper::Exception("LocalTangentPlane", "Invalid sizes of the components or distances");
+
+    auto coordinate = [&latitudes, &longitudes](std::size_t i) {
+        return Coordinate(longitudes[i] * types::degree, latitudes[i] * types::degree);
+    };
+
+    /* the first coordinate is outside the plane -> all distances need the ellipsoid */
+    if (false == this->covers(from)) {
+        for (std::size_t i = 0; i < latitudes.size(); ++i)
+            distances[i] = from.distanceTo(coordinate(i));
+        return;
+    }
+
+    /* the components are already contiguous -> load them without a conversion */
+    this->batchDistances(from, latitudes.size(),
+        [&latitudes, &longitudes](std::size_t i, float* blockLatitudes, float* blockLongitudes) {
+            std::copy_n(latitudes.begin() + i, 4, blockLatitudes);
+            std::copy_n(longitudes.begin() + i, 4, blockLongitudes);
+        },
+        coordinate, distances);
+}
+
+Angle LocalTangentPlane::bearing(const Coordinate& from, const Coordinate& to) const {
+    double east, north, convergence;
+
+    if (false == this->localOffset(from, to, east, north, convergence))
+        return from.bearingTo(to);
+
+    /* the bearing in the plane is the azimuth at the mid-point -> rotate it back to the first coordinate */
+    auto azimuth = (std::atan2(east, north) - convergence) * 180.0 / GeographicLib::Math::pi<double>();
+    azimuth = std::fmod(azimuth, 360.0);
+    if (0.0 > azimuth)
+        azimuth += 360.0;
+
+    return static_cast<float>(azimuth) * types::degree;
+}
+
+void LocalTangentPlane::bearings(const Coordinate& from, std::span<const Coordinate> to, std::span<Angle> bearings) const {
+    if (bearings.size() < to.size())
+        throw helper::Exception("LocalTangentPlane", "Too few bearings for the other coordinates");
+
+    /* the first coordinate is outside the plane -> all bearings need the ellipsoid */
+    if (false == this->covers(from)) {
+        from.bearingsTo(to, bearings);
+        return;
+    }
+
+    for (std::size_t i = 0; i < to.size(); ++i)
+        bearings[i] = this->bearing(from, to[i]);
+}
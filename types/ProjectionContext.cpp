@@ -0,0 +1,79 @@
+/*
+ * Author:
+ *   Sven Czarnian <devel@svcz.de>
+ * Brief:
+ *   Implements the shared gnomonic projection of an airport
+ * Copyright:
+ *   2020-2021 Sven Czarnian
+ * License:
+ *   GNU General Public License v3 (GPLv3)
+ */
+
+#include <cstring>
+
+#include <GeographicLib/Gnomonic.hpp>
+
+#include <helper/PerformanceCounter.h>
+#include <types/ProjectionContext.h>
+
+using namespace topskytower;
+using namespace topskytower::types;
+
+static __inline std::uint64_t __coordinateKey(const Coordinate& coordinate) {
+    float longitude = coordinate.longitude().value(), latitude = coordinate.latitude().value();
+    std::uint32_t lonBits, latBits;
+
+    std::memcpy(&lonBits, &longitude, sizeof(lonBits));
+    std::memcpy(&latBits, &latitude, sizeof(latBits));
+
+    return (static_cast<std::uint64_t>(latBits) << 32) | static_cast<std::uint64_t>(lonBits);
+}
+
+ProjectionContext::ProjectionContext(const Coordinate& center) :
+        m_center(center),
+        m_cache() {
+    for (auto& entry : this->m_cache)
+        entry.valid = false;
+}
+
+const Coordinate& ProjectionContext::center() const {
+    return this->m_center;
+}
+
+void ProjectionContext::project(const Coordinate& coordinate, float cartesian[2]) const {
+    GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
+
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::GeodesicSolve);
+    projection.Forward(this->m_center.latitude().convert(types::degree), this->m_center.longitude().convert(types::degree),
+                       coordinate.latitude().convert(types::degree), coordinate.longitude().convert(types::degree),
+                       cartesian[0], cartesian[1]);
+}
+
+void ProjectionContext::forward(const Coordinate& coordinate, float cartesian[2]) {
+    auto key = __coordinateKey(coordinate);
+
+    /* mix the bits of both components and use the upper six bits to spread neighboring positions over the cache */
+    static_assert(64 == ProjectionContext::CacheSize, "The slot of the cache needs to be adapted to the size");
+    auto hash = key * 0x9e3779b97f4a7c15ULL;
+    auto& entry = this->m_cache[static_cast<std::size_t>(hash >> 58)];
+
+    if (false == entry.valid || entry.key != key) {
+        this->project(coordinate, entry.cartesian);
+        entry.key = key;
+        entry.valid = true;
+    }
+
+    cartesian[0] = entry.cartesian[0];
+    cartesian[1] = entry.cartesian[1];
+}
+
+Coordinate ProjectionContext::reverse(float x, float y) const {
+    GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
+    float lat, lon;
+
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::GeodesicSolve);
+    projection.Reverse(this->m_center.latitude().convert(types::degree), this->m_center.longitude().convert(types::degree),
+                       x, y, lat, lon);
+
+    return Coordinate(lon * types::degree, lat * types::degree);
+}
@@ -58,6 +58,15 @@ Sector::Sector(std::string&& identifier, std::string&& prefix, std::string&& mid
     this->parseSectorType();
 }
 
+Sector::Sector(helper::BinaryReader& reader) :
+        m_info(reader),
+        m_type(static_cast<Type>(reader.read<std::uint8_t>())),
+        m_borders() {
+    auto count = reader.read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < count; ++i)
+        this->m_borders.push_back(SectorBorder(reader));
+}
+
 Sector::Sector(const Sector& other) noexcept :
     m_info(other.m_info),
     m_type(other.m_type),
@@ -122,3 +131,12 @@ bool Sector::isInsideSector(const types::Position& position) const {
 
     return false;
 }
+
+void Sector::serialize(helper::BinaryWriter& writer) const {
+    this->m_info.serialize(writer);
+    writer.write(static_cast<std::uint8_t>(this->m_type));
+
+    writer.write(static_cast<std::uint32_t>(this->m_borders.size()));
+    for (const auto& border : std::as_const(this->m_borders))
+        border.serialize(writer);
+}
@@ -10,9 +10,12 @@
  */
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include <GeographicLib/Gnomonic.hpp>
 
+#include <helper/PerformanceCounter.h>
 #include <types/SectorBorder.h>
 
 using namespace topskytower;
@@ -27,7 +30,10 @@ SectorBorder::SectorBorder() noexcept :
         m_edges(),
         m_shape(),
         m_boundingBox{ { std::numeric_limits<float>::max() * types::degree, -std::numeric_limits<float>::max() * types::degree },
-                       { std::numeric_limits<float>::max() * types::degree, -std::numeric_limits<float>::max() * types::degree } } { }
+                       { std::numeric_limits<float>::max() * types::degree, -std::numeric_limits<float>::max() * types::degree } },
+        m_gridColumns(0),
+        m_gridRows(0),
+        m_grid() { }
 
 SectorBorder::SectorBorder(std::string&& owner, std::vector<std::string>&& deputies, const types::Length& lowerAltitude,
                            const types::Length& upperAltitude) noexcept :
@@ -39,7 +45,46 @@ SectorBorder::SectorBorder(std::string&& owner, std::vector<std::string>&& deput
         m_edges(),
         m_shape(),
         m_boundingBox{ { std::numeric_limits<float>::max() * types::degree, -std::numeric_limits<float>::max() * types::degree },
-                       { std::numeric_limits<float>::max() * types::degree, -std::numeric_limits<float>::max() * types::degree } } { }
+                       { std::numeric_limits<float>::max() * types::degree, -std::numeric_limits<float>::max() * types::degree } },
+        m_gridColumns(0),
+        m_gridRows(0),
+        m_grid() { }
+
+SectorBorder::SectorBorder(helper::BinaryReader& reader) :
+        m_owner(reader.readString()),
+        m_deputies(),
+        m_lowerAltitude(reader.read<float>()),
+        m_upperAltitude(reader.read<float>()),
+        m_centroid(reader),
+        m_edges(),
+        m_shape(),
+        m_boundingBox{ { types::Angle(reader.read<float>()), types::Angle(reader.read<float>()) },
+                       { types::Angle(reader.read<float>()), types::Angle(reader.read<float>()) } },
+        m_gridColumns(reader.read<std::uint32_t>()),
+        m_gridRows(reader.read<std::uint32_t>()),
+        m_grid() {
+    auto count = reader.read<std::uint32_t>();
+    this->m_deputies.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+        this->m_deputies.push_back(reader.readString());
+
+    count = reader.read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < count; ++i)
+        this->m_edges.push_back(types::Coordinate(reader));
+
+    /* the shape is already corrected */
+    count = reader.read<std::uint32_t>();
+    this->m_shape.outer().reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        float x = reader.read<float>();
+        float y = reader.read<float>();
+        this->m_shape.outer().push_back(bg::model::point<float, 2, bg::cs::cartesian>(x, y));
+    }
+
+    this->m_grid.resize(this->m_gridColumns * this->m_gridRows);
+    for (auto& cell : this->m_grid)
+        cell = reader.read<Cell>();
+}
 
 SectorBorder::SectorBorder(const SectorBorder& other) noexcept :
         m_owner(other.m_owner),
@@ -50,7 +95,10 @@ SectorBorder::SectorBorder(const SectorBorder& other) noexcept :
         m_edges(other.m_edges),
         m_shape(other.m_shape),
         m_boundingBox{ { other.m_boundingBox[0][0], other.m_boundingBox[0][1] },
-                       { other.m_boundingBox[1][0], other.m_boundingBox[1][1] } } { }
+                       { other.m_boundingBox[1][0], other.m_boundingBox[1][1] } },
+        m_gridColumns(other.m_gridColumns),
+        m_gridRows(other.m_gridRows),
+        m_grid(other.m_grid) { }
 
 SectorBorder::SectorBorder(SectorBorder&& other) noexcept :
         m_owner(std::move(other.m_owner)),
@@ -61,7 +109,10 @@ SectorBorder::SectorBorder(SectorBorder&& other) noexcept :
         m_edges(std::move(other.m_edges)),
         m_shape(std::move(other.m_shape)),
         m_boundingBox{ { other.m_boundingBox[0][0], other.m_boundingBox[0][1] },
-                       { other.m_boundingBox[1][0], other.m_boundingBox[1][1] } } { }
+                       { other.m_boundingBox[1][0], other.m_boundingBox[1][1] } },
+        m_gridColumns(other.m_gridColumns),
+        m_gridRows(other.m_gridRows),
+        m_grid(std::move(other.m_grid)) { }
 
 SectorBorder& SectorBorder::operator=(const SectorBorder& other) noexcept {
     if (&other != this) {
@@ -72,6 +123,9 @@ SectorBorder& SectorBorder::operator=(const SectorBorder& other) noexcept {
         this->m_centroid = other.m_centroid;
         this->m_edges = other.m_edges;
         this->m_shape = other.m_shape;
+        this->m_gridColumns = other.m_gridColumns;
+        this->m_gridRows = other.m_gridRows;
+        this->m_grid = other.m_grid;
 
         for (int i = 0; i < 2; ++i) {
             for (int c = 0; c < 2; ++c)
@@ -90,6 +144,9 @@ SectorBorder& SectorBorder::operator=(SectorBorder&& other) noexcept {
         this->m_centroid = std::move(other.m_centroid);
         this->m_edges = std::move(other.m_edges);
         this->m_shape = std::move(other.m_shape);
+        this->m_gridColumns = other.m_gridColumns;
+        this->m_gridRows = other.m_gridRows;
+        this->m_grid = std::move(other.m_grid);
 
         for (int i = 0; i < 2; ++i) {
             for (int c = 0; c < 2; ++c)
@@ -159,12 +216,164 @@ void SectorBorder::setEdges(const std::list<types::Coordinate>& edges) {
     bg::correct(this->m_shape);
 
     this->m_edges = edges;
+
+    this->buildGrid();
+}
+
+static __inline bool __segmentIntersectsBox(const bg::model::point<float, 2, bg::cs::cartesian>& start,
+                                            const bg::model::point<float, 2, bg::cs::cartesian>& end,
+                                            float minX, float minY, float maxX, float maxY) {
+    float x0 = start.get<0>(), y0 = start.get<1>(), x1 = end.get<0>(), y1 = end.get<1>();
+
+    /* the bounding boxes do not overlap */
+    if (std::max(x0, x1) < minX || std::min(x0, x1) > maxX || std::max(y0, y1) < minY || std::min(y0, y1) > maxY)
+        return false;
+
+    /* the corners of the box need to be on both sides of the segment's line */
+    float sides[4] = {
+        (x1 - x0) * (minY - y0) - (y1 - y0) * (minX - x0),
+        (x1 - x0) * (minY - y0) - (y1 - y0) * (maxX - x0),
+        (x1 - x0) * (maxY - y0) - (y1 - y0) * (minX - x0),
+        (x1 - x0) * (maxY - y0) - (y1 - y0) * (maxX - x0)
+    };
+    bool positive = false, negative = false;
+    for (const auto& side : sides) {
+        positive |= 0.0f <= side;
+        negative |= 0.0f >= side;
+    }
+
+    return true == positive && true == negative;
+}
+
+void SectorBorder::buildGrid() {
+    this->m_gridColumns = 0;
+    this->m_gridRows = 0;
+    this->m_grid.clear();
+
+    const auto& ring = this->m_shape.outer();
+    if (4 > ring.size())
+        return;
+
+    float minLon = this->m_boundingBox[0][0].convert(types::degree), maxLon = this->m_boundingBox[0][1].convert(types::degree);
+    float minLat = this->m_boundingBox[1][0].convert(types::degree), maxLat = this->m_boundingBox[1][1].convert(types::degree);
+
+    /* borders around the antimeridian or degenerated borders use the exact test */
+    if (0.0f >= maxLon - minLon || 0.0f >= maxLat - minLat || 180.0f < maxLon - minLon)
+        return;
+    for (const auto& point : std::as_const(ring)) {
+        if (false == std::isfinite(point.get<0>()) || false == std::isfinite(point.get<1>()))
+            return;
+    }
+
+    /* the resolution grows with the number of edges to keep the number of crossed cells small */
+    std::size_t resolution = static_cast<std::size_t>(2.0f * std::ceil(std::sqrt(static_cast<float>(ring.size()))));
+    resolution = std::min<std::size_t>(std::max<std::size_t>(resolution, 4), 32);
+    float lonStep = (maxLon - minLon) / static_cast<float>(resolution);
+    float latStep = (maxLat - minLat) / static_cast<float>(resolution);
+
+    /* project the corners of all cells */
+    GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
+    std::vector<bg::model::point<float, 2, bg::cs::cartesian>> corners((resolution + 1) * (resolution + 1));
+    for (std::size_t row = 0; row <= resolution; ++row) {
+        for (std::size_t column = 0; column <= resolution; ++column) {
+            float x, y;
+
+            projection.Forward(this->m_centroid.latitude().convert(types::degree), this->m_centroid.longitude().convert(types::degree),
+                               minLat + static_cast<float>(row) * latStep, minLon + static_cast<float>(column) * lonStep, x, y);
+            if (false == std::isfinite(x) || false == std::isfinite(y))
+                return;
+
+            corners[row * (resolution + 1) + column] = bg::model::point<float, 2, bg::cs::cartesian>(x, y);
+        }
+    }
+
+    /* mark all cells that are close to an edge */
+    std::vector<Cell> grid(resolution * resolution, Cell::Unknown);
+    for (std::size_t row = 0; row < resolution; ++row) {
+        for (std::size_t column = 0; column < resolution; ++column) {
+            float minX = std::numeric_limits<float>::max(), maxX = -std::numeric_limits<float>::max();
+            float minY = std::numeric_limits<float>::max(), maxY = -std::numeric_limits<float>::max();
+
+            for (std::size_t corner = 0; corner < 4; ++corner) {
+                const auto& point = corners[(row + corner / 2) * (resolution + 1) + column + corner % 2];
+                minX = std::min(minX, point.get<0>());
+                maxX = std::max(maxX, point.get<0>());
+                minY = std::min(minY, point.get<1>());
+                maxY = std::max(maxY, point.get<1>());
+            }
+
+            /* the projected parallels are curved -> extend the cell to be conservative */
+            float margin = 0.05f * std::max(maxX - minX, maxY - minY) + 1.0f;
+            minX -= margin;
+            maxX += margin;
+            minY -= margin;
+            maxY += margin;
+
+            for (std::size_t i = 0; i < ring.size() - 1; ++i) {
+                if (true == __segmentIntersectsBox(ring[i], ring[i + 1], minX, minY, maxX, maxY)) {
+                    grid[row * resolution + column] = Cell::Boundary;
+                    break;
+                }
+            }
+        }
+    }
+
+    /*
+     * Neighboring cells without an edge have the same state.
+     * Test the center of one cell per connected area and propagate the result.
+     */
+    std::vector<std::size_t> pending;
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+        if (Cell::Unknown != grid[i])
+            continue;
+
+        std::size_t row = i / resolution, column = i % resolution;
+        types::Coordinate center((minLon + (static_cast<float>(column) + 0.5f) * lonStep) * types::degree,
+                                 (minLat + (static_cast<float>(row) + 0.5f) * latStep) * types::degree);
+        auto state = true == this->isInsideShape(center) ? Cell::Inside : Cell::Outside;
+
+        grid[i] = state;
+        pending.push_back(i);
+        while (0 != pending.size()) {
+            auto index = pending.back();
+            pending.pop_back();
+
+            row = index / resolution;
+            column = index % resolution;
+            std::size_t neighbors[4] = {
+                0 != row ? index - resolution : index,
+                resolution - 1 != row ? index + resolution : index,
+                0 != column ? index - 1 : index,
+                resolution - 1 != column ? index + 1 : index
+            };
+
+            for (const auto& neighbor : neighbors) {
+                if (Cell::Unknown == grid[neighbor]) {
+                    grid[neighbor] = state;
+                    pending.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    this->m_gridColumns = resolution;
+    this->m_gridRows = resolution;
+    this->m_grid = std::move(grid);
 }
 
 const std::list<types::Coordinate>& SectorBorder::edges() const {
     return this->m_edges;
 }
 
+void SectorBorder::gridCell(const types::Coordinate& coordinate, std::size_t& column, std::size_t& row) const {
+    float lonRatio = (coordinate.longitude() - this->m_boundingBox[0][0]).value() /
+                     (this->m_boundingBox[0][1] - this->m_boundingBox[0][0]).value();
+    float latRatio = (coordinate.latitude() - this->m_boundingBox[1][0]).value() /
+                     (this->m_boundingBox[1][1] - this->m_boundingBox[1][0]).value();
+    column = std::min(static_cast<std::size_t>(lonRatio * this->m_gridColumns), this->m_gridColumns - 1);
+    row = std::min(static_cast<std::size_t>(latRatio * this->m_gridRows), this->m_gridRows - 1);
+}
+
 bool SectorBorder::isInsideBorder(const types::Coordinate& coordinate) const {
     /* check if the bounding box does not contain the coordinate */
     if (this->m_boundingBox[0][0] > coordinate.longitude() || this->m_boundingBox[0][1] < coordinate.longitude())
@@ -172,6 +381,28 @@ bool SectorBorder::isInsideBorder(const types::Coordinate& coordinate) const {
     if (this->m_boundingBox[1][0] > coordinate.latitude() || this->m_boundingBox[1][1] < coordinate.latitude())
         return false;
 
+    /* the cells inside or outside the border do not need the exact test */
+    if (0 != this->m_grid.size()) {
+        std::size_t column, row;
+        this->gridCell(coordinate, column, row);
+
+        switch (this->m_grid[row * this->m_gridColumns + column]) {
+        case Cell::Inside:
+            return true;
+        case Cell::Outside:
+            return false;
+        default:
+            break;
+        }
+    }
+
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::GeodesicSolve);
+    helper::PerformanceCounter::increment(helper::PerformanceCounter::Type::PolygonTest);
+
+    return this->isInsideShape(coordinate);
+}
+
+bool SectorBorder::isInsideShape(const types::Coordinate& coordinate) const {
     /* convert the point into cartesian coordinates */
     float x, y;
     GeographicLib::Gnomonic projection(GeographicLib::Geodesic::WGS84());
@@ -186,3 +417,122 @@ bool SectorBorder::isInsideBorder(const types::Position& position) const {
         return false;
     return this->isInsideBorder(position.coordinate());
 }
+
+SectorBorder::Coverage SectorBorder::coverage(const types::Coordinate& southWest, const types::Coordinate& northEast) const {
+    /* the rectangle does not overlap the bounding box */
+    if (this->m_boundingBox[0][0] > northEast.longitude() || this->m_boundingBox[0][1] < southWest.longitude())
+        return Coverage::Outside;
+    if (this->m_boundingBox[1][0] > northEast.latitude() || this->m_boundingBox[1][1] < southWest.latitude())
+        return Coverage::Outside;
+    if (0 == this->m_grid.size())
+        return Coverage::Partial;
+
+    /* the positions outside the bounding box are outside the border */
+    bool contained = this->m_boundingBox[0][0] <= southWest.longitude() && this->m_boundingBox[0][1] >= northEast.longitude() &&
+                     this->m_boundingBox[1][0] <= southWest.latitude() && this->m_boundingBox[1][1] >= northEast.latitude();
+    types::Coordinate lower(std::max(southWest.longitude(), this->m_boundingBox[0][0]), std::max(southWest.latitude(), this->m_boundingBox[1][0]));
+    types::Coordinate upper(std::min(northEast.longitude(), this->m_boundingBox[0][1]), std::min(northEast.latitude(), this->m_boundingBox[1][1]));
+
+    std::size_t minColumn, minRow, maxColumn, maxRow;
+    this->gridCell(lower, minColumn, minRow);
+    this->gridCell(upper, maxColumn, maxRow);
+
+    bool inside = true, outside = true;
+    for (std::size_t row = minRow; row <= maxRow; ++row) {
+        for (std::size_t column = minColumn; column <= maxColumn; ++column) {
+            switch (this->m_grid[row * this->m_gridColumns + column]) {
+            case Cell::Inside:
+                outside = false;
+                break;
+            case Cell::Outside:
+                inside = false;
+                break;
+            default:
+                return Coverage::Partial;
+            }
+        }
+    }
+
+    if (true == outside)
+        return Coverage::Outside;
+    else if (true == inside && true == contained)
+        return Coverage::Inside;
+    else
+        return Coverage::Partial;
+}
+
+types::Length SectorBorder::distanceToEdges(const types::Coordinate& coordinate) const {
+    /* borders without edges never contain a position */
+    if (0 == this->m_edges.size())
+        return std::numeric_limits<float>::max() * types::metre;
+
+    /*
+     * the edges are mapped into the plane around the coordinate without a geodesic solve
+     * the lower bounds of the ellipsoid's radii keep the distances short and the bend of the geodesic is subtracted
+     * the geodesic bends towards the pole and may leave the bounding box, but the positions outside the box are closer than the bend
+     */
+    float latitude = coordinate.latitude().convert(types::degree), longitude = coordinate.longitude().convert(types::degree);
+    float northScale = 110574.0f, eastScale = 111319.0f * std::cos(coordinate.latitude().convert(types::radian));
+    float pole = std::max(std::abs(this->m_boundingBox[1][0].convert(types::radian)), std::abs(this->m_boundingBox[1][1].convert(types::radian)));
+    float bendScale = 1.5f * std::tan(pole) / (8.0f * 6371000.0f);
+    float distance = std::numeric_limits<float>::max();
+
+    float x0 = 0.0f, y0 = 0.0f;
+    for (auto it = this->m_edges.cbegin(); this->m_edges.cend() != it; ++it) {
+        float deltaLon = it->longitude().convert(types::degree) - longitude;
+        if (180.0f < std::abs(deltaLon))
+            deltaLon = std::remainder(deltaLon, 360.0f);
+        float x1 = deltaLon * eastScale, y1 = (it->latitude().convert(types::degree) - latitude) * northScale;
+
+        /* the last edge closes the ring */
+        if (this->m_edges.cbegin() == it) {
+            auto last = std::prev(this->m_edges.cend());
+            deltaLon = last->longitude().convert(types::degree) - longitude;
+            if (180.0f < std::abs(deltaLon))
+                deltaLon = std::remainder(deltaLon, 360.0f);
+            x0 = deltaLon * eastScale;
+            y0 = (last->latitude().convert(types::degree) - latitude) * northScale;
+        }
+
+        float dx = x1 - x0, dy = y1 - y0;
+        float length = dx * dx + dy * dy;
+        float ratio = 0.0f < length ? std::clamp(-(x0 * dx + y0 * dy) / length, 0.0f, 1.0f) : 0.0f;
+        float ex = x0 + ratio * dx, ey = y0 + ratio * dy;
+        distance = std::min(distance, 0.99f * std::sqrt(ex * ex + ey * ey) - length * bendScale);
+
+        x0 = x1;
+        y0 = y1;
+    }
+
+    return std::max(0.0f, distance) * types::metre;
+}
+
+void SectorBorder::serialize(helper::BinaryWriter& writer) const {
+    writer.write(this->m_owner);
+    writer.write(this->m_lowerAltitude.value());
+    writer.write(this->m_upperAltitude.value());
+    this->m_centroid.serialize(writer);
+    for (int i = 0; i < 2; ++i) {
+        for (int c = 0; c < 2; ++c)
+            writer.write(this->m_boundingBox[i][c].value());
+    }
+    writer.write(static_cast<std::uint32_t>(this->m_gridColumns));
+    writer.write(static_cast<std::uint32_t>(this->m_gridRows));
+
+    writer.write(static_cast<std::uint32_t>(this->m_deputies.size()));
+    for (const auto& deputy : std::as_const(this->m_deputies))
+        writer.write(deputy);
+
+    writer.write(static_cast<std::uint32_t>(this->m_edges.size()));
+    for (const auto& edge : std::as_const(this->m_edges))
+        edge.serialize(writer);
+
+    writer.write(static_cast<std::uint32_t>(this->m_shape.outer().size()));
+    for (const auto& point : std::as_const(this->m_shape.outer())) {
+        writer.write(point.get<0>());
+        writer.write(point.get<1>());
+    }
+
+    for (const auto& cell : std::as_const(this->m_grid))
+        writer.write(cell);
+}